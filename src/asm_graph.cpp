@@ -12,6 +12,7 @@
 #include "lvar.hpp"
 #include "asm_proc.hpp"
 #include "thread.hpp"
+#include "mapper.hpp"
 
 TLS worklist_t<asm_node_t*> asm_graph_t::worklist;
 
@@ -1685,3 +1686,287 @@ void asm_graph_t::remove_maybes(fn_t const& fn)
     }
 }
 
+
+// Returns the register an absolute or zero page load / store uses, or -1.
+static int simple_reg(op_t op, op_name_t a, op_name_t x, op_name_t y)
+{
+    if(op_addr_mode(op) != MODE_ABSOLUTE && op_addr_mode(op) != MODE_ZERO_PAGE)
+        return -1;
+    op_name_t const name = op_name(op);
+    if(name == a)
+        return REG_A;
+    if(name == x)
+        return REG_X;
+    if(name == y)
+        return REG_Y;
+    return -1;
+}
+
+static int simple_load_reg(op_t op) { return simple_reg(op, LDA, LDX, LDY); }
+static int simple_store_reg(op_t op) { return simple_reg(op, STA, STX, STY); }
+
+reg_conv_t asm_graph_t::build_reg_conv(fn_t const& fn)
+{
+    reg_conv_t conv;
+
+    // Only plain 'JSR's are supported, as bank switching trampolines use registers.
+    // Every caller must be known too.
+    if(fn.fclass != FN_FN || fn.iasm || fn.fn_set() || fn.referenced() || fn.referenced_label()
+       || mapper().bankswitches())
+    {
+        return conv;
+    }
+
+    // Count how often each argument and return is used:
+    rh::batman_map<locator_t, unsigned> uses;
+    for_each_inst([&](asm_inst_t const& inst)
+    {
+        for(locator_t loc : { inst.arg, inst.alt })
+            if((loc.lclass() == LOC_ARG || loc.lclass() == LOC_RETURN) && loc.fn() == fn.handle())
+                uses[loc.mem_head()] += 1;
+    });
+
+    auto const single_use = [&](locator_t loc) -> bool
+    {
+        if(loc != loc.mem_head() || loc.mem_size() != 1)
+            return false;
+        auto const* pair = uses.lookup(loc);
+        return pair && pair->second == 1;
+    };
+
+    // Arguments:
+
+    asm_node_t* entry = nullptr;
+    for(asm_node_t& node : list)
+        if(node.label == m_entry_label)
+            entry = &node;
+    assert(entry);
+
+    if(entry->inputs().empty())
+    {
+        auto& code = entry->code;
+
+        // Find the registers live after each op:
+        static TLS std::vector<regs_t> live_regs;
+        live_regs.resize(code.size());
+
+        regs_t live = entry->vregs.out;
+        live &= ~op_output_regs(entry->output_inst.op);
+        live |= op_input_regs(entry->output_inst.op);
+
+        for(int i = int(code.size()) - 1; i >= 0; --i)
+        {
+            live_regs[i] = live;
+            live &= ~op_output_regs(code[i].op);
+            live |= op_input_regs(code[i].op);
+        }
+
+        // Loads of arguments into untouched registers can be removed,
+        // as the caller will provide that register instead.
+        regs_t touched = 0;
+        for(unsigned i = 0; i < code.size(); ++i)
+        {
+            asm_inst_t& inst = code[i];
+
+            if(op_flags(inst.op) & (ASMF_JUMP | ASMF_RETURN | ASMF_CALL | ASMF_SWITCH | ASMF_FENCE))
+                break;
+
+            regs_t const regs = op_regs(inst.op);
+            int const reg = simple_load_reg(inst.op);
+
+            if(reg >= 0 && !inst.alt && inst.arg.lclass() == LOC_ARG && inst.arg.fn() == fn.handle()
+               && !(touched & (1 << reg)) && !(live_regs[i] & REGF_NZ) && !conv.args[reg]
+               && single_use(inst.arg))
+            {
+                dprint(log, "REG_CONV_ARG", inst.arg, reg);
+                conv.args[reg] = inst.arg;
+                inst.prune();
+            }
+
+            touched |= regs;
+        }
+    }
+
+    // Return:
+
+    locator_t ret = {};
+    bool valid_ret = true;
+    for_each_inst([&](asm_inst_t const& inst)
+    {
+        for(locator_t loc : { inst.arg, inst.alt })
+        {
+            if(loc.lclass() != LOC_RETURN || loc.fn() != fn.handle())
+                continue;
+
+            // Every use must be a store:
+            if(ret && ret != loc)
+                valid_ret = false;
+            if(simple_store_reg(inst.op) < 0 || inst.alt || loc != loc.mem_head() || loc.mem_size() != 1)
+                valid_ret = false;
+            ret = loc;
+        }
+    });
+
+    if(!ret || !valid_ret)
+        return conv;
+
+    // Every return must store the value right before:
+    bc::small_vector<std::pair<asm_node_t*, asm_inst_t*>, 4> returns;
+    for(asm_node_t& node : list)
+    {
+        if(!node.outputs().empty())
+            continue;
+
+        if(node.code.empty() || node.code.back().op != RTS_IMPLIED)
+            return conv;
+
+        regs_t written = 0;
+        asm_inst_t* store = nullptr;
+        for(asm_inst_t& inst : node.code | std::views::reverse)
+        {
+            if(inst.arg == ret)
+            {
+                if(!(written & (1 << simple_store_reg(inst.op))))
+                    store = &inst;
+                break;
+            }
+            written |= op_output_regs(inst.op);
+        }
+
+        if(!store)
+            return conv;
+
+        returns.push_back({ &node, store });
+    }
+
+    for(auto const& pair : returns)
+    {
+        auto& code = pair.first->code;
+        op_t transfer = BAD_OP;
+        switch(simple_store_reg(pair.second->op))
+        {
+        case REG_X: transfer = TXA_IMPLIED; break;
+        case REG_Y: transfer = TYA_IMPLIED; break;
+        }
+
+        // The stored instruction is pruned below.
+        code.insert(code.end() - 1, { .op = read_reg_op(REGF_A) });
+        if(transfer)
+            code.insert(code.end() - 2, { .op = transfer });
+    }
+
+    // Remaining stores are dead, as only the register is used:
+    for(asm_node_t& node : list)
+    for(asm_inst_t& inst : node.code)
+        if(inst.arg == ret)
+            inst.prune();
+
+    dprint(log, "REG_CONV_RET", ret);
+    conv.ret = ret;
+
+    return conv;
+}
+
+void asm_graph_t::apply_reg_conv(unsigned& num_calls, unsigned& num_reg_conv_calls)
+{
+    for(asm_node_t& node : list)
+    {
+        auto& code = node.code;
+        for(unsigned i = 0; i < code.size(); ++i)
+        {
+            asm_inst_t const inst = code[i];
+
+            if(inst.op != JSR_ABSOLUTE && inst.op != JMP_ABSOLUTE)
+                continue;
+            if(inst.arg.lclass() != LOC_FN || inst.arg != locator_t::fn(inst.arg.fn()))
+                continue;
+
+            fn_t const& call = *inst.arg.fn();
+            if(call.fclass != FN_FN)
+                continue;
+
+            ++num_calls;
+
+            // 'build_order' compiles callees before their callers:
+            passert(call.global.compiled(), call.global.name);
+            reg_conv_t const& conv = call.reg_conv();
+            if(!conv)
+                continue;
+
+            ++num_reg_conv_calls;
+
+            // Load the arguments right before the call.
+            // 'optimize_live_registers' will forward them from their stores.
+            bc::static_vector<asm_inst_t, 4> loads;
+            if(conv.args[REG_A])
+                loads.push_back({ .op = LDA_ABSOLUTE, .arg = conv.args[REG_A] });
+            if(conv.args[REG_X])
+                loads.push_back({ .op = LDX_ABSOLUTE, .arg = conv.args[REG_X] });
+            if(conv.args[REG_Y])
+                loads.push_back({ .op = LDY_ABSOLUTE, .arg = conv.args[REG_Y] });
+            if(regs_t const regs = conv.arg_regs())
+                loads.push_back({ .op = read_reg_op(regs) });
+
+            code.insert(code.begin() + i, loads.begin(), loads.end());
+            i += loads.size();
+            assert(code[i] == inst);
+
+            // Store the return right after the call:
+            if(conv.ret && inst.op == JSR_ABSOLUTE)
+            {
+                while(i + 1 < code.size() && !op_normal(code[i + 1].op))
+                    ++i;
+                code.insert(code.begin() + i + 1, { .op = STA_ABSOLUTE, .arg = conv.ret });
+                ++i;
+            }
+        }
+    }
+}
+
+bool asm_graph_t::o_reg_conv_stores()
+{
+    // Finds the arguments and returns of called fns that are passed in registers:
+    rh::batman_set<locator_t> locs;
+    rh::batman_set<locator_t> read;
+    for_each_inst([&](asm_inst_t const& inst)
+    {
+        if((inst.op == JSR_ABSOLUTE || inst.op == JMP_ABSOLUTE) && inst.arg.lclass() == LOC_FN)
+        {
+            fn_t const& call = *inst.arg.fn();
+            if(call.fclass == FN_FN)
+                call.reg_conv().for_each_locator([&](locator_t loc){ locs.insert(loc); });
+        }
+    });
+
+    if(locs.empty())
+        return false;
+
+    // Track which are read:
+    for_each_inst([&](asm_inst_t const& inst)
+    {
+        for(locator_t loc : { inst.arg, inst.alt })
+        {
+            if(!loc || !is_var_like(loc.lclass()))
+                continue;
+            if(locs.count(loc.mem_head()) && (simple_store_reg(inst.op) < 0 || inst.alt || loc != loc.mem_head()))
+                read.insert(loc.mem_head());
+        }
+    });
+
+    // Stores that aren't read are dead, as the callee uses registers:
+    bool changed = false;
+    for(asm_node_t& node : list)
+    for(asm_inst_t& inst : node.code)
+    {
+        if(simple_store_reg(inst.op) < 0)
+            continue;
+        if(locs.count(inst.arg) && !read.count(inst.arg))
+        {
+            dprint(log, "REG_CONV_PRUNE_STORE", inst.arg);
+            inst.prune();
+            changed = true;
+        }
+    }
+
+    return changed;
+}
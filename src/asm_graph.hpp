@@ -21,6 +21,7 @@
 struct asm_inst_t;
 class locator_t;
 class fn_t;
+struct reg_conv_t;
 class lvars_manager_t;
 
 struct asm_node_t;
@@ -122,6 +123,11 @@ public:
     void optimize_live_registers();
     lvars_manager_t build_lvars(fn_t const& fn);
 
+    // Passes arguments and returns in registers ('reg_conv_t'):
+    reg_conv_t build_reg_conv(fn_t const& fn);
+    void apply_reg_conv(unsigned& num_calls, unsigned& num_reg_conv_calls);
+    bool o_reg_conv_stores();
+
     template<typename Fn>
     void for_each_inst(Fn const& fn) const
     {
@@ -1,790 +1,98 @@
 #include "asm_lex_tables.hpp"
 namespace asm_lex
 {
-extern unsigned const lexer_ec_table[256] = {
-    0, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
-    266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
-    266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
-    266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
-    266, 532, 798, 1064, 1330, 1596, 266, 1862, 2128, 2394, 2660, 2926, 3192, 3458, 3724, 3990,
-    4256, 4522, 4788, 5054, 5320, 266, 5586, 266, 5852, 6118, 266, 266, 266, 266, 266, 266,
-    266, 6384, 6650, 6916, 7182, 7448, 266, 7714, 7980, 8246, 8512, 8778, 9044, 9310, 9576, 9842,
-    10108, 10374, 10640, 10906, 11172, 266, 11438, 266, 11704, 11970, 266, 266, 266, 266, 266, 266,
-    266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
-    266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
-    266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
-    266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
-    266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
-    266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
-    266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
-    266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266,
+// 266 states, 46 character classes, 295 comb entries (12236 dense)
+extern std::uint8_t const lexer_ec_table[256] = {
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 3, 4, 5, 6, 1, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 1, 21, 1, 22, 23, 1, 1, 1, 1, 1, 1,
+    1, 24, 25, 26, 27, 28, 1, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 1, 43, 1, 44, 45, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
 };
-extern token_type_t const lexer_transition_table[12236] = {
-
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 41, 67, 0, 62, 44,
-    0, 0, 7, 10, 0, 0, 0, 0, 69, 0, 0, 0, 0, 8, 21, 22,
-    23, 0, 0, 0, 32, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 12, 13, 11, 14, 15, 0, 0, 0, 0, 9, 40, 42, 43,
-    68, 6, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70,
-    0, 0, 0, 0, 0, 66, 25, 26, 0, 0, 0, 0, 0, 71, 0, 29,
-    0, 0, 0, 0, 34, 45, 46, 47, 0, 0, 0, 0, 56, 54, 55, 53,
-    51, 52, 30, 31, 0, 35, 65, 38, 39, 36, 37, 0, 24, 0, 0, 28,
-    0, 0, 0, 33, 3, 61, 59, 2, 60, 1, 0, 0, 0, 0, 0, 0,
-    58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49,
-    50, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 27, 64, 0, 16, 17,
-    19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 63, 41, 67, 0, 62, 44, 0, 0, 7, 10, 0, 0,
-    0, 0, 69, 0, 0, 0, 0, 8, 21, 22, 23, 0, 0, 0, 32, 57,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 13, 11,
-    14, 15, 0, 0, 0, 0, 9, 40, 42, 43, 68, 6, 4, 5, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 66,
-    25, 26, 0, 0, 0, 0, 0, 71, 0, 29, 0, 0, 0, 0, 34, 45,
-    46, 47, 0, 0, 0, 0, 56, 54, 55, 53, 51, 52, 30, 31, 0, 35,
-    65, 38, 39, 36, 37, 0, 24, 0, 0, 28, 0, 0, 0, 33, 3, 61,
-    59, 2, 60, 1, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 50, 0, 0, 0, 0, 18,
-    0, 0, 0, 0, 0, 27, 64, 0, 16, 17, 19, 20, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 41,
-    67, 0, 62, 44, 0, 0, 7, 10, 0, 0, 0, 0, 69, 0, 178, 0,
-    0, 8, 21, 22, 23, 0, 0, 0, 32, 57, 76, 0, 128, 0, 0, 0,
-    0, 0, 0, 0, 0, 215, 0, 12, 13, 11, 14, 15, 0, 0, 0, 0,
-    9, 40, 42, 43, 68, 6, 4, 5, 0, 0, 0, 0, 0, 242, 0, 0,
-    0, 0, 0, 70, 0, 0, 0, 0, 0, 66, 25, 26, 0, 0, 0, 0,
-    0, 71, 0, 29, 0, 0, 0, 0, 34, 45, 46, 47, 0, 0, 0, 0,
-    56, 54, 55, 53, 51, 52, 30, 31, 181, 35, 65, 38, 39, 36, 37, 0,
-    24, 0, 0, 28, 0, 0, 0, 33, 3, 61, 59, 2, 60, 1, 0, 0,
-    0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 222, 48, 49, 50, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 27,
-    64, 0, 16, 17, 19, 20, 0, 0, 173, 172, 185, 183, 0, 0, 89, 0,
-    0, 0, 0, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 63, 41, 67, 0, 62, 44, 0, 0,
-    7, 10, 0, 0, 0, 0, 69, 0, 0, 0, 0, 8, 21, 22, 23, 0,
-    0, 0, 32, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 216,
-    0, 12, 13, 11, 14, 15, 0, 0, 0, 0, 9, 40, 42, 43, 68, 6,
-    4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0,
-    0, 0, 0, 66, 25, 26, 0, 0, 0, 0, 0, 71, 0, 29, 0, 0,
-    0, 0, 34, 45, 46, 47, 0, 0, 0, 0, 56, 54, 55, 53, 51, 52,
-    30, 31, 0, 35, 65, 38, 39, 36, 37, 0, 24, 0, 0, 28, 0, 0,
-    0, 33, 3, 61, 59, 2, 60, 1, 0, 0, 0, 0, 0, 0, 58, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 48, 49, 50, 0,
-    0, 0, 0, 18, 0, 0, 0, 0, 0, 27, 64, 0, 16, 17, 19, 20,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 263, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    227, 0, 63, 41, 67, 0, 62, 44, 0, 0, 7, 10, 0, 0, 0, 0,
-    69, 0, 0, 0, 0, 8, 21, 22, 23, 0, 130, 0, 32, 57, 0, 0,
-    0, 0, 0, 0, 0, 0, 115, 0, 0, 0, 0, 12, 13, 11, 14, 15,
-    0, 0, 0, 0, 9, 40, 42, 43, 68, 6, 4, 5, 0, 0, 0, 0,
-    0, 0, 0, 0, 118, 0, 0, 70, 0, 0, 0, 0, 0, 66, 25, 26,
-    0, 0, 0, 0, 0, 71, 0, 29, 0, 0, 0, 0, 34, 45, 46, 47,
-    0, 0, 0, 0, 56, 54, 55, 53, 51, 52, 30, 31, 0, 35, 65, 38,
-    39, 36, 37, 0, 24, 0, 0, 28, 0, 0, 0, 33, 3, 61, 59, 2,
-    60, 1, 201, 0, 198, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0,
-    79, 165, 0, 0, 0, 0, 48, 49, 50, 0, 0, 0, 94, 18, 0, 0,
-    0, 150, 149, 27, 64, 0, 16, 17, 19, 20, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 248, 0, 0, 0, 0, 0, 0, 0, 98,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 41, 67, 0,
-    62, 44, 0, 0, 7, 10, 0, 0, 0, 0, 69, 0, 0, 0, 0, 8,
-    21, 22, 23, 0, 0, 0, 32, 57, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 12, 13, 11, 14, 15, 0, 0, 0, 0, 9, 40,
-    42, 43, 68, 6, 4, 5, 0, 0, 0, 0, 202, 0, 0, 0, 119, 0,
-    0, 70, 0, 0, 0, 0, 0, 66, 25, 26, 0, 0, 0, 0, 0, 71,
-    0, 29, 0, 0, 0, 0, 34, 45, 46, 47, 0, 0, 0, 0, 56, 54,
-    55, 53, 51, 52, 30, 31, 0, 35, 65, 38, 39, 36, 37, 0, 24, 0,
-    0, 28, 0, 0, 0, 33, 3, 61, 59, 2, 60, 1, 0, 0, 199, 0,
-    0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 166, 0, 0, 0, 0,
-    48, 49, 50, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 27, 64, 0,
-    16, 17, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 90, 0, 0, 0,
-    0, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 228, 0, 63, 41, 67, 0, 62, 44, 0, 0, 7, 10,
-    0, 0, 0, 0, 69, 0, 0, 0, 0, 8, 21, 22, 23, 0, 0, 0,
-    32, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 217, 0, 12,
-    13, 11, 14, 15, 0, 0, 0, 0, 9, 40, 42, 43, 68, 6, 4, 5,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0,
-    0, 66, 25, 26, 0, 0, 0, 0, 0, 71, 0, 29, 0, 0, 124, 0,
-    34, 45, 46, 47, 0, 0, 0, 0, 56, 54, 55, 53, 51, 52, 30, 31,
-    0, 35, 65, 38, 39, 36, 37, 0, 24, 0, 0, 28, 0, 0, 0, 33,
-    3, 61, 59, 2, 60, 1, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 143, 0, 48, 49, 50, 0, 0, 0,
-    0, 18, 0, 0, 0, 0, 0, 27, 64, 0, 16, 17, 19, 20, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0,
-    0, 0, 0, 99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    63, 41, 67, 0, 62, 44, 0, 0, 7, 10, 0, 0, 0, 0, 69, 0,
-    0, 0, 0, 8, 21, 22, 23, 0, 0, 0, 32, 57, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 13, 11, 14, 15, 0, 0,
-    0, 232, 9, 40, 42, 43, 68, 6, 4, 5, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 66, 25, 26, 0, 0,
-    0, 0, 0, 71, 0, 29, 0, 0, 0, 0, 34, 45, 46, 47, 0, 0,
-    0, 0, 56, 54, 55, 53, 51, 52, 30, 31, 0, 35, 65, 38, 39, 36,
-    37, 0, 24, 0, 0, 28, 0, 0, 0, 33, 3, 61, 59, 2, 60, 1,
-    0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 48, 49, 50, 0, 0, 0, 0, 18, 0, 0, 0, 0,
-    0, 27, 64, 0, 16, 17, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 41, 67, 0, 62, 44,
-    0, 0, 7, 10, 0, 0, 0, 0, 69, 0, 0, 0, 0, 8, 21, 22,
-    23, 0, 0, 0, 32, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 12, 13, 11, 14, 15, 0, 0, 0, 0, 9, 40, 42, 43,
-    68, 6, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70,
-    246, 0, 0, 0, 0, 66, 25, 26, 0, 0, 0, 0, 0, 71, 0, 29,
-    0, 0, 0, 0, 34, 45, 46, 47, 0, 0, 0, 0, 56, 54, 55, 53,
-    51, 52, 30, 31, 0, 35, 65, 38, 39, 36, 37, 0, 24, 0, 0, 28,
-    0, 0, 0, 33, 3, 61, 59, 2, 60, 1, 0, 0, 0, 0, 0, 0,
-    58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49,
-    50, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 27, 64, 0, 16, 17,
-    19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 63, 41, 67, 0, 62, 44, 0, 0, 7, 10, 0, 0,
-    0, 0, 69, 0, 0, 0, 0, 8, 21, 22, 23, 0, 0, 0, 32, 57,
-    0, 0, 0, 126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 13, 11,
-    14, 15, 0, 0, 0, 0, 9, 40, 42, 43, 68, 6, 4, 5, 0, 0,
-    0, 0, 0, 0, 0, 0, 238, 0, 0, 70, 0, 0, 0, 0, 0, 66,
-    25, 26, 0, 0, 0, 0, 0, 71, 0, 29, 0, 0, 0, 0, 34, 45,
-    46, 47, 0, 0, 0, 0, 56, 54, 55, 53, 51, 52, 30, 31, 0, 35,
-    65, 38, 39, 36, 37, 0, 24, 0, 0, 28, 0, 0, 0, 33, 3, 61,
-    59, 2, 60, 1, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0,
-    0, 0, 0, 167, 0, 0, 0, 0, 48, 49, 50, 0, 93, 0, 0, 18,
-    0, 0, 0, 0, 0, 27, 64, 0, 16, 17, 19, 20, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 123, 0, 0, 0, 0, 0, 0,
-    0, 225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 41,
-    67, 0, 62, 44, 0, 0, 7, 10, 0, 0, 0, 0, 69, 0, 0, 0,
-    0, 8, 21, 22, 23, 0, 0, 0, 32, 57, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 12, 13, 11, 14, 15, 0, 0, 0, 0,
-    9, 40, 42, 43, 68, 6, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 70, 0, 0, 0, 0, 0, 66, 25, 26, 0, 0, 0, 0,
-    0, 71, 0, 29, 0, 0, 0, 0, 34, 45, 46, 47, 0, 0, 0, 0,
-    56, 54, 55, 53, 51, 52, 30, 31, 0, 35, 65, 38, 39, 36, 37, 0,
-    24, 0, 0, 28, 0, 0, 0, 33, 3, 61, 59, 2, 60, 1, 0, 0,
-    0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 48, 49, 50, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 27,
-    64, 0, 16, 17, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 63, 41, 67, 0, 62, 44, 0, 0,
-    7, 10, 0, 0, 0, 0, 69, 0, 0, 0, 0, 8, 21, 22, 23, 0,
-    0, 0, 32, 57, 0, 0, 0, 0, 0, 0, 0, 117, 0, 0, 0, 218,
-    0, 12, 13, 11, 14, 15, 0, 0, 0, 0, 9, 40, 42, 43, 68, 6,
-    4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0,
-    0, 0, 0, 66, 25, 26, 0, 0, 0, 0, 0, 71, 0, 29, 0, 0,
-    0, 0, 34, 45, 46, 47, 0, 0, 0, 0, 56, 54, 55, 53, 51, 52,
-    30, 31, 0, 35, 65, 38, 39, 36, 37, 0, 24, 0, 0, 28, 0, 0,
-    0, 33, 3, 61, 59, 2, 60, 1, 0, 0, 0, 0, 0, 0, 58, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 50, 0,
-    0, 0, 0, 18, 0, 0, 0, 0, 0, 27, 64, 0, 16, 17, 19, 20,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 63, 41, 67, 0, 62, 44, 0, 0, 7, 10, 0, 0, 0, 0,
-    69, 0, 0, 0, 0, 8, 21, 22, 23, 0, 0, 0, 32, 57, 0, 125,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 219, 0, 12, 13, 11, 14, 15,
-    0, 0, 0, 0, 9, 40, 42, 43, 68, 6, 4, 5, 0, 0, 0, 0,
-    203, 0, 0, 0, 0, 0, 0, 70, 247, 102, 0, 0, 0, 66, 25, 26,
-    0, 0, 0, 0, 0, 71, 0, 29, 0, 0, 0, 83, 34, 45, 46, 47,
-    0, 0, 0, 0, 56, 54, 55, 53, 51, 52, 30, 31, 0, 35, 65, 38,
-    39, 36, 37, 0, 24, 0, 0, 28, 0, 0, 0, 33, 3, 61, 59, 2,
-    60, 1, 0, 0, 0, 0, 196, 0, 58, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 48, 49, 50, 0, 0, 0, 0, 18, 0, 0,
-    0, 0, 0, 27, 64, 0, 16, 17, 19, 20, 0, 0, 0, 0, 0, 0,
-    140, 0, 0, 0, 0, 0, 0, 250, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 41, 67, 0,
-    62, 44, 189, 0, 7, 10, 0, 0, 0, 0, 69, 0, 0, 0, 0, 8,
-    21, 22, 23, 0, 0, 0, 32, 57, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 12, 13, 11, 14, 15, 0, 0, 0, 0, 9, 40,
-    42, 43, 68, 6, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 70, 0, 0, 0, 0, 0, 66, 25, 26, 0, 0, 0, 0, 0, 71,
-    0, 29, 0, 0, 0, 0, 34, 45, 46, 47, 0, 0, 0, 0, 56, 54,
-    55, 53, 51, 52, 30, 31, 0, 35, 65, 38, 39, 36, 37, 0, 24, 0,
-    0, 28, 0, 0, 0, 33, 3, 61, 59, 2, 60, 1, 0, 0, 0, 0,
-    0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    48, 49, 50, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 27, 64, 0,
-    16, 17, 19, 20, 0, 0, 0, 0, 0, 0, 134, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 226, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 63, 41, 67, 0, 62, 44, 0, 0, 7, 10,
-    0, 0, 0, 0, 69, 0, 0, 0, 0, 8, 21, 22, 23, 0, 0, 0,
-    32, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12,
-    13, 11, 14, 15, 0, 0, 0, 233, 9, 40, 42, 43, 68, 6, 4, 5,
-    0, 0, 0, 0, 204, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0,
-    0, 66, 25, 26, 0, 0, 0, 0, 0, 71, 0, 29, 0, 0, 0, 0,
-    34, 45, 46, 47, 0, 0, 0, 0, 56, 54, 55, 53, 51, 52, 30, 31,
-    0, 35, 65, 38, 39, 36, 37, 0, 24, 0, 0, 28, 0, 0, 0, 33,
-    3, 61, 59, 2, 60, 1, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 50, 0, 0, 0,
-    0, 18, 0, 0, 236, 0, 0, 27, 64, 0, 16, 17, 19, 20, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 122, 0, 0, 0, 0,
-    0, 0, 0, 162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    63, 41, 67, 0, 62, 44, 0, 187, 7, 10, 0, 0, 0, 0, 69, 0,
-    0, 0, 0, 8, 21, 22, 23, 0, 0, 0, 32, 57, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 13, 11, 14, 15, 0, 0,
-    237, 0, 9, 40, 42, 43, 68, 6, 4, 5, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 70, 0, 103, 0, 0, 0, 66, 25, 26, 0, 0,
-    0, 0, 0, 71, 0, 29, 0, 0, 0, 0, 34, 45, 46, 47, 0, 0,
-    0, 0, 56, 54, 55, 53, 51, 52, 30, 31, 0, 35, 65, 38, 39, 36,
-    37, 0, 24, 0, 0, 28, 0, 0, 0, 33, 3, 61, 59, 2, 60, 1,
-    0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 88, 0, 0, 48, 49, 50, 0, 0, 0, 0, 18, 0, 0, 0, 0,
-    0, 27, 64, 0, 16, 17, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 41, 67, 0, 62, 44,
-    0, 0, 7, 10, 0, 0, 0, 0, 69, 0, 0, 0, 0, 8, 21, 22,
-    23, 0, 0, 0, 32, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 12, 13, 11, 14, 15, 0, 0, 0, 0, 9, 40, 42, 43,
-    68, 6, 4, 5, 0, 0, 229, 0, 0, 0, 0, 0, 0, 0, 0, 70,
-    0, 0, 0, 0, 0, 66, 25, 26, 0, 0, 0, 0, 0, 71, 0, 29,
-    0, 0, 0, 0, 34, 45, 46, 47, 0, 0, 0, 0, 56, 54, 55, 53,
-    51, 52, 30, 31, 0, 35, 65, 38, 39, 36, 37, 0, 24, 191, 0, 28,
-    0, 0, 0, 33, 3, 61, 59, 2, 60, 1, 0, 0, 0, 0, 0, 0,
-    58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49,
-    50, 0, 0, 182, 0, 18, 0, 0, 0, 0, 0, 27, 64, 164, 16, 17,
-    19, 20, 0, 0, 0, 0, 186, 184, 135, 0, 0, 0, 0, 0, 0, 144,
-    0, 0, 0, 0, 0, 0, 0, 163, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 63, 41, 67, 0, 62, 44, 0, 0, 7, 10, 0, 0,
-    0, 0, 69, 0, 0, 0, 0, 8, 21, 22, 23, 0, 0, 129, 32, 57,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 13, 11,
-    14, 15, 0, 0, 0, 0, 9, 40, 42, 43, 68, 6, 4, 5, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 66,
-    25, 26, 0, 0, 0, 0, 0, 71, 0, 29, 0, 0, 0, 0, 34, 45,
-    46, 47, 0, 0, 0, 0, 56, 54, 55, 53, 51, 52, 30, 31, 0, 35,
-    65, 38, 39, 36, 37, 0, 24, 0, 0, 28, 0, 0, 0, 33, 3, 61,
-    59, 2, 60, 1, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 50, 0, 0, 0, 0, 18,
-    0, 0, 0, 0, 0, 27, 64, 0, 16, 17, 19, 20, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 41,
-    67, 0, 62, 44, 0, 0, 7, 10, 0, 0, 0, 180, 69, 0, 0, 0,
-    0, 8, 21, 22, 23, 0, 0, 0, 32, 57, 0, 75, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 220, 0, 12, 13, 11, 14, 15, 195, 0, 0, 0,
-    9, 40, 42, 43, 68, 6, 4, 5, 0, 0, 0, 0, 205, 0, 0, 0,
-    0, 0, 0, 70, 0, 104, 0, 0, 0, 66, 25, 26, 0, 0, 0, 0,
-    0, 71, 0, 29, 0, 0, 0, 0, 34, 45, 46, 47, 0, 0, 0, 0,
-    56, 54, 55, 53, 51, 52, 30, 31, 0, 35, 65, 38, 39, 36, 37, 188,
-    24, 0, 159, 28, 0, 0, 0, 33, 3, 61, 59, 2, 60, 1, 0, 200,
-    0, 197, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 48, 49, 50, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 27,
-    64, 0, 16, 17, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 145, 0, 0, 0, 0, 0, 0, 0, 109, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 63, 41, 67, 0, 62, 44, 190, 0,
-    7, 10, 0, 0, 0, 0, 69, 0, 0, 0, 0, 8, 21, 22, 23, 0,
-    131, 0, 32, 57, 0, 0, 0, 127, 0, 0, 0, 0, 116, 0, 0, 0,
-    0, 12, 13, 11, 14, 15, 0, 0, 0, 234, 9, 40, 42, 43, 68, 6,
-    4, 5, 0, 0, 0, 0, 206, 243, 0, 0, 0, 0, 0, 70, 0, 0,
-    0, 0, 0, 66, 25, 26, 0, 0, 0, 0, 0, 71, 0, 29, 0, 0,
-    0, 0, 34, 45, 46, 47, 0, 0, 0, 0, 56, 54, 55, 53, 51, 52,
-    30, 31, 0, 35, 65, 38, 39, 36, 37, 0, 24, 0, 0, 28, 0, 0,
-    0, 33, 3, 61, 59, 2, 60, 1, 0, 0, 0, 0, 0, 208, 58, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 50, 0,
-    0, 0, 0, 18, 0, 0, 0, 0, 0, 27, 64, 0, 16, 17, 19, 20,
-    0, 0, 174, 0, 0, 0, 0, 0, 120, 0, 0, 0, 0, 113, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 63, 41, 67, 0, 62, 44, 0, 0, 7, 10, 0, 0, 0, 0,
-    69, 0, 0, 0, 0, 8, 21, 22, 23, 0, 0, 0, 32, 57, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 221, 0, 12, 13, 11, 14, 15,
-    0, 0, 0, 0, 9, 40, 42, 43, 68, 6, 4, 5, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 70, 0, 105, 0, 0, 0, 66, 25, 26,
-    0, 0, 0, 0, 0, 71, 0, 29, 0, 0, 0, 0, 34, 45, 46, 47,
-    0, 0, 0, 0, 56, 54, 55, 53, 51, 52, 30, 31, 0, 35, 65, 38,
-    39, 36, 37, 0, 24, 0, 0, 28, 0, 0, 0, 33, 3, 61, 59, 2,
-    60, 1, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 48, 49, 50, 82, 0, 0, 0, 18, 0, 0,
-    0, 0, 0, 27, 64, 0, 16, 17, 19, 20, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 137, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 41, 67, 0,
-    62, 44, 0, 0, 7, 10, 0, 0, 0, 0, 69, 0, 0, 0, 0, 8,
-    21, 22, 23, 0, 0, 0, 32, 57, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 12, 13, 11, 14, 15, 0, 0, 0, 0, 9, 40,
-    42, 43, 68, 6, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 239, 0,
-    0, 70, 0, 0, 0, 0, 0, 66, 25, 26, 0, 0, 0, 0, 0, 71,
-    0, 29, 0, 0, 0, 0, 34, 45, 46, 47, 0, 0, 0, 0, 56, 54,
-    55, 53, 51, 52, 30, 31, 0, 35, 65, 38, 39, 36, 37, 0, 24, 0,
-    0, 28, 0, 0, 0, 33, 3, 61, 59, 2, 60, 1, 0, 0, 0, 0,
-    0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    48, 49, 50, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 27, 64, 0,
-    16, 17, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 63, 41, 67, 0, 62, 44, 0, 0, 7, 10,
-    0, 0, 0, 0, 69, 101, 179, 0, 0, 8, 21, 22, 23, 0, 0, 0,
-    32, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12,
-    13, 11, 14, 15, 0, 0, 0, 0, 9, 40, 42, 43, 68, 6, 4, 5,
-    0, 0, 0, 240, 207, 244, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0,
-    0, 66, 25, 26, 0, 0, 0, 0, 0, 71, 0, 29, 0, 0, 0, 0,
-    34, 45, 46, 47, 0, 0, 0, 0, 56, 54, 55, 53, 51, 52, 30, 31,
-    0, 35, 65, 38, 39, 36, 37, 0, 24, 0, 0, 28, 0, 0, 0, 33,
-    3, 61, 59, 2, 60, 1, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0,
-    0, 0, 0, 78, 0, 0, 0, 0, 0, 223, 48, 49, 50, 0, 0, 0,
-    95, 18, 0, 0, 0, 151, 0, 27, 64, 0, 16, 17, 19, 20, 176, 175,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    63, 41, 67, 0, 62, 44, 0, 0, 7, 10, 0, 0, 0, 0, 69, 0,
-    100, 0, 0, 8, 21, 22, 23, 0, 0, 0, 32, 57, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 13, 11, 14, 15, 0, 0,
-    0, 0, 9, 40, 42, 43, 68, 6, 4, 5, 0, 0, 0, 241, 0, 245,
-    0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 66, 25, 26, 0, 0,
-    0, 0, 0, 71, 0, 29, 0, 0, 0, 0, 34, 45, 46, 47, 0, 0,
-    0, 0, 56, 54, 55, 53, 51, 52, 30, 31, 0, 35, 65, 38, 39, 36,
-    37, 0, 24, 0, 0, 28, 0, 0, 0, 33, 3, 61, 59, 2, 60, 1,
-    0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 224, 48, 49, 50, 0, 0, 0, 96, 18, 0, 0, 0, 235,
-    0, 27, 64, 0, 16, 17, 19, 20, 177, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 63, 41, 67, 0, 62, 44,
-    0, 0, 7, 10, 185, 183, 0, 0, 69, 0, 0, 168, 0, 8, 21, 22,
-    23, 0, 0, 0, 32, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128,
-    0, 0, 0, 12, 13, 11, 14, 15, 0, 0, 0, 0, 9, 40, 42, 43,
-    68, 6, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70,
-    0, 0, 192, 0, 0, 66, 25, 26, 0, 0, 0, 0, 0, 71, 0, 29,
-    76, 0, 0, 0, 34, 45, 46, 47, 0, 0, 173, 172, 56, 54, 55, 53,
-    51, 52, 30, 31, 0, 35, 65, 38, 39, 36, 37, 0, 24, 0, 0, 28,
-    0, 178, 0, 33, 3, 61, 59, 2, 60, 1, 0, 0, 0, 0, 0, 0,
-    58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49,
-    50, 0, 0, 0, 0, 18, 0, 181, 0, 0, 0, 27, 64, 0, 16, 17,
-    19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 114,
-    0, 0, 0, 0, 0, 0, 0, 0, 262, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 63, 41, 67, 0, 62, 44, 0, 0, 7, 10, 0, 0,
-    0, 0, 69, 0, 0, 0, 0, 8, 21, 22, 23, 0, 0, 0, 32, 57,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 13, 11,
-    14, 15, 0, 0, 0, 0, 9, 40, 42, 43, 68, 6, 4, 5, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 66,
-    25, 26, 0, 0, 0, 0, 0, 71, 0, 29, 0, 0, 0, 0, 34, 45,
-    46, 47, 0, 0, 0, 0, 56, 54, 55, 53, 51, 52, 30, 31, 0, 35,
-    65, 38, 39, 36, 37, 0, 24, 0, 0, 28, 0, 0, 0, 33, 3, 61,
-    59, 2, 60, 1, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 50, 0, 0, 0, 0, 18,
-    0, 0, 0, 0, 0, 27, 64, 0, 16, 17, 19, 20, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 0, 0, 0, 0, 0, 0,
-    0, 0, 261, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 41,
-    67, 0, 62, 44, 0, 0, 7, 10, 0, 0, 0, 0, 69, 0, 0, 0,
-    165, 8, 21, 22, 23, 0, 0, 0, 32, 57, 0, 0, 0, 0, 130, 0,
-    0, 0, 0, 0, 0, 0, 0, 12, 13, 11, 14, 15, 0, 118, 0, 0,
-    9, 40, 42, 43, 68, 6, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 115, 70, 0, 0, 0, 0, 94, 66, 25, 26, 0, 0, 0, 0,
-    0, 71, 0, 29, 0, 0, 0, 0, 34, 45, 46, 47, 0, 0, 0, 0,
-    56, 54, 55, 53, 51, 52, 30, 31, 0, 35, 65, 38, 39, 36, 37, 0,
-    24, 0, 0, 28, 0, 0, 0, 33, 3, 61, 59, 2, 60, 1, 0, 0,
-    0, 0, 0, 0, 58, 201, 0, 198, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 48, 49, 50, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 27,
-    64, 0, 16, 17, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 106, 86, 249, 0, 150, 149, 0, 0, 79, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 63, 41, 67, 0, 62, 44, 0, 0,
-    7, 10, 0, 0, 0, 0, 69, 0, 0, 0, 166, 8, 21, 22, 23, 0,
-    0, 0, 32, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    209, 12, 13, 11, 14, 15, 0, 119, 0, 0, 9, 40, 42, 43, 68, 6,
-    4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0,
-    193, 0, 0, 66, 25, 26, 0, 0, 0, 0, 0, 71, 0, 29, 0, 0,
-    0, 0, 34, 45, 46, 47, 0, 0, 0, 0, 56, 54, 55, 53, 51, 52,
-    30, 31, 0, 35, 65, 38, 39, 36, 37, 0, 24, 0, 0, 28, 0, 0,
-    0, 33, 3, 61, 59, 2, 60, 1, 0, 0, 0, 0, 0, 0, 58, 0,
-    0, 199, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 50, 0,
-    0, 0, 0, 18, 0, 0, 0, 0, 0, 27, 64, 0, 16, 17, 19, 20,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 63, 41, 67, 0, 62, 44, 0, 0, 7, 10, 0, 0, 0, 0,
-    69, 0, 0, 0, 0, 8, 21, 22, 23, 0, 0, 0, 32, 57, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 13, 11, 14, 15,
-    0, 0, 0, 0, 9, 40, 42, 43, 68, 6, 4, 5, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 66, 25, 26,
-    0, 124, 0, 0, 0, 71, 0, 29, 0, 0, 0, 0, 34, 45, 46, 47,
-    0, 0, 0, 0, 56, 54, 55, 53, 51, 52, 30, 31, 0, 35, 65, 38,
-    39, 36, 37, 0, 24, 0, 0, 28, 0, 0, 0, 33, 3, 61, 59, 2,
-    60, 1, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 48, 49, 50, 0, 0, 0, 0, 18, 0, 0,
-    0, 0, 0, 27, 64, 0, 16, 17, 19, 20, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 143, 107, 148, 133, 0, 0, 0, 0, 0, 0, 0, 0,
-    92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 41, 67, 0,
-    62, 44, 0, 0, 7, 10, 0, 0, 0, 0, 69, 0, 0, 0, 0, 8,
-    21, 22, 23, 0, 0, 0, 32, 57, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 12, 13, 11, 14, 15, 0, 0, 0, 0, 9, 40,
-    42, 43, 68, 6, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 70, 0, 0, 0, 0, 0, 66, 25, 26, 0, 0, 0, 256, 0, 71,
-    0, 29, 0, 0, 0, 0, 34, 45, 46, 47, 0, 0, 0, 0, 56, 54,
-    55, 53, 51, 52, 30, 31, 0, 35, 65, 38, 39, 36, 37, 0, 24, 0,
-    0, 28, 0, 0, 0, 33, 3, 61, 59, 2, 60, 1, 0, 0, 0, 0,
-    0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    48, 49, 50, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 27, 64, 0,
-    16, 17, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 63, 41, 67, 0, 62, 44, 0, 0, 7, 10,
-    0, 0, 0, 0, 69, 0, 0, 0, 0, 8, 21, 22, 23, 0, 0, 0,
-    32, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12,
-    13, 11, 14, 15, 0, 0, 0, 0, 9, 40, 42, 43, 68, 6, 4, 5,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0,
-    0, 66, 25, 26, 0, 0, 0, 0, 0, 71, 0, 29, 0, 0, 0, 0,
-    34, 45, 46, 47, 0, 0, 0, 0, 56, 54, 55, 53, 51, 52, 30, 31,
-    0, 35, 65, 38, 39, 36, 37, 0, 24, 0, 0, 28, 0, 0, 0, 33,
-    3, 61, 59, 2, 60, 1, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 50, 0, 0, 0,
-    0, 18, 0, 0, 0, 0, 0, 27, 64, 0, 16, 17, 19, 20, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    63, 41, 67, 0, 62, 44, 0, 0, 7, 10, 0, 0, 0, 0, 69, 0,
-    0, 0, 167, 8, 21, 22, 23, 0, 0, 0, 32, 57, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 126, 0, 0, 12, 13, 11, 14, 15, 0, 238,
-    0, 0, 9, 40, 42, 43, 68, 6, 4, 5, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 66, 25, 26, 93, 0,
-    0, 0, 0, 71, 0, 29, 0, 0, 0, 0, 34, 45, 46, 47, 0, 0,
-    0, 0, 56, 54, 55, 53, 51, 52, 30, 31, 0, 35, 65, 38, 39, 36,
-    37, 0, 24, 0, 0, 28, 0, 0, 0, 33, 3, 61, 59, 2, 60, 1,
-    0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 48, 49, 50, 0, 0, 0, 0, 18, 0, 0, 0, 0,
-    0, 27, 64, 0, 16, 17, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 108, 0, 155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 41, 67, 0, 62, 44,
-    0, 0, 7, 10, 0, 0, 0, 0, 69, 0, 0, 0, 0, 8, 21, 22,
-    23, 0, 0, 0, 32, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 12, 13, 11, 14, 15, 0, 0, 0, 0, 9, 40, 42, 43,
-    68, 6, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70,
-    0, 0, 0, 0, 0, 66, 25, 26, 0, 0, 0, 0, 0, 71, 0, 29,
-    0, 0, 0, 0, 34, 45, 46, 47, 0, 0, 0, 0, 56, 54, 55, 53,
-    51, 52, 30, 31, 0, 35, 65, 38, 39, 36, 37, 0, 24, 0, 0, 28,
-    0, 0, 0, 33, 3, 61, 59, 2, 60, 1, 0, 0, 0, 0, 0, 0,
-    58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49,
-    50, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 27, 64, 0, 16, 17,
-    19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 156,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 63, 41, 67, 0, 62, 44, 0, 0, 7, 10, 0, 0,
-    0, 0, 69, 0, 0, 0, 0, 8, 21, 22, 23, 0, 0, 0, 32, 57,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 13, 11,
-    14, 15, 0, 0, 0, 0, 9, 40, 42, 43, 68, 6, 4, 5, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 117, 0, 70, 0, 0, 0, 0, 0, 66,
-    25, 26, 0, 0, 0, 0, 0, 71, 0, 29, 0, 0, 0, 0, 34, 45,
-    46, 47, 0, 0, 0, 0, 56, 54, 55, 53, 51, 52, 30, 31, 0, 35,
-    65, 38, 39, 36, 37, 0, 24, 0, 0, 28, 0, 0, 0, 33, 3, 61,
-    59, 2, 60, 1, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 50, 0, 0, 0, 0, 18,
-    0, 0, 0, 0, 0, 27, 64, 0, 16, 17, 19, 20, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 265, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 41,
-    67, 0, 62, 44, 0, 0, 7, 10, 0, 0, 0, 0, 69, 0, 0, 0,
-    0, 8, 21, 22, 23, 0, 0, 0, 32, 57, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 210, 12, 13, 11, 14, 15, 0, 0, 0, 0,
-    9, 40, 42, 43, 68, 6, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 70, 0, 0, 0, 0, 0, 66, 25, 26, 0, 0, 83, 0,
-    0, 71, 0, 29, 0, 125, 0, 0, 34, 45, 46, 47, 0, 0, 0, 0,
-    56, 54, 55, 53, 51, 52, 30, 31, 0, 35, 65, 38, 39, 36, 37, 0,
-    24, 0, 0, 28, 0, 0, 0, 33, 3, 61, 59, 2, 60, 1, 0, 0,
-    0, 0, 0, 0, 58, 0, 0, 0, 0, 196, 0, 0, 0, 0, 0, 0,
-    0, 0, 48, 49, 50, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 27,
-    64, 0, 16, 17, 19, 20, 0, 0, 0, 0, 0, 0, 0, 121, 0, 0,
-    0, 0, 0, 146, 0, 0, 0, 85, 160, 0, 0, 0, 251, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 63, 41, 67, 0, 62, 44, 0, 0,
-    7, 10, 0, 0, 0, 0, 69, 0, 0, 0, 0, 8, 21, 22, 23, 0,
-    0, 0, 32, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 12, 13, 11, 14, 15, 0, 0, 0, 0, 9, 40, 42, 43, 68, 6,
-    4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0,
-    0, 0, 0, 66, 25, 26, 0, 0, 0, 0, 77, 71, 0, 29, 0, 0,
-    0, 0, 34, 45, 46, 47, 0, 0, 0, 0, 56, 54, 55, 53, 51, 52,
-    30, 31, 0, 35, 65, 38, 39, 36, 37, 0, 24, 0, 0, 28, 0, 0,
-    0, 33, 3, 61, 59, 2, 60, 1, 0, 0, 0, 0, 0, 0, 58, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 50, 0,
-    0, 0, 0, 18, 0, 0, 0, 0, 0, 27, 64, 0, 16, 17, 19, 20,
-    0, 0, 0, 0, 0, 0, 0, 138, 0, 0, 0, 152, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 63, 41, 67, 0, 62, 44, 0, 0, 7, 10, 0, 0, 0, 0,
-    69, 0, 0, 0, 0, 8, 21, 22, 23, 0, 0, 0, 32, 57, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 211, 12, 13, 11, 14, 15,
-    0, 0, 0, 0, 9, 40, 42, 43, 68, 6, 4, 5, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 66, 25, 26,
-    0, 0, 0, 257, 0, 71, 0, 29, 0, 0, 0, 0, 34, 45, 46, 47,
-    0, 0, 0, 0, 56, 54, 55, 53, 51, 52, 30, 31, 0, 35, 65, 38,
-    39, 36, 37, 0, 24, 0, 0, 28, 0, 0, 0, 33, 3, 61, 59, 2,
-    60, 1, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 48, 49, 50, 0, 0, 0, 0, 18, 0, 0,
-    0, 0, 0, 27, 64, 0, 16, 17, 19, 20, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 153, 0, 147, 236, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 41, 67, 0,
-    62, 44, 0, 0, 7, 10, 0, 0, 0, 0, 69, 0, 0, 0, 0, 8,
-    21, 22, 23, 0, 0, 0, 32, 57, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 12, 13, 11, 14, 15, 0, 0, 0, 0, 9, 40,
-    42, 43, 68, 6, 4, 5, 0, 230, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 70, 0, 0, 0, 97, 0, 66, 25, 26, 0, 0, 0, 0, 0, 71,
-    0, 29, 0, 0, 0, 0, 34, 45, 46, 47, 0, 0, 0, 0, 56, 54,
-    55, 53, 51, 52, 30, 31, 0, 35, 65, 38, 39, 36, 37, 0, 24, 0,
-    0, 28, 0, 0, 0, 33, 3, 61, 59, 2, 60, 1, 0, 0, 0, 0,
-    0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    48, 49, 50, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 27, 64, 0,
-    16, 17, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88, 0, 0,
-    0, 132, 0, 0, 0, 0, 161, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 63, 41, 67, 191, 62, 44, 0, 0, 7, 10,
-    186, 184, 182, 0, 69, 0, 0, 0, 0, 8, 21, 22, 23, 164, 0, 0,
-    32, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12,
-    13, 11, 14, 15, 0, 0, 0, 0, 9, 40, 42, 43, 68, 6, 4, 5,
-    0, 0, 0, 0, 0, 0, 229, 0, 0, 0, 0, 70, 0, 0, 0, 0,
-    0, 66, 25, 26, 0, 0, 0, 0, 0, 71, 0, 29, 0, 0, 0, 0,
-    34, 45, 46, 47, 0, 0, 0, 0, 56, 54, 55, 53, 51, 52, 30, 31,
-    0, 35, 65, 38, 39, 36, 37, 0, 24, 0, 0, 28, 0, 0, 0, 33,
-    3, 61, 59, 2, 60, 1, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 50, 0, 0, 0,
-    0, 18, 0, 0, 0, 0, 0, 27, 64, 0, 16, 17, 19, 20, 0, 0,
-    0, 0, 0, 0, 0, 139, 0, 0, 0, 154, 0, 259, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    63, 41, 67, 0, 62, 44, 0, 0, 7, 10, 0, 0, 0, 0, 69, 0,
-    0, 0, 0, 8, 21, 22, 23, 0, 0, 0, 32, 57, 0, 0, 0, 0,
-    0, 129, 0, 0, 0, 0, 0, 0, 0, 12, 13, 11, 14, 15, 0, 0,
-    0, 0, 9, 40, 42, 43, 68, 6, 4, 5, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 66, 25, 26, 0, 0,
-    0, 0, 0, 71, 0, 29, 0, 0, 0, 0, 34, 45, 46, 47, 0, 0,
-    0, 0, 56, 54, 55, 53, 51, 52, 30, 31, 0, 35, 65, 38, 39, 36,
-    37, 0, 24, 0, 0, 28, 0, 0, 0, 33, 3, 61, 59, 2, 60, 1,
-    0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 48, 49, 50, 0, 0, 0, 0, 18, 0, 0, 0, 0,
-    0, 27, 64, 0, 16, 17, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 41, 67, 0, 62, 44,
-    0, 0, 7, 10, 0, 0, 0, 0, 69, 0, 0, 0, 0, 8, 21, 22,
-    23, 0, 0, 0, 32, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 212, 12, 13, 11, 14, 15, 0, 0, 0, 0, 9, 40, 42, 43,
-    68, 6, 4, 5, 231, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70,
-    0, 0, 0, 0, 0, 66, 25, 26, 0, 0, 0, 0, 0, 71, 159, 29,
-    0, 75, 0, 0, 34, 45, 46, 47, 0, 0, 0, 0, 56, 54, 55, 53,
-    51, 52, 30, 31, 0, 35, 65, 38, 39, 36, 37, 0, 24, 0, 0, 28,
-    0, 0, 195, 33, 3, 61, 59, 2, 60, 1, 0, 0, 0, 0, 0, 0,
-    58, 0, 200, 0, 197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49,
-    50, 0, 0, 0, 0, 18, 188, 0, 0, 0, 0, 27, 64, 0, 16, 17,
-    19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 141, 0, 260,
-    0, 0, 0, 0, 111, 0, 0, 0, 252, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 63, 41, 67, 0, 62, 44, 0, 0, 7, 10, 0, 0,
-    0, 0, 69, 0, 0, 169, 0, 8, 21, 22, 23, 0, 0, 0, 32, 57,
-    0, 0, 0, 0, 131, 0, 0, 0, 0, 0, 127, 0, 213, 12, 13, 11,
-    14, 15, 0, 0, 0, 0, 9, 40, 42, 43, 68, 6, 4, 5, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 116, 70, 0, 0, 194, 0, 0, 66,
-    25, 26, 0, 0, 0, 258, 158, 71, 0, 29, 0, 0, 0, 0, 34, 45,
-    46, 47, 0, 0, 174, 0, 56, 54, 55, 53, 51, 52, 30, 31, 0, 35,
-    65, 38, 39, 36, 37, 0, 24, 0, 0, 28, 0, 0, 0, 33, 3, 61,
-    59, 2, 60, 1, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0,
-    208, 0, 0, 0, 0, 0, 0, 0, 48, 49, 50, 0, 0, 0, 0, 18,
-    0, 0, 0, 0, 0, 27, 64, 0, 16, 17, 19, 20, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 264, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 41,
-    67, 0, 62, 44, 0, 0, 7, 10, 0, 0, 0, 0, 69, 0, 0, 0,
-    0, 8, 21, 22, 23, 0, 0, 0, 32, 57, 0, 0, 0, 0, 0, 0,
-    82, 0, 0, 0, 0, 0, 0, 12, 13, 11, 14, 15, 0, 0, 0, 0,
-    9, 40, 42, 43, 68, 6, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 70, 0, 0, 0, 0, 0, 66, 25, 26, 0, 0, 0, 0,
-    0, 71, 0, 29, 0, 0, 0, 0, 34, 45, 46, 47, 0, 0, 0, 0,
-    56, 54, 55, 53, 51, 52, 30, 31, 0, 35, 65, 38, 39, 36, 37, 0,
-    24, 0, 0, 28, 0, 0, 0, 33, 3, 61, 59, 2, 60, 1, 0, 0,
-    0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 48, 49, 50, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 27,
-    64, 0, 16, 17, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 91, 0, 0, 0, 0, 112, 0, 0, 0, 73, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 63, 41, 67, 0, 62, 44, 0, 0,
-    7, 10, 0, 0, 0, 0, 69, 0, 0, 0, 0, 8, 21, 22, 23, 0,
-    0, 0, 32, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 12, 13, 11, 14, 15, 0, 239, 0, 0, 9, 40, 42, 43, 68, 6,
-    4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0,
-    0, 0, 0, 66, 25, 26, 0, 0, 0, 0, 0, 71, 0, 29, 0, 0,
-    0, 0, 34, 45, 46, 47, 0, 0, 0, 0, 56, 54, 55, 53, 51, 52,
-    30, 31, 0, 35, 65, 38, 39, 36, 37, 0, 24, 0, 0, 28, 0, 0,
-    0, 33, 3, 61, 59, 2, 60, 1, 0, 0, 0, 0, 0, 0, 58, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 50, 0,
-    0, 0, 0, 18, 0, 0, 0, 0, 0, 27, 64, 0, 16, 17, 19, 20,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 142, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 223, 63, 41, 67, 0, 62, 44, 0, 0, 7, 10, 0, 0, 0, 0,
-    69, 0, 0, 170, 0, 8, 21, 22, 23, 0, 0, 0, 32, 57, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 214, 12, 13, 11, 14, 15,
-    0, 0, 0, 0, 9, 40, 42, 43, 68, 6, 4, 5, 0, 0, 0, 0,
-    0, 0, 0, 240, 0, 0, 0, 70, 0, 0, 0, 0, 95, 66, 25, 26,
-    0, 0, 0, 0, 0, 71, 0, 29, 0, 0, 0, 0, 34, 45, 46, 47,
-    176, 175, 0, 0, 56, 54, 55, 53, 51, 52, 30, 31, 0, 35, 65, 38,
-    39, 36, 37, 0, 24, 0, 0, 28, 101, 179, 0, 33, 3, 61, 59, 2,
-    60, 1, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 48, 49, 50, 0, 0, 0, 0, 18, 0, 0,
-    0, 0, 0, 27, 64, 0, 16, 17, 19, 20, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 151, 0, 0, 0, 0, 78, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 63, 41, 67, 0,
-    62, 44, 0, 0, 7, 10, 0, 0, 0, 0, 69, 0, 0, 171, 0, 8,
-    21, 22, 23, 0, 0, 0, 32, 57, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 12, 13, 11, 14, 15, 0, 0, 0, 0, 9, 40,
-    42, 43, 68, 6, 4, 5, 0, 0, 0, 0, 0, 0, 0, 241, 0, 0,
-    0, 70, 0, 0, 0, 0, 96, 66, 25, 26, 0, 0, 0, 0, 0, 71,
-    0, 29, 0, 0, 0, 0, 34, 45, 46, 47, 177, 0, 0, 0, 56, 54,
-    55, 53, 51, 52, 30, 31, 0, 35, 65, 38, 39, 36, 37, 0, 24, 0,
-    0, 28, 0, 100, 0, 33, 3, 61, 59, 2, 60, 1, 0, 0, 0, 0,
-    0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    48, 49, 50, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 27, 64, 0,
-    16, 17, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 235, 0, 0, 0, 0, 0, 0, 0, 0,
+extern lexer_row_t const lexer_row_table[266] = {
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {18,0,0,0}, {59,0,0,0}, {17,0,0,0}, {9,0,0,0}, {11,0,0,0}, {97,0,0,0}, {5,0,0,0}, {100,0,0,0},
+    {142,0,0,0}, {141,0,0,0}, {168,0,0,0}, {89,0,0,0}, {0,67,0,0}, {0,56,0,0}, {0,54,0,0}, {0,55,0,0},
+    {0,53,0,0}, {0,33,0,0}, {0,30,0,0}, {0,31,0,0}, {0,32,0,0}, {184,0,0,0}, {7,0,0,0}, {188,0,0,0},
+    {17,0,0,0}, {189,0,0,0}, {199,0,0,0}, {120,0,0,0}, {188,0,0,0}, {186,0,0,0}, {0,57,0,0}, {0,14,0,0},
+    {0,15,0,0}, {0,16,0,0}, {205,0,0,0}, {192,0,0,0}, {3,0,0,0}, {200,0,0,0}, {58,0,0,0}, {0,8,0,0},
+    {208,0,0,0}, {135,0,0,0}, {210,0,0,0}, {111,0,0,0}, {18,0,0,0}, {70,0,0,0}, {0,17,0,0}, {0,63,0,0},
+    {0,45,0,0}, {0,46,0,0}, {0,47,0,0}, {0,11,0,0}, {0,68,0,0}, {0,40,0,0}, {0,41,0,0}, {170,0,0,0},
+    {189,0,0,0}, {179,0,0,0}, {118,0,0,0}, {92,0,0,0}, {48,0,0,0}, {211,0,0,0}, {206,0,0,0}, {0,7,0,0},
+    {0,36,0,0}, {0,37,0,0}, {204,0,0,0}, {54,0,0,0}, {0,59,0,0}, {0,2,0,0}, {0,60,0,0}, {0,1,0,0},
+    {0,62,0,0}, {0,48,0,0}, {0,49,0,0}, {0,50,0,0}, {0,70,0,0}, {0,69,0,0}, {202,0,0,0}, {0,24,0,0},
+    {0,64,0,0}, {185,0,0,0}, {52,0,0,0}, {196,0,0,0}, {0,66,0,0}, {0,25,0,0}, {0,26,0,0}, {129,0,0,0},
+    {83,0,0,0}, {206,0,0,0}, {141,0,0,0}, {0,19,0,0}, {0,20,0,0}, {0,18,0,0}, {106,0,0,0}, {184,0,0,0},
+    {221,0,0,0}, {0,6,0,0}, {0,4,0,0}, {0,5,0,0}, {0,10,0,0}, {0,9,0,0}, {114,0,0,0}, {204,0,0,0},
+    {20,0,0,0}, {225,0,0,0}, {142,0,0,0}, {189,0,0,0}, {187,0,0,0}, {199,0,0,0}, {203,0,0,0}, {198,0,0,0},
+    {200,0,0,0}, {143,0,0,0}, {0,12,0,0}, {0,13,0,0}, {218,0,0,0}, {0,34,0,0}, {0,27,0,0}, {191,0,0,0},
+    {147,0,0,0}, {212,0,0,0}, {0,51,0,0}, {0,52,0,0}, {213,0,0,0}, {236,0,0,0}, {154,0,0,0}, {237,0,0,0},
+    {119,0,0,0}, {0,42,0,0}, {0,43,0,0}, {0,58,0,0}, {0,3,0,0}, {0,61,0,0}, {40,0,0,0}, {74,0,0,0},
+    {76,0,0,0}, {87,0,0,0}, {218,0,0,0}, {130,0,0,0}, {73,0,0,0}, {67,0,0,0}, {0,71,0,0}, {132,0,0,0},
+    {145,0,0,0}, {114,0,0,0}, {225,0,0,0}, {163,0,0,0}, {149,0,0,0}, {224,0,0,0}, {231,0,0,0}, {225,0,0,0},
+    {45,0,0,0}, {138,0,0,0}, {208,0,0,0}, {226,0,0,0}, {238,0,0,0}, {0,65,0,0}, {98,0,0,0}, {210,0,0,0},
+    {145,0,0,0}, {209,0,0,0}, {0,44,0,0}, {157,0,0,0}, {226,0,0,0}, {161,0,0,0}, {178,0,0,0}, {191,0,0,0},
+    {0,38,0,0}, {0,39,0,0}, {249,0,0,0}, {0,35,0,0}, {236,0,0,0}, {152,0,0,0}, {0,21,0,0}, {0,22,0,0},
+    {0,23,0,0}, {0,0,0,0}, {213,0,0,0}, {165,0,0,0}, {216,0,0,0}, {215,0,0,0}, {0,29,0,0}, {0,28,0,0},
+    {230,0,0,0}, {217,0,0,0}, {174,0,0,0}, {218,0,0,0}, {225,0,0,0}, {219,0,0,0}, {245,0,0,0}, {244,0,0,0},
+    {225,0,0,0}, {137,0,0,0},
+};
+extern lexer_comb_t const lexer_comb_table[295] = {
+    {249,214}, {0,0}, {249,209}, {249,224}, {249,216}, {249,74}, {249,138}, {108,140},
+    {108,141}, {249,162}, {249,117}, {94,157}, {249,213}, {78,238}, {249,95}, {249,77},
+    {249,78}, {78,239}, {249,131}, {249,212}, {249,132}, {74,244}, {176,86}, {74,245},
+    {249,139}, {249,96}, {249,115}, {249,116}, {249,129}, {94,158}, {94,190}, {249,130},
+    {249,159}, {75,240}, {249,225}, {76,243}, {249,226}, {249,250}, {249,251}, {176,87},
+    {249,207}, {249,206}, {249,208}, {96,178}, {116,264}, {96,179}, {116,265}, {75,241},
+    {96,180}, {224,160}, {132,174}, {224,161}, {96,181}, {96,182}, {224,227}, {96,183},
+    {72,189}, {96,184}, {224,228}, {224,133}, {96,185}, {224,134}, {110,186}, {224,109},
+    {206,127}, {206,128}, {224,110}, {132,175}, {206,79}, {213,210}, {132,176}, {132,177},
+    {213,211}, {206,80}, {206,81}, {212,101}, {212,112}, {110,187}, {154,157}, {212,113},
+    {206,82}, {139,256}, {206,83}, {117,262}, {212,114}, {212,97}, {213,100}, {160,170},
+    {139,257}, {117,263}, {139,258}, {212,98}, {209,106}, {212,99}, {139,259}, {139,260},
+    {154,158}, {154,190}, {139,261}, {209,107}, {208,215}, {209,108}, {160,171}, {73,102},
+    {131,197}, {209,221}, {209,222}, {131,198}, {207,196}, {209,223}, {131,199}, {207,235},
+    {131,200}, {83,145}, {207,236}, {77,242}, {207,237}, {208,191}, {217,103}, {217,104},
+    {208,192}, {208,193}, {99,145}, {217,105}, {230,103}, {230,104}, {79,120}, {79,121},
+    {200,201}, {230,105}, {166,90}, {79,122}, {211,90}, {83,146}, {83,147}, {217,118},
+    {174,194}, {174,195}, {200,202}, {113,120}, {113,121}, {230,118}, {99,146}, {99,147},
+    {113,122}, {115,230}, {115,231}, {130,153}, {162,93}, {115,232}, {166,91}, {166,92},
+    {211,91}, {211,92}, {130,154}, {162,94}, {245,246}, {216,217}, {216,218}, {130,155},
+    {162,168}, {216,219}, {225,73}, {265,246}, {159,252}, {225,166}, {198,125}, {80,119},
+    {178,170}, {185,186}, {159,253}, {192,86}, {198,126}, {220,136}, {245,247}, {245,248},
+    {215,194}, {215,195}, {81,149}, {225,167}, {238,136}, {265,247}, {265,248}, {178,171},
+    {185,187}, {219,163}, {219,164}, {220,137}, {192,87}, {232,163}, {232,164}, {235,125},
+    {237,201}, {239,240}, {238,137}, {251,220}, {82,148}, {235,126}, {93,152}, {251,75},
+    {258,140}, {258,141}, {237,202}, {95,188}, {97,149}, {98,148}, {100,89}, {239,241},
+    {101,144}, {106,143}, {107,142}, {109,123}, {112,234}, {114,119}, {127,144}, {128,234},
+    {129,233}, {133,173}, {134,172}, {138,150}, {150,151}, {153,152}, {155,156}, {161,169},
+    {167,89}, {168,156}, {175,88}, {177,85}, {179,169}, {180,135}, {181,111}, {182,173},
+    {183,172}, {184,123}, {188,189}, {191,88}, {193,85}, {196,84}, {197,84}, {199,124},
+    {210,102}, {218,165}, {221,205}, {222,204}, {223,203}, {226,72}, {227,135}, {228,111},
+    {231,165}, {233,151}, {236,124}, {242,243}, {244,229}, {250,76}, {252,255}, {253,254},
+    {256,143}, {257,142}, {259,205}, {260,204}, {261,203}, {262,255}, {263,254}, {264,229},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
 };
 } // namespace asm_lex
@@ -1,5 +1,6 @@
 #include <cstdint>
 #include <string_view>
+#include "lex_scan.hpp"
 namespace asm_lex
 {
 using token_type_t = std::uint16_t;
@@ -237,7 +238,25 @@ inline std::string_view token_string(token_type_t type)
 #define asm_lex_TOK_KEY_CASES \
 
 constexpr token_type_t TOK_LAST_STATE = 71;
-constexpr token_type_t TOK_START = 255;
-extern unsigned const lexer_ec_table[256];
-extern token_type_t const lexer_transition_table[12236];
+constexpr token_type_t TOK_START = 249;
+struct lexer_row_t { std::uint16_t base; token_type_t fallback; token_type_t parent; std::uint8_t loop; };
+struct lexer_comb_t { token_type_t check; token_type_t next; };
+extern std::uint8_t const lexer_ec_table[256];
+extern lexer_row_t const lexer_row_table[266];
+extern lexer_comb_t const lexer_comb_table[295];
+inline token_type_t lexer_transition(token_type_t state, unsigned char c)
+{
+    unsigned const ec = lexer_ec_table[c];
+    lexer_row_t const* row = &lexer_row_table[state];
+    lexer_comb_t comb = lexer_comb_table[row->base + ec];
+    if(comb.check != state && row->parent)
+    {
+        state = row->parent;
+        row = &lexer_row_table[state];
+        comb = lexer_comb_table[row->base + ec];
+    }
+    // Written as a select, as the branch is unpredictable:
+    return comb.check == state ? comb.next : row->fallback;
+}
+inline lex_loop_t lexer_loop(token_type_t state) { return lex_loop_t(lexer_row_table[state].loop); }
 } // namespace asm_lex
@@ -5,6 +5,7 @@
 #include <array>
 #include <cassert>
 #include <climits>
+#include <cstddef>
 #include <cstdint>
 #include <type_traits>
 #include <memory>
@@ -731,5 +732,209 @@ private:
     std::unique_ptr<value_type[]> m_ptr;
 };
 
-#endif
+// A compressed copy of an 'xbitset_t', for sets sized to the whole program that are mostly clear,
+// like the read, write, and call summaries of fns.
+// Like a roaring bitset, it picks the smaller of two representations:
+// - Sparse, storing only the non-zero words along with their indexes.
+// - Dense, storing every word.
+// Sets are meant to be built as 'xbitset_t's, then compressed.
+template<typename SizeBase>
+class sparse_xbitset_t
+{
+public:
+    using size_base = SizeBase;
+    using value_type = bitset_uint_t;
+    static constexpr std::size_t bits_per_int = sizeof(value_type) * CHAR_BIT;
+
+    sparse_xbitset_t() = default;
+    explicit sparse_xbitset_t(xbitset_t<SizeBase> const& o) { assign(o); }
+    sparse_xbitset_t(sparse_xbitset_t const& o) { copy(o); }
+    sparse_xbitset_t(sparse_xbitset_t&& o) = default;
+
+    sparse_xbitset_t& operator=(sparse_xbitset_t const& o) { copy(o); return *this; }
+    sparse_xbitset_t& operator=(sparse_xbitset_t&& o) = default;
+    sparse_xbitset_t& operator=(xbitset_t<SizeBase> const& o) { assign(o); return *this; }
+
+    // The size of the dense bitset, in ints.
+    constexpr std::size_t size() const { return SizeBase::bitset_size(); }
+
+    explicit operator bool() const { return m_assigned; }
+
+    // Heap memory used, in bytes.
+    std::size_t heap_bytes() const { return alloc_bytes(m_num_words, m_dense); }
+
+    bool test(std::size_t bit) const
+    {
+        std::size_t const index = bit / bits_per_int;
+        value_type word = 0;
+
+        if(m_dense)
+            word = index < m_num_words ? words()[index] : 0;
+        else
+        {
+            std::uint32_t const* begin = indexes();
+            std::uint32_t const* end = begin + m_num_words;
+            std::uint32_t const* it = std::lower_bound(begin, end, index);
+            if(it != end && *it == index)
+                word = words()[it - begin];
+        }
+
+        return (word >> (bit % bits_per_int)) & 1;
+    }
+
+    bool all_clear() const { return for_each_word([](std::size_t, value_type) { return false; }); }
+
+    std::size_t popcount() const
+    {
+        std::size_t count = 0;
+        for_each_word([&](std::size_t, value_type word) { count += builtin::popcount(word); return true; });
+        return count;
+    }
+
+    template<typename Fn>
+    void for_each(Fn const& fn) const 
+    { 
+        for_each_word([&](std::size_t index, value_type word)
+        {
+            ::bitset_for_each<SizeBase>(word, fn, index * bits_per_int);
+            return true;
+        });
+    }
+
+    template<typename Fn>
+    bool for_each_test(Fn const& fn) const 
+    { 
+        return for_each_word([&](std::size_t index, value_type word)
+        {
+            return ::bitset_for_each_test<SizeBase>(word, fn, index * bits_per_int);
+        });
+    }
+
+    // Operations on dense bitsets of size 'size()':
+
+    void copy_into(value_type* dense) const
+    {
+        bitset_clear_all(size(), dense);
+        or_into(dense);
+    }
+
+    void or_into(value_type* dense) const
+    {
+        for_each_word([&](std::size_t index, value_type word) { dense[index] |= word; return true; });
+    }
+
+    bool intersects(value_type const* dense) const
+    {
+        return !for_each_word([&](std::size_t index, value_type word) { return !(dense[index] & word); });
+    }
 
+    xbitset_t<SizeBase> dense() const
+    {
+        xbitset_t<SizeBase> ret(nullptr);
+        or_into(ret.data());
+        return ret;
+    }
+
+private:
+    // Calls 'fn(index, word)' for each non-zero word, stopping early if it returns false.
+    template<typename Fn>
+    bool for_each_word(Fn const& fn) const
+    {
+        value_type const* w = words();
+        if(m_dense)
+        {
+            for(std::size_t i = 0; i < m_num_words; ++i)
+                if(w[i] && !fn(i, w[i]))
+                    return false;
+        }
+        else
+        {
+            std::uint32_t const* index = indexes();
+            for(std::size_t i = 0; i < m_num_words; ++i)
+                if(!fn(index[i], w[i]))
+                    return false;
+        }
+        return true;
+    }
+
+    static std::size_t alloc_bytes(std::size_t num_words, bool dense)
+    {
+        return num_words * (sizeof(value_type) + (dense ? 0 : sizeof(std::uint32_t)));
+    }
+
+    // Words are stored first, followed by indexes when sparse.
+    value_type const* words() const { return reinterpret_cast<value_type const*>(m_data.get()); }
+    value_type* words() { return reinterpret_cast<value_type*>(m_data.get()); }
+    std::uint32_t const* indexes() const { return reinterpret_cast<std::uint32_t const*>(words() + m_num_words); }
+    std::uint32_t* indexes() { return reinterpret_cast<std::uint32_t*>(words() + m_num_words); }
+
+    void assign(xbitset_t<SizeBase> const& o)
+    {
+        m_assigned = !!o;
+        m_num_words = 0;
+        m_dense = false;
+        m_data.reset();
+
+        if(!o)
+            return;
+
+        value_type const* data = o.data();
+
+        // Trailing zero words are never stored.
+        std::size_t used = size();
+        while(used && !data[used - 1])
+            --used;
+
+        std::size_t non_zero = 0;
+        for(std::size_t i = 0; i < used; ++i)
+            non_zero += !!data[i];
+
+        m_dense = alloc_bytes(used, true) <= alloc_bytes(non_zero, false);
+        m_num_words = m_dense ? used : non_zero;
+
+        if(!m_num_words)
+            return;
+
+        m_data.reset(new std::byte[heap_bytes()]);
+
+        if(m_dense)
+            std::copy(data, data + used, words());
+        else
+        {
+            std::size_t j = 0;
+            for(std::size_t i = 0; i < used; ++i)
+            {
+                if(data[i])
+                {
+                    words()[j] = data[i];
+                    indexes()[j] = i;
+                    ++j;
+                }
+            }
+        }
+    }
+
+    void copy(sparse_xbitset_t const& o)
+    {
+        m_assigned = o.m_assigned;
+        m_num_words = o.m_num_words;
+        m_dense = o.m_dense;
+        m_data.reset(m_num_words ? new std::byte[heap_bytes()] : nullptr);
+        std::copy(o.m_data.get(), o.m_data.get() + heap_bytes(), m_data.get());
+    }
+
+    std::unique_ptr<std::byte[]> m_data;
+    std::uint32_t m_num_words = 0; // Number of words stored.
+    bool m_dense = false;
+    bool m_assigned = false;
+};
+
+template<typename SizeBase>
+xbitset_t<SizeBase>& operator|=(xbitset_t<SizeBase>& lhs, sparse_xbitset_t<SizeBase> const& rhs)
+{
+    assert(lhs.size() == rhs.size());
+    rhs.or_into(lhs.data());
+    return lhs;
+}
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 
 void test_fill(bitset_t& bs, unsigned start, unsigned size)
 {
@@ -41,3 +42,57 @@ TEST_CASE("bitset_set_n", "[bitset]")
     test_fill(bs, 200, 0);
 }
 
+
+namespace
+{
+    struct test_handle_t
+    {
+        unsigned id;
+        static std::size_t bitset_size() { return 8; }
+    };
+}
+
+TEST_CASE("sparse_xbitset", "[bitset]")
+{
+    using dense_t = xbitset_t<test_handle_t>;
+    using sparse_t = sparse_xbitset_t<test_handle_t>;
+
+    REQUIRE(!sparse_t());
+
+    for(unsigned iter = 0; iter < 1000; ++iter)
+    {
+        // Vary the density, to test both representations:
+        unsigned const words_used = rand() % 9;
+        dense_t dense(nullptr);
+        for(unsigned i = 0; i < words_used; ++i)
+            if(rand() % 2)
+                dense.data()[rand() % dense.size()] |= bitset_uint_t(rand()) << (rand() % 32);
+
+        sparse_t const sparse(dense);
+        sparse_t const copy = sparse;
+        REQUIRE(copy);
+        REQUIRE(copy.heap_bytes() <= dense.size() * sizeof(bitset_uint_t));
+
+        for(unsigned bit = 0; bit < dense.num_bits(); ++bit)
+            REQUIRE(copy.test(bit) == dense.test(bit));
+
+        REQUIRE(copy.all_clear() == dense.all_clear());
+        REQUIRE(copy.popcount() == dense.popcount());
+
+        std::vector<unsigned> dense_bits, sparse_bits;
+        dense.for_each([&](test_handle_t h) { dense_bits.push_back(h.id); });
+        copy.for_each([&](test_handle_t h) { sparse_bits.push_back(h.id); });
+        REQUIRE(dense_bits == sparse_bits);
+
+        dense_t other(nullptr);
+        other.set(rand() % other.num_bits());
+        bitset_uint_t* const temp = ALLOCA_T(bitset_uint_t, dense.size());
+        bitset_copy(dense.size(), temp, dense.data());
+        bitset_and(dense.size(), temp, other.data());
+        REQUIRE(copy.intersects(other.data()) == !bitset_all_clear(dense.size(), temp));
+
+        other |= copy;
+        REQUIRE(!copy.intersects(other.data()) == copy.all_clear());
+        REQUIRE(copy.dense().popcount() == dense.popcount());
+    }
+}
@@ -362,7 +362,11 @@ void byteify(ir_t& ir, fn_t const& fn)
                 }
             }
 
-            if(is_byteified(type.name()))
+            // Divisions get expanded even when they're already bytes.
+            // (The nodes split off below lack inputs, and shouldn't be expanded again.)
+            bool const expand = (ssa_it->op() == SSA_div || ssa_it->op() == SSA_mod) && ssa_it->input_size();
+
+            if(is_byteified(type.name()) && !expand)
             {
                 auto& d = ssa_it.data<ssa_byteify_d>(); 
                 if(type == TYPE_S)
@@ -768,6 +772,12 @@ void byteify(ir_t& ir, fn_t const& fn)
             }
             break;
 
+        case SSA_div:
+        case SSA_mod:
+            // Expanded divisions read their inputs' bytemaps later on.
+            if(ssa_it->input_size())
+                break;
+            // fall-through
         default:
             assert(!(ssa_flags(ssa_it->op()) & SSAF_WRITE_GLOBALS));
             assert(!direct_fn(ssa_it->op()));
@@ -1146,6 +1156,50 @@ void byteify(ir_t& ir, fn_t const& fn)
             }
             break;
 
+        // Division becomes long division, one byte at a time,
+        // with each step calling the run-time routine.
+        case SSA_div:
+        case SSA_mod:
+            {
+                bm_t const lhs_bm = _get_bm(ssa_node->input(0));
+                bm_t const rhs_bm = _get_bm(ssa_node->input(1));
+
+                int const begin = begin_byte(t);
+                int const end = end_byte(t);
+
+                // 'eval' only allows divisors that fit in a byte.
+                for(int i = begin + 1; i < end; ++i)
+                    if(!rhs_bm[i].eq_whole(0))
+                        throw std::runtime_error("Trying to byteify a division by a multi-byte value.");
+
+                cfg_ht const cfg = ssa_node->cfg_node();
+                ssa_value_t const divisor = rhs_bm[begin];
+                ssa_value_t remainder = ssa_value_t(0u, TYPE_U);
+
+                for(int i = end - 1; i >= begin; --i)
+                {
+                    ssa_ht const quotient = cfg->emplace_ssa(SSA_div8, TYPE_U, remainder, lhs_bm[i], divisor);
+                    remainder = cfg->emplace_ssa(SSA_div8_rem, TYPE_U, quotient);
+
+                    ssa_ht const split = d.bm[i].handle();
+                    split->alloc_input(1);
+                    if(ssa_node->op() == SSA_div)
+                        split->build_set_input(0, quotient);
+                    else if(i != begin)
+                        split->build_set_input(0, ssa_value_t(0u, TYPE_U));
+                    split->unsafe_set_op(SSA_cast);
+                }
+
+                if(ssa_node->op() == SSA_mod)
+                    d.bm[begin].handle()->build_set_input(0, remainder);
+
+                prune_nodes.push_back(ssa_node);
+
+                // Created a node, so we have to resize:
+                ssa_data_pool::resize<ssa_byteify_d>(ssa_pool::array_size());
+            }
+            break;
+
         case SSA_read_array8:
             {
                 using namespace ssai::array;
@@ -634,6 +634,7 @@ std::size_t code_gen(log_t* log, ir_t& ir, fn_t& fn)
     };
 
     calc_ssa_liveness(ir, ssa_data_pool::array_size());
+    cset_build_interference(ir);
 
     // Note: once the live sets have been built, the IR cannot be modified
     // until all liveness checks are done.
@@ -683,6 +684,7 @@ std::size_t code_gen(log_t* log, ir_t& ir, fn_t& fn)
 
         clear_liveness_for(ir, parent);
         calc_ssa_liveness(parent);
+        cset_liveness_changed(parent);
 
         // Because parent's liveness changed, it may no longer be compatible with its cset.
         // Thus, we'll remove it if necessary:
@@ -974,6 +976,7 @@ std::size_t code_gen(log_t* log, ir_t& ir, fn_t& fn)
 
                 // Now try to coalesce it into the locator's cset.
                 calc_ssa_liveness(store);
+                cset_liveness_changed(store);
 
                 if(coalesce_loc(loc, ld, store))
                 {
@@ -1249,6 +1252,9 @@ std::size_t code_gen(log_t* log, ir_t& ir, fn_t& fn)
         assert(cg_data(head_input).ptr_alt);
     }
 
+    // No more cset interference checks occur past this point.
+    cset_clear_interference();
+
     passert(reserved_size >= ssa_pool::array_size(),
             reserved_size, ssa_pool::array_size());
 
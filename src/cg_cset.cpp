@@ -1,10 +1,62 @@
 #include "cg_cset.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
 #include "globals.hpp"
 #include "ir.hpp"
 #include "ir_util.hpp"
 #include "alloca.hpp"
 #include "cg_liveness.hpp"
+#include "thread.hpp"
+
+namespace
+{
+    using clock = std::chrono::steady_clock;
+
+    struct interference_t
+    {
+        bool built = false;
+
+        // Sorted IDs of the nodes live at each node's definition, indexed by node ID.
+        // Nodes sharing an 'orig_def' are omitted, as they never interfere.
+        std::vector<std::vector<unsigned>> live_at;
+
+        // The union of 'live_at' over each cset's members, indexed by head ID.
+        std::vector<std::vector<unsigned>> cset_live_at;
+        std::vector<bool> cset_valid;
+
+        // Nodes whose live range changed after building.
+        std::vector<bool> changed;
+
+        std::vector<unsigned> merge_buffer;
+
+        coalesce_stats_t stats;
+    };
+
+    TLS interference_t interference;
+
+    std::atomic<std::uint64_t> total_build_ns = 0;
+    std::atomic<std::uint64_t> total_check_ns = 0;
+    std::atomic<std::uint64_t> total_checks = 0;
+
+    std::uint64_t ns_since(clock::time_point start)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+    }
+
+    void invalidate_cset(ssa_ht head)
+    {
+        if(head.id < interference.cset_valid.size())
+            interference.cset_valid[head.id] = false;
+    }
+
+    bool liveness_changed(ssa_ht h)
+    {
+        return h.id >= interference.changed.size() || interference.changed[h.id];
+    }
+}
 
 // Used to convert ssa_values into locators usable in code gen.
 locator_t asm_arg(ssa_value_t v)
@@ -44,27 +96,38 @@ bool cset_is_last(ssa_ht h)
 ssa_ht cset_next(ssa_ht h) 
     { assert(h); return cg_data(h).cset_next; }
 
-ssa_ht cset_head(ssa_ht h)
+ssa_ht cset_head(ssa_ht const h)
 {
     assert(h);
     passert(h->op(), h, h->op());
+
+    ssa_ht head = h;
     while(true)
     {
-        // TODO: update pointers to point to head.
-        auto& d = cg_data(h);
+        auto& d = cg_data(head);
         if(d.cset_head.holds_ref())
         {
             assert(d.cset_head->op());
             assert(d.cset_head.is_handle());
-            assert(h != d.cset_head.handle());
-            h = d.cset_head.handle();
+            assert(head != d.cset_head.handle());
+            head = d.cset_head.handle();
         }
         else
         {
-            assert(h->op());
-            return h;
+            assert(head->op());
+            break;
         }
     }
+
+    // Compress the path, so later lookups are quick:
+    for(ssa_ht it = h; it != head;)
+    {
+        auto& d = cg_data(it);
+        it = d.cset_head.handle();
+        d.cset_head = head;
+    }
+
+    return head;
 }
 
 locator_t cset_locator(ssa_ht const h, bool convert_ssa)
@@ -166,6 +229,14 @@ ssa_ht cset_remove(ssa_ht h)
     cg_data(h).cset_next = {};
     cg_data(h).ptr_alt = {}; 
 
+    if(interference.built)
+    {
+        invalidate_cset(h);
+        invalidate_cset(head);
+        if(ret)
+            invalidate_cset(ret);
+    }
+
 #ifndef NDEBUG
     if(ret)
         for(ssa_ht i = cset_head(ret); i; i = cset_next(i))
@@ -208,6 +279,26 @@ ssa_ht cset_append(ssa_value_t last, ssa_ht h)
         }
 
         cg_data(last_h).cset_next = h;
+
+        if(interference.built)
+        {
+            // Merge the live sets of both csets:
+            auto& d = interference;
+            if(head.id < d.cset_valid.size() && h.id < d.cset_valid.size()
+               && d.cset_valid[head.id] && d.cset_valid[h.id])
+            {
+                auto& head_set = d.cset_live_at[head.id];
+                auto& h_set = d.cset_live_at[h.id];
+                d.merge_buffer.clear();
+                std::set_union(head_set.begin(), head_set.end(), h_set.begin(), h_set.end(),
+                               std::back_inserter(d.merge_buffer));
+                head_set.swap(d.merge_buffer);
+                h_set.clear();
+            }
+            else
+                invalidate_cset(head);
+            invalidate_cset(h);
+        }
     }
     else
         cg_data(h).cset_head = last;
@@ -231,14 +322,8 @@ bool special_interferes(fn_ht fn, ir_t const& ir, ssa_ht h, locator_t loc, ssa_h
             return callable->ir_writes().test(loc.gmember().id);
         case LOC_GMEMBER_SET:
             {
-                std::size_t const size = gmember_ht::bitset_size();
-                assert(size == callable->ir_reads().size());
-
-                bitset_uint_t* bs = ALLOCA_T(bitset_uint_t, size);
-                bitset_copy(size, bs, callable->ir_writes().data());
-                bitset_and(size, bs, ir.gmanager.get_set(loc));
-
-                return !bitset_all_clear(size, bs);
+                assert(gmember_ht::bitset_size() == callable->ir_writes().size());
+                return callable->ir_writes().intersects(ir.gmanager.get_set(loc));
             }
         case LOC_ARG:
         case LOC_RETURN:
@@ -269,6 +354,99 @@ bool special_interferes(fn_ht fn, ir_t const& ir, ssa_ht h, locator_t loc, ssa_h
     return false;
 }
 
+// Tests every pair of nodes between the two csets.
+static bool csets_interfere_pairwise(ssa_ht a, ssa_ht b)
+{
+    for(ssa_ht ai = a; ai; ai = cset_next(ai))
+    for(ssa_ht bi = b; bi; bi = cset_next(bi))
+    {
+        assert(ai != bi);
+        if(orig_def(ai) != orig_def(bi) && live_range_overlap(ai, bi))
+            return true;
+    }
+    return false;
+}
+
+static std::vector<unsigned> const& cset_live_at(ssa_ht head)
+{
+    auto& d = interference;
+
+    // Nodes created after building start out invalid:
+    if(head.id >= d.cset_valid.size())
+    {
+        d.cset_valid.resize(head.id + 1, false);
+        d.cset_live_at.resize(head.id + 1);
+    }
+
+    auto& set = d.cset_live_at[head.id];
+    if(!d.cset_valid[head.id])
+    {
+        set.clear();
+        for(ssa_ht it = head; it; it = cset_next(it))
+            if(it.id < d.live_at.size())
+                set.insert(set.end(), d.live_at[it.id].begin(), d.live_at[it.id].end());
+        std::sort(set.begin(), set.end());
+        set.erase(std::unique(set.begin(), set.end()), set.end());
+        d.cset_valid[head.id] = true;
+    }
+    return set;
+}
+
+// Checks if any node of 'in_set' is live at a definition of 'defs_head's cset.
+static bool live_at_cset_defs(ssa_ht in_head, ssa_ht defs_head)
+{
+    for(unsigned id : cset_live_at(defs_head))
+    {
+        ssa_ht const range = { id };
+
+        // The set may hold pruned nodes, and nodes whose IDs were reused.
+        if(!range->op() || cset_head(range) != in_head)
+            continue;
+
+        // Confirm the hit:
+        for(ssa_ht def = defs_head; def; def = cset_next(def))
+            if(orig_def(range) != orig_def(def) && live_at_def(range, def))
+                return true;
+    }
+    return false;
+}
+
+static bool csets_interfere_sparse(ssa_ht a, ssa_ht b)
+{
+    // Nodes whose live range changed since building aren't reflected in the sets.
+    for(ssa_ht ai = a; ai; ai = cset_next(ai))
+        if(liveness_changed(ai))
+            for(ssa_ht bi = b; bi; bi = cset_next(bi))
+                if(orig_def(ai) != orig_def(bi) && live_range_overlap(ai, bi))
+                    return true;
+
+    for(ssa_ht bi = b; bi; bi = cset_next(bi))
+        if(liveness_changed(bi))
+            for(ssa_ht ai = a; ai; ai = cset_next(ai))
+                if(orig_def(ai) != orig_def(bi) && live_range_overlap(ai, bi))
+                    return true;
+
+    return live_at_cset_defs(b, a) || live_at_cset_defs(a, b);
+}
+
+// Returns true if any node of 'a's cset has a live range overlapping one of 'b's.
+static bool csets_interfere(ssa_ht a, ssa_ht b)
+{
+    assert(cset_is_head(a));
+    assert(cset_is_head(b));
+
+    if(!interference.built)
+        return csets_interfere_pairwise(a, b);
+
+    auto const start = clock::now();
+    bool const result = csets_interfere_sparse(a, b);
+    interference.stats.check_ns += ns_since(start);
+    interference.stats.checks += 1;
+
+    assert(result == csets_interfere_pairwise(a, b));
+    return result;
+}
+
 // If theres no interference, returns a handle to the last node of 'a's cset.
 ssa_ht csets_dont_interfere(fn_ht fn, ir_t const& ir, ssa_ht a, ssa_ht b, cset_ir_cache_t const& cache)
 {
@@ -301,19 +479,12 @@ ssa_ht csets_dont_interfere(fn_ht fn, ir_t const& ir, ssa_ht a, ssa_ht b, cset_i
                     return {};
     }
 
-    ssa_ht last_a = {};
-    for(ssa_ht ai = a; ai; ai = cset_next(ai))
-    {
-        for(ssa_ht bi = b; bi; bi = cset_next(bi))
-        {
-            assert(ai != bi);
-            if(orig_def(ai) != orig_def(bi) && live_range_overlap(ai, bi))
-                return {};
-        }
-        last_a = ai;
-    }
+    if(csets_interfere(a, b))
+        return {};
 
-    assert(cset_is_last(last_a));
+    ssa_ht last_a = a;
+    while(!cset_is_last(last_a))
+        last_a = cset_next(last_a);
     return last_a;
 }
 
@@ -342,3 +513,120 @@ bool cset_live_at_any_def(ssa_ht a, ssa_ht const* b_begin, ssa_ht const* b_end)
     return false;
 }
 
+
+void cset_build_interference(ir_t const& ir)
+{
+    auto const start = clock::now();
+    auto& d = interference;
+
+    unsigned const size = ssa_pool::array_size();
+    d.live_at.resize(size);
+    d.cset_live_at.resize(size);
+    for(auto& set : d.live_at)
+        set.clear();
+    for(auto& set : d.cset_live_at)
+        set.clear();
+    d.cset_valid.assign(size, false);
+    d.changed.assign(size, false);
+
+    // A sparse set holding nodes that are live-out or used later in the cfg node:
+    std::vector<unsigned> live;
+    std::vector<unsigned> live_index(size, ~0u);
+
+    auto const insert = [&](unsigned id)
+    {
+        if(live_index[id] == ~0u)
+        {
+            live_index[id] = live.size();
+            live.push_back(id);
+        }
+    };
+
+    auto const erase = [&](unsigned id)
+    {
+        if(unsigned const i = live_index[id]; i != ~0u)
+        {
+            live_index[live.back()] = i;
+            live[i] = live.back();
+            live.pop_back();
+            live_index[id] = ~0u;
+        }
+    };
+
+    unsigned const set_size = live_set_size();
+
+    for(cfg_ht cfg_it = ir.cfg_begin(); cfg_it; ++cfg_it)
+    {
+        auto const& cd = cg_data(cfg_it);
+
+        bitset_for_each(set_size, cd.live.out, insert);
+
+        // Walk the schedule backwards, matching the definition of 'live_at_def':
+        for(int i = int(cd.schedule.size()) - 1; i >= 0; --i)
+        {
+            ssa_ht const def = cd.schedule[i];
+            ssa_value_t const def_orig = orig_def(def);
+            auto& set = d.live_at[def.id];
+
+            for(unsigned id : live)
+            {
+                ssa_ht const range = { id };
+
+                if(range == def || !range->op() || (ssa_flags(range->op()) & SSAF_CG_UNLIVE))
+                    continue;
+
+                // 'range' must begin before 'def':
+                if(!bitset_test(cd.live.in, id)
+                   && (range->cfg_node() != cfg_it || cg_data(range).schedule.index > i))
+                {
+                    continue;
+                }
+
+                if(orig_def(range) != def_orig)
+                    set.push_back(id);
+            }
+
+            std::sort(set.begin(), set.end());
+
+            erase(def.id);
+
+            unsigned const input_size = def->input_size();
+            for(unsigned j = 0; j < input_size; ++j)
+                if(def->input(j).holds_ref() && ssa_bck_edge_t{ def, j }.input_class() == INPUT_VALUE)
+                    insert(def->input(j).handle().id);
+        }
+
+        for(unsigned id : live)
+            live_index[id] = ~0u;
+        live.clear();
+    }
+
+    d.built = true;
+    d.stats.build_ns += ns_since(start);
+}
+
+void cset_liveness_changed(ssa_ht h)
+{
+    auto& d = interference;
+    if(!d.built)
+        return;
+    if(h.id >= d.changed.size())
+        d.changed.resize(h.id + 1, true);
+    d.changed[h.id] = true;
+}
+
+void cset_clear_interference()
+{
+    auto& d = interference;
+    d.built = false;
+
+    total_build_ns += d.stats.build_ns;
+    total_check_ns += d.stats.check_ns;
+    total_checks += d.stats.checks;
+    d.stats = {};
+}
+
+coalesce_stats_t coalesce_stats()
+{
+    return { total_build_ns.load(), total_check_ns.load(), total_checks.load() };
+}
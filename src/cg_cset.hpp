@@ -1,6 +1,7 @@
 #ifndef CG_CSET_HPP
 #define CG_CSET_HPP
 
+#include <cstdint>
 #include <vector>
 
 #include "decl.hpp"
@@ -11,6 +12,10 @@
 // purposes, dubbed "cset" for brevity.
 // These are implemented as union-find on top of a singly-linked list.
 // Below are some helper functions.
+//
+// Once liveness is calculated, interference between csets is tested using
+// sparse sets of the nodes live at each definition, built by 'cset_build_interference'.
+// Each cset head holds the union of its members' sets, merged as csets are appended.
 
 locator_t asm_arg(ssa_value_t v);
 
@@ -43,4 +48,23 @@ ssa_ht csets_appendable(fn_ht fn, ir_t const& ir, ssa_ht a, ssa_ht b, cset_ir_ca
 
 bool cset_live_at_any_def(ssa_ht a, ssa_ht const* b_begin, ssa_ht const* b_end);
 
+// Builds the live sets used to test interference. Call after 'calc_ssa_liveness'.
+void cset_build_interference(ir_t const& ir);
+
+// Call when the live range of 'h' changes after 'cset_build_interference'.
+// Such nodes will be tested pairwise.
+void cset_liveness_changed(ssa_ht h);
+
+// Call once the liveness checks are done.
+void cset_clear_interference();
+
+struct coalesce_stats_t
+{
+    std::uint64_t build_ns = 0; // Spent in 'cset_build_interference'.
+    std::uint64_t check_ns = 0; // Spent testing interference between csets.
+    std::uint64_t checks = 0;
+};
+
+coalesce_stats_t coalesce_stats();
+
 #endif
@@ -1,5 +1,6 @@
 #include "cg_isel.hpp"
 
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <type_traits>
@@ -28,6 +29,7 @@
 #include "switch.hpp"
 #include "asm_graph.hpp"
 #include "rom.hpp"
+#include "tier.hpp"
 
 namespace bc = ::boost::container;
 
@@ -210,6 +212,26 @@ namespace isel
         return (op_cycles(op) * 256ull) + (op_size(op) * 4ull) + penalty;
     }
 
+    // Approximate cycles spent inside 'RTROM_mul8', excluding the JSR.
+    constexpr unsigned MUL8_CYCLES = 130;
+    constexpr unsigned FAST_MUL8_CYCLES = 60;
+
+    // The cost of calling 'RTROM_mul8', including the time spent inside it.
+    inline isel_cost_t mul8_cost_fn()
+    {
+        unsigned const cycles = compiler_options().fast_mul ? FAST_MUL8_CYCLES : MUL8_CYCLES;
+        return cost_fn(JSR_ABSOLUTE) + (cycles * 256ull);
+    }
+
+    // Approximate cycles spent inside 'RTROM_div8', excluding the JSR.
+    constexpr unsigned DIV8_CYCLES = 200;
+
+    // The cost of calling 'RTROM_div8', including the time spent inside it.
+    constexpr isel_cost_t div8_cost_fn()
+    {
+        return cost_fn(JSR_ABSOLUTE) + (DIV8_CYCLES * 256ull);
+    }
+
 ///////////////////////////////////////////////////////////////////////////////
 
     // Represents a list of functions.
@@ -584,6 +606,28 @@ namespace isel
         exact_op<Op>(cpu, prev, cont, Opt::to_struct, Def::value(), Arg::trans(), Arg::trans_hi(), Def::node(), Arg::node());
     }
 
+    // Calls the multiply routine, costing it by 'mul8_cost_fn'.
+    template<typename Opt> [[gnu::noinline]]
+    void mul8_op(cpu_t const& cpu, sel_pair_t prev, cons_t const* cont)
+    {
+        locator_t const arg = locator_t::runtime_rom(RTROM_mul8);
+
+        cpu_t cpu_copy = cpu;
+        if(cpu_copy.set_defs_for<JSR_ABSOLUTE>(Opt::to_struct, {}, arg))
+            cont->call(cpu_copy, alloc_sel<JSR_ABSOLUTE>(cpu, prev, arg, {}, mul8_cost_fn() - cost_fn(JSR_ABSOLUTE)));
+    }
+
+    // Calls the divide routine, costing it by 'div8_cost_fn'.
+    template<typename Opt> [[gnu::noinline]]
+    void div8_op(cpu_t const& cpu, sel_pair_t prev, cons_t const* cont)
+    {
+        locator_t const arg = locator_t::runtime_rom(RTROM_div8);
+
+        cpu_t cpu_copy = cpu;
+        if(cpu_copy.set_defs_for<JSR_ABSOLUTE>(Opt::to_struct, {}, arg))
+            cont->call(cpu_copy, alloc_sel<JSR_ABSOLUTE>(cpu, prev, arg, {}, div8_cost_fn() - cost_fn(JSR_ABSOLUTE)));
+    }
+
     // Like exact_op, but with a simplified set of parameters.
     // Only supports a few addressing modes.
     template<op_t Op>
@@ -1391,7 +1435,31 @@ namespace isel
             addr::set(locator_t::addr(0x8000));
             mmc3_addr::set(locator_t::addr(0x8001));
 
-            if(compiler_options().unsafe_bank_switch)
+            if(mapper().data_window)
+            {
+                // Only switch the data window (R7), keeping our code mapped.
+                if(compiler_options().unsafe_bank_switch)
+                {
+                    chain
+                    < load_AX<Opt, const_<0b111111>, Def>
+                    , exact_op<Opt, STA_ABSOLUTE, null_, addr>
+                    , exact_op<Opt, STX_ABSOLUTE, null_, mmc3_addr>
+                    >(cpu, prev, cont);
+                }
+                else
+                {
+                    detail::set(locator_t::runtime_ram(RTRAM_mapper_detail));
+
+                    chain
+                    < load_X<Opt, Def>
+                    , exact_op<Opt, LDA_IMMEDIATE, null_, const_<0b111111>>
+                    , exact_op<Opt, STA_ABSOLUTE, null_, detail>
+                    , exact_op<Opt, STA_ABSOLUTE, null_, addr>
+                    , exact_op<Opt, STX_ABSOLUTE, null_, mmc3_addr>
+                    >(cpu, prev, cont);
+                }
+            }
+            else if(compiler_options().unsafe_bank_switch)
             {
                 chain
                 < load_AX<Opt, const_<0b111110>, Def>
@@ -3273,17 +3341,29 @@ namespace isel
 
         case SSA_mul:
         case SSA_mul8_lo:
-            p_arg<2>::set(locator_t::runtime_rom(RTROM_mul8));
-
             commutative(h, [&]()
             {
-                chain
-                < load_AY<Opt, p_lhs, p_rhs>
-                , simple_op<Opt, read_reg_op(REGF_A | REGF_Y)>
-                , exact_op<Opt, JSR_ABSOLUTE, null_, p_arg<2>>
-                , simple_op<Opt, write_reg_op(REGF_ISEL & ~REGF_X)>
-                , store<Opt::template restrict_to<~REGF_X>, STA, p_def, p_def>
-                >(cpu, prev, cont);
+                // The fast routine uses X to index its tables:
+                if(compiler_options().fast_mul)
+                {
+                    chain
+                    < load_AY<Opt, p_lhs, p_rhs>
+                    , simple_op<Opt, read_reg_op(REGF_A | REGF_Y)>
+                    , mul8_op<Opt>
+                    , simple_op<Opt, write_reg_op(REGF_ISEL)>
+                    , store<Opt::template restrict_to<~REGF_X>, STA, p_def, p_def>
+                    >(cpu, prev, cont);
+                }
+                else
+                {
+                    chain
+                    < load_AY<Opt, p_lhs, p_rhs>
+                    , simple_op<Opt, read_reg_op(REGF_A | REGF_Y)>
+                    , mul8_op<Opt>
+                    , simple_op<Opt, write_reg_op(REGF_ISEL & ~REGF_X)>
+                    , store<Opt::template restrict_to<~REGF_X>, STA, p_def, p_def>
+                    >(cpu, prev, cont);
+                }
             });
             break;
 
@@ -3291,6 +3371,34 @@ namespace isel
             store<Opt, STY, p_def, p_def>(cpu, prev, cont);
             break;
 
+        case SSA_div8:
+            p_lhs::set(h->input(0));
+            p_rhs::set(h->input(1));
+            p_arg<2>::set(h->input(2));
+
+            chain
+            < load_Y<Opt, p_arg<2>>
+            , load_AX<Opt::restrict_to<~REGF_Y>, p_lhs, p_rhs>
+            , simple_op<Opt, read_reg_op(REGF_A | REGF_X | REGF_Y)>
+            , div8_op<Opt>
+            , simple_op<Opt, write_reg_op(REGF_ISEL & ~REGF_X)>
+            , store<Opt, STA, p_def, p_def>
+            >(cpu, prev, cont);
+
+            chain
+            < load_AX<Opt, p_lhs, p_rhs>
+            , load_Y<Opt::restrict_to<~REGF_AX>, p_arg<2>>
+            , simple_op<Opt, read_reg_op(REGF_A | REGF_X | REGF_Y)>
+            , div8_op<Opt>
+            , simple_op<Opt, write_reg_op(REGF_ISEL & ~REGF_X)>
+            , store<Opt, STA, p_def, p_def>
+            >(cpu, prev, cont);
+            break;
+
+        case SSA_div8_rem:
+            store<Opt, STY, p_def, p_def>(cpu, prev, cont);
+            break;
+
         case SSA_and:
             commutative(h, [&]()
             {
@@ -5101,15 +5209,66 @@ std::size_t select_instructions(log_t* log, fn_t& fn, ir_t& ir)
     static TLS std::vector<rh::apair<cross_cpu_t, isel_cost_t>> new_out_states;
 
     bool const sloppy = fn.sloppy();
-    unsigned const BASE_SEL_SIZE = sloppy ? 2 : 32;
-    unsigned const BASE_MAP_SIZE = sloppy ? 4 : 128;
+    constexpr unsigned MIN_SEL_SIZE = 2;
+    constexpr unsigned MIN_MAP_SIZE = 4;
+    unsigned const BASE_SEL_SIZE = sloppy ? MIN_SEL_SIZE : 32;
+    unsigned const BASE_MAP_SIZE = sloppy ? MIN_MAP_SIZE : 128;
     auto const SELS_COST_BOUND = sloppy ? cost_fn(NOP_IMPLIED) / 2 : cost_fn(LDA_ABSOLUTE) * 2;
 
+    // The beam is widened for small and hot functions, as they can afford it,
+    // then narrowed as the time budget runs out.
+    // Narrowing never fails the search; it only makes the rest of it greedier.
+    unsigned const widen = !sloppy && (ir.ssa_size() <= 64 || (compiler_options().tiered && tier_hot(fn.global.name)));
+    unsigned narrow = 0;
+
+    auto const sel_size = [&]() { return std::max<unsigned>((BASE_SEL_SIZE << widen) >> narrow, MIN_SEL_SIZE); };
+    auto const map_size = [&]() { return std::max<unsigned>((BASE_MAP_SIZE << widen) >> narrow, MIN_MAP_SIZE); };
+
+    using clock = std::chrono::steady_clock;
+    auto const start_time = clock::now();
+    unsigned const budget_ms = compiler_options().isel_budget_ms;
+
+    // Returns true if the beam was narrowed.
+    auto const check_budget = [&]() -> bool
+    {
+        if(!budget_ms || sloppy)
+            return false;
+
+        auto const elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(clock::now() - start_time).count();
+
+        // Halve the beam at half the budget, then drop to the minimum once it's spent.
+        unsigned new_narrow = 0;
+        if(elapsed >= budget_ms)
+            new_narrow = 8;
+        else if(elapsed >= budget_ms / 2)
+            new_narrow = 1;
+
+        if(new_narrow <= narrow)
+            return false;
+        narrow = new_narrow;
+        return true;
+    };
+
+    auto const cfg_map_size = [&](cfg_ht cfg) -> unsigned
+    {
+        unsigned max_map_size = std::min<unsigned>(1 + loop_depth(cfg), 4) * map_size();
+
+        // Shrink the map size for large CFG nodes:
+        if(cfg->ssa_size() > 64)
+        {
+            max_map_size *= 64;
+            max_map_size /= cfg->ssa_size();
+            max_map_size = std::max<unsigned>(map_size() / 2, max_map_size);
+        }
+
+        return max_map_size;
+    };
+
     auto const shrink_sels = [&](cfg_ht cfg)
     {
         auto& d = data(cfg);
 
-        unsigned max_sels = std::min<unsigned>(1 + loop_depth(cfg), 4) * BASE_SEL_SIZE;
+        unsigned max_sels = std::min<unsigned>(1 + loop_depth(cfg), 4) * sel_size();
 
         if(d.sels.size() > max_sels)
         {
@@ -5189,15 +5348,8 @@ std::size_t select_instructions(log_t* log, fn_t& fn, ir_t& ir)
                     asm_inst_t{ .op = ASM_PRUNED, .arg = locator_t::index(index) }) });
         }
 
-        state.max_map_size = std::min<unsigned>(1 + loop_depth(cfg), 4) * BASE_MAP_SIZE;
-
-        // Shrink the map size for large CFG nodes:
-        if(cfg->ssa_size() > 64)
-        {
-            state.max_map_size *= 64;
-            state.max_map_size /= cfg->ssa_size();
-            state.max_map_size = std::max<unsigned>(BASE_MAP_SIZE / 2, state.max_map_size);
-        }
+        check_budget();
+        state.max_map_size = cfg_map_size(cfg);
 
         // Modes get stack instructions:
         if(cfg == ir.root && state.fn->fclass == FN_MODE)
@@ -5217,6 +5369,11 @@ std::size_t select_instructions(log_t* log, fn_t& fn, ir_t& ir)
         for(unsigned i = 0; i < schedule.size(); ++i)
         {
             ssa_ht h = schedule[i];
+
+            // Large CFG nodes can use up the budget on their own:
+            if(i % 16 == 15 && check_budget())
+                state.max_map_size = std::min(state.max_map_size, cfg_map_size(cfg));
+
             try
             {
 #ifndef NDEBUG
@@ -5587,7 +5744,7 @@ std::size_t select_instructions(log_t* log, fn_t& fn, ir_t& ir)
 #endif
 
     {
-        pbqp_t pbqp(state.log);
+        pbqp_t pbqp(state.log, compiler_options().isel_exact);
 
         for(cfg_ht cfg = ir.cfg_begin(); cfg; ++cfg)
         {
@@ -5651,6 +5808,20 @@ std::size_t select_instructions(log_t* log, fn_t& fn, ir_t& ir)
         pbqp.solve(std::move(pbqp_order));
     }
 
+    if(std::ostream* os = fn.info_stream())
+    {
+        isel_cost_t cost = 0;
+        for(cfg_ht cfg = ir.cfg_begin(); cfg; ++cfg)
+            cost += data(cfg).final_cost();
+
+        *os << "\nISEL_BEAM " << fn.global.name << '\n';
+        *os << "  beam:    " << (BASE_SEL_SIZE << widen) << " sels, " << (BASE_MAP_SIZE << widen) << " states\n";
+        if(narrow)
+            *os << "  narrowed to: " << sel_size() << " sels, " << map_size() << " states\n";
+        *os << "  cost:    " << cost << '\n';
+        *os << "  time:    " << std::chrono::duration_cast<std::chrono::milliseconds>(clock::now() - start_time).count() << " ms\n";
+    }
+
     ///////////////////////////
     // PREPARE SWITCH TABLES //
     ///////////////////////////
@@ -5916,6 +6087,32 @@ std::size_t select_instructions(log_t* log, fn_t& fn, ir_t& ir)
     graph.remove_maybes(fn);
     graph.optimize_live_registers();
 
+    // Pass one-byte arguments and returns in registers, where possible.
+    // Callees are compiled first, so their convention is known here.
+    unsigned num_calls = 0;
+    unsigned num_reg_conv_calls = 0;
+    reg_conv_t const reg_conv = graph.build_reg_conv(fn);
+    graph.apply_reg_conv(num_calls, num_reg_conv_calls);
+    if(reg_conv || num_reg_conv_calls)
+    {
+        graph.optimize_live_registers();
+        if(graph.o_reg_conv_stores())
+            graph.optimize_live_registers();
+    }
+    fn.assign_reg_conv(reg_conv);
+    fn.assign_num_calls(num_calls, num_reg_conv_calls);
+
+    if(std::ostream* os = fn.info_stream())
+    {
+        *os << "\nREG_CONV " << fn.global.name << '\n';
+        for(unsigned i = 0; i < reg_conv.args.size(); ++i)
+            if(reg_conv.args[i])
+                *os << "    " << "AXY"[i] << ": " << reg_conv.args[i] << '\n';
+        if(reg_conv.ret)
+            *os << "    return A: " << reg_conv.ret << '\n';
+        *os << "    calls: " << num_reg_conv_calls << " of " << num_calls << '\n';
+    }
+
     lvars_manager_t lvars = graph.build_lvars(fn);
 
     asm_proc_t asm_proc(fn.handle(), graph.to_linear(graph.order()), graph.entry_label());
@@ -26,7 +26,7 @@ static inline cfg_liveness_d& live(cfg_ht h)
 
 static void _live_visit(ssa_ht def, cfg_ht cfg_node)
 {
-    if(def->cfg_node() == cfg_node)
+    if(def.hot().cfg == cfg_node)
         return;
 
     if(bitset_test(live(cfg_node).in, def.id))
@@ -53,25 +53,25 @@ void calc_ssa_liveness(ssa_ht node)
     for(unsigned i = 0; i < output_size; ++i)
     {
         auto const oe = node->output_edge(i);
-        cfg_ht const ocfg = oe.handle->cfg_node();
+        ssa_hot_t const& output = oe.handle.hot();
 
         // We only care about values
         if(oe.input_class() != INPUT_VALUE)
             continue;
 
-        if(oe.handle->op() == SSA_phi)
+        if(output.op == SSA_phi)
         {
             assert(node->op() == SSA_phi_copy);
-            assert(node->cfg_node() == ocfg->input(oe.index));
+            assert(node->cfg_node() == output.cfg->input(oe.index));
 
             //bitset_set(live(ocfg).in, node.index);
-            bitset_set(live(node->cfg_node()).out, node.id);
+            bitset_set(live(node.hot().cfg).out, node.id);
             //_live_visit(node, node->cfg_node());
         }
         else
         {
             assert(node->op() != SSA_phi_copy);
-            _live_visit(node, ocfg);
+            _live_visit(node, output.cfg);
         }
     }
 }
@@ -1,5 +1,6 @@
 #include "cg_ptr.hpp"
 
+#include <atomic>
 #include <vector>
 
 #include "robin/set.hpp"
@@ -16,11 +17,24 @@
 
 using inputs_int_t = std::uint64_t;
 
+namespace
+{
+    std::atomic<unsigned> switch_count = 0;
+    std::atomic<unsigned> preloaded_count = 0;
+    std::atomic<unsigned> after_call_count = 0;
+}
+
+bank_switch_stats_t bank_switch_stats()
+{
+    return { switch_count.load(), preloaded_count.load(), after_call_count.load() };
+}
+
 struct cg_hoist_d
 {
     ssa_value_t banks;
     ssa_value_t header_banks;
     inputs_int_t inputs = 0;
+    bool header_accesses = false; // If the loop uses 'header_banks' for more than calls.
 };
 
 bool cg_hoist_bank_switches(fn_t const& fn, ir_t& ir)
@@ -40,18 +54,27 @@ bool cg_hoist_bank_switches(fn_t const& fn, ir_t& ir)
 
         // Determine if this CFG node uses a single bank:
         ssa_value_t cfg_bank = {};
+        bool accesses = false;
         for(ssa_ht ssa = cfg->ssa_begin(); ssa; ++ssa)
         {
+            ssa_value_t ssa_bank = {};
+
             if(clobbers_unknown_bank(fn, *ssa))
             {
-                cfg_bank = MANY_BANKS;
-                break;
+                // Calls that return with a known bank act like a switch to it.
+                if(locator_t const exit = bank_after_call(fn, *ssa))
+                    ssa_bank = exit;
+                else
+                {
+                    cfg_bank = MANY_BANKS;
+                    break;
+                }
+            }
+            else if(ssa_banks(ssa->op()))
+            {
+                ssa_bank = orig_def(ssa->input(ssa_bank_input(ssa->op())));
+                accesses |= bool(ssa_bank);
             }
-
-            if(!ssa_banks(ssa->op()))
-                continue;
-
-            ssa_value_t const ssa_bank = orig_def(ssa->input(ssa_bank_input(ssa->op())));
 
             if(!ssa_bank)
                 continue;
@@ -79,6 +102,8 @@ bool cg_hoist_bank_switches(fn_t const& fn, ir_t& ir)
                 hd.header_banks = cfg_bank;
             else if(cfg_bank != hd.header_banks)
                 hd.header_banks = MANY_BANKS;
+
+            hd.header_accesses |= accesses;
         }
     }
 
@@ -90,6 +115,10 @@ bool cg_hoist_bank_switches(fn_t const& fn, ir_t& ir)
         if(!d.header_banks || d.header_banks == MANY_BANKS)
             continue;
 
+        // Calls already leave the bank loaded, so there's nothing to hoist.
+        if(!d.header_accesses)
+            continue;
+
         // Don't bother with loops that have a re-entry point.
         if(algo(header).reentry_in)
             continue;
@@ -151,6 +180,11 @@ locator_t cg_calc_bank_switches(fn_ht fn, ir_t& ir)
 
     array_pool_t<bitset_uint_t> bs_pool;
 
+    unsigned after_call = 0;
+
+    // Tracks CFG nodes whose last bank was left loaded by a call:
+    bitset_uint_t* const ends_after_call = bs_pool.alloc(bitset_size<>(cfg_pool::array_size()));
+
     // Identify all banks:
     rh::batman_set<ssa_value_t> banks;
     banks.insert(ssa_value_t()); // Dummy value.
@@ -166,18 +200,27 @@ locator_t cg_calc_bank_switches(fn_ht fn, ir_t& ir)
         d.banks.last = -1;
 
         ssa_value_t prev_bank = {};
+        bool prev_from_call = false;
 
         for(ssa_ht ssa : d.schedule)
         {
             assert(ssa->test_flags(FLAG_BANK_PRELOADED) == false);
 
             ssa_value_t bank;
+            bool from_call = false;
 
             if(clobbers_unknown_bank(*fn, *ssa))
             {
                 // This op clobbers banks.
-                // We'll mark it using the unique ssa_value 'ssa':
-                bank = ssa;
+                // If it's a call that returns with a known bank, we'll use that.
+                // Otherwise, we'll mark it using the unique ssa_value 'ssa':
+                if(locator_t const exit = bank_after_call(*fn, *ssa))
+                {
+                    bank = exit;
+                    from_call = true;
+                }
+                else
+                    bank = ssa;
                 goto have_bank;
             }
 
@@ -190,7 +233,11 @@ locator_t cg_calc_bank_switches(fn_ht fn, ir_t& ir)
                 continue;
 
             if(bank == prev_bank)
+            {
                 ssa->set_flags(FLAG_BANK_PRELOADED);
+                after_call += prev_from_call;
+                from_call = prev_from_call;
+            }
 
         have_bank:
 
@@ -206,11 +253,17 @@ locator_t cg_calc_bank_switches(fn_ht fn, ir_t& ir)
             }
 
             prev_bank = bank;
+            prev_from_call = from_call;
         }
+
+        if(prev_from_call)
+            bitset_set(ends_after_call, cfg.id);
     }
 
     // Init bitsets:
     unsigned const bs_size = bitset_size<>(banks.size());
+    bitset_uint_t* const call_banks = bs_pool.alloc(bs_size);
+    bitset_uint_t* const switch_banks = bs_pool.alloc(bs_size);
     for(cfg_ht cfg = ir.cfg_begin(); cfg; ++cfg)
     {
         auto& d = cg_data(cfg).banks;
@@ -223,6 +276,7 @@ locator_t cg_calc_bank_switches(fn_ht fn, ir_t& ir)
         {
             bitset_set(d.in, d.first);
             bitset_set(d.out, d.last);
+            bitset_set(bitset_test(ends_after_call, cfg.id) ? call_banks : switch_banks, d.last);
         }
     }
 
@@ -376,8 +430,65 @@ locator_t cg_calc_bank_switches(fn_ht fn, ir_t& ir)
             assert(d.first_ssa);
             assert(!d.first_ssa->test_flags(FLAG_BANK_PRELOADED));
             d.first_ssa->set_flags(FLAG_BANK_PRELOADED);
+
+            // Only count it as a call's doing if nothing else loads it.
+            if(ssa_banks(d.first_ssa->op()) && popcount == 1
+               && bitset_test(call_banks, d.first) && !bitset_test(switch_banks, d.first))
+            {
+                ++after_call;
+            }
+        }
+    }
+
+    // Find the bank every return leaves loaded, for our callers to use:
+    locator_t exit_bank = {};
+    if(fn->fclass == FN_FN && mod_test(fn->mods(), MOD_static))
+    {
+        bitset_clear_all(bs_size, bs_temp);
+
+        for(cfg_ht cfg = ir.cfg_begin(); cfg; ++cfg)
+            if(cfg->output_size() == 0 && cfg->last_daisy() && cfg->last_daisy()->op() == SSA_return)
+                bitset_or(bs_size, bs_temp, cg_data(cfg).banks.out);
+
+        if(bitset_popcount(bs_size, bs_temp) == 1)
+        {
+            ssa_value_t const bank = banks.begin()[bitset_lowest_bit_set(bs_size, bs_temp)];
+
+            // Only constant banks mean the same thing to our callers.
+            if(bank.is_locator() && !is_var_like(bank.locator().lclass()) 
+               && bank.locator().lclass() != LOC_THIS_BANK)
+            {
+                exit_bank = bank.locator();
+            }
         }
     }
+    fn->assign_exit_bank(exit_bank);
+
+    unsigned switches = 0;
+    unsigned preloaded = 0;
+    for(cfg_ht cfg = ir.cfg_begin(); cfg; ++cfg)
+    for(ssa_ht ssa = cfg->ssa_begin(); ssa; ++ssa)
+    {
+        if(!ssa_banks(ssa->op()) || !ssa->input(ssa_bank_input(ssa->op())))
+            continue;
+        if(ssa->test_flags(FLAG_BANK_PRELOADED))
+            ++preloaded;
+        else
+            ++switches;
+    }
+    switch_count += switches;
+    preloaded_count += preloaded;
+    after_call_count += after_call;
+
+    if(std::ostream* os = fn->info_stream())
+    {
+        *os << "\nBANK_SWITCHES " << fn->global.name << '\n';
+        *os << "  emitted:        " << switches << '\n';
+        *os << "  already loaded: " << preloaded << '\n';
+        *os << "  after calls:    " << after_call << '\n';
+        if(exit_bank)
+            *os << "  exit bank:      " << exit_bank << '\n';
+    }
 
     return first_bank_switch_loc;
 }
@@ -14,6 +14,17 @@ bool cg_hoist_bank_switches(fn_t const& fn, ir_t& ir);
 // Sets FLAG_BANK_PRELOADED on SSA nodes that don't need to bankswitch,
 // and returns the dominating bankswitch in the IR.
 // A.K.A. the optimal bank the function should be in when called.
+// Also assigns the fn's exit bank, which lets callers skip switching back to it.
 locator_t cg_calc_bank_switches(fn_ht fn, ir_t& ir);
 
+// Totals of 'cg_calc_bank_switches', across every fn.
+struct bank_switch_stats_t
+{
+    unsigned switches = 0;  // Bank switches left in the code.
+    unsigned preloaded = 0; // Bank switches removed, as their bank was already loaded.
+    unsigned after_call = 0; // Of those removed, ones whose bank a call returned with.
+};
+
+bank_switch_stats_t bank_switch_stats();
+
 #endif
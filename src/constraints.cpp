@@ -1,6 +1,7 @@
 #include "constraints.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <string>
 #include <sstream>
 #ifndef NDEBUG
@@ -11,7 +12,6 @@
 #include "format.hpp"
 #include "type_mask.hpp"
 
-extern std::uint8_t const add_constraints_table[1024];
 
 std::string to_string(constraints_mask_t const& cm)
 {
@@ -274,6 +274,53 @@ constraints_t union_(constraints_t a, constraints_t b)
     };
 }
 
+bounds_t widen(bounds_t prev, bounds_t next, constraints_mask_t cm)
+{
+    if(prev.is_top())
+        return next;
+    if(next.is_top())
+        return prev;
+    bounds_t const limit = bounds_t::bottom(cm);
+    return 
+    {
+        next.min < prev.min ? limit.min : prev.min,
+        next.max > prev.max ? limit.max : prev.max,
+    };
+}
+
+constraints_t widen(constraints_t prev, constraints_t next, constraints_mask_t cm)
+{
+    // Known bits form a finite lattice, so a union is sufficient.
+    return 
+    { 
+        widen(prev.bounds, next.bounds, cm),
+        union_(prev.bits, next.bits),
+    };
+}
+
+bounds_t narrow(bounds_t prev, bounds_t next, constraints_mask_t cm)
+{
+    if(prev.is_top() || next.is_top())
+        return prev;
+    bounds_t const limit = bounds_t::bottom(cm);
+    return 
+    {
+        prev.min == limit.min ? std::max(prev.min, next.min) : prev.min,
+        prev.max == limit.max ? std::min(prev.max, next.max) : prev.max,
+    };
+}
+
+constraints_t narrow(constraints_t prev, constraints_t next, constraints_mask_t cm)
+{
+    if(next.bits.is_top())
+        return { narrow(prev.bounds, next.bounds, cm), prev.bits };
+    return 
+    { 
+        narrow(prev.bounds, next.bounds, cm),
+        intersect(prev.bits, next.bits),
+    };
+}
+
 bool is_subset(bounds_t small, bounds_t big)
 {
     if(big.is_top())
@@ -396,6 +443,237 @@ bool any_top(constraints_def_t const& def)
     return false;
 }
 
+known_bits_t add_bits(known_bits_t lhs, known_bits_t rhs, known_bits_t carry,
+                      constraints_mask_t cm, carry_t* carry_out)
+{
+    assert(is_mask(cm.mask));
+    assert(lhs.in_mask(cm));
+    assert(rhs.in_mask(cm));
+    assert(above_mask(cm.mask)); // Need a bit to hold the carry.
+
+    // Treat unknown bits as the range [0, unknown].
+    // Adding the unknown bits to the known sum will flip every bit
+    // an unknown carry can reach.
+    // See: "Sound, Precise, and Fast Abstract Interpretation with Tristate Numbers"
+    fixed_uint_t const lhs_unknown = ~lhs.known();
+    fixed_uint_t const rhs_unknown = ~rhs.known();
+    fixed_uint_t const carry_unknown = ~carry.known() & cm.mask;
+
+    fixed_uint_t const sum = lhs.known1 + rhs.known1 + carry.known1;
+    fixed_uint_t const sum_unknown = lhs_unknown + rhs_unknown + carry_unknown;
+    fixed_uint_t const unknown = ((sum + sum_unknown) ^ sum) | lhs_unknown | rhs_unknown | carry_unknown;
+
+    if(carry_out)
+    {
+        fixed_uint_t const carry_bit = high_bit_only(cm.mask) << 1ull;
+        *carry_out = (unknown & carry_bit) ? CARRY_BOTTOM : (sum & carry_bit) ? CARRY_SET : CARRY_CLEAR;
+    }
+
+    return { ~(sum | unknown) | ~cm.mask, sum & ~unknown & cm.mask };
+}
+
+void constraints_soa_t::resize(std::size_t size)
+{
+    min.resize(size);
+    max.resize(size);
+    known0.resize(size);
+    known1.resize(size);
+}
+
+void constraints_soa_t::assign(std::size_t size, constraints_t c)
+{
+    min.assign(size, c.bounds.min);
+    max.assign(size, c.bounds.max);
+    known0.assign(size, c.bits.known0);
+    known1.assign(size, c.bits.known1);
+}
+
+void constraints_soa_t::load(constraints_vec_t const& vec, std::size_t size)
+{
+    assert(size <= vec.size());
+    resize(size);
+    for(std::size_t i = 0; i < size; ++i)
+        set(i, vec[i]);
+}
+
+void constraints_soa_t::store(constraints_vec_t& vec) const
+{
+    vec.resize(size());
+    for(std::size_t i = 0; i < size(); ++i)
+        vec[i] = get(i);
+}
+
+// The batch functions below mirror their scalar counterparts,
+// but select results using conditional moves rather than branches.
+
+void batch_apply_mask(constraints_soa_t& a, constraints_mask_t cm)
+{
+    assert(is_mask(cm.mask));
+
+    bounds_t const bottom = bounds_t::bottom(cm);
+    bounds_t const top = bounds_t::top();
+    known_bits_t const top_bits = known_bits_t::top();
+    std::size_t const size = a.size();
+
+    fixed_sint_t* const min = a.min.data();
+    fixed_sint_t* const max = a.max.data();
+    fixed_uint_t* const known0 = a.known0.data();
+    fixed_uint_t* const known1 = a.known1.data();
+
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        fixed_sint_t lo = min[i];
+        fixed_sint_t hi = max[i];
+        bool const is_top = lo > hi;
+        bool const below = lo < bottom.min;
+
+        if(!cm.signed_)
+        {
+            fixed_uint_t const span = hi - lo;
+            lo &= cm.mask;
+            hi = lo + span;
+        }
+
+        bool const use_bottom = below | (hi > bottom.max);
+        min[i] = is_top ? top.min : use_bottom ? bottom.min : lo;
+        max[i] = is_top ? top.max : use_bottom ? bottom.max : hi;
+
+        bool const bits_top = (known0[i] & known1[i]) != 0;
+        known0[i] = bits_top ? top_bits.known0 : (known0[i] | ~cm.mask);
+        known1[i] = bits_top ? top_bits.known1 : (known1[i] & cm.mask);
+    }
+}
+
+void batch_from_bits(constraints_soa_t& a, constraints_mask_t cm)
+{
+    assert(is_mask(cm.mask));
+
+    bounds_t const bottom = bounds_t::bottom(cm);
+    bounds_t const top = bounds_t::top();
+    fixed_uint_t const sign_bit = cm.signed_ ? high_bit_only(cm.mask) : 0;
+    fixed_sint_t const complement = static_cast<fixed_sint_t>(sign_bit << 1);
+    std::size_t const size = a.size();
+
+    fixed_sint_t* const min = a.min.data();
+    fixed_sint_t* const max = a.max.data();
+    fixed_uint_t const* const known0 = a.known0.data();
+    fixed_uint_t const* const known1 = a.known1.data();
+
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        fixed_uint_t const k0 = known0[i];
+        fixed_uint_t const k1 = known1[i];
+
+        bool const is_top = (k0 & k1) != 0;
+        bool const neg = k1 & sign_bit;
+        bool const pos = k0 & sign_bit;
+
+        // Unsigned or negative:
+        fixed_sint_t lo = (k1 & cm.mask) - (neg ? complement : 0);
+        fixed_sint_t hi = (~k0 & cm.mask) - (neg ? complement : 0);
+
+        // Positive:
+        lo = pos ? k1 : lo;
+        hi = pos ? ~k0 : hi;
+
+        // Positive or negative:
+        bool const either = sign_bit && !neg && !pos;
+        lo = either ? (bottom.min | k1) : lo;
+        hi = either ? (bottom.max & ~k0) : hi;
+
+        min[i] = is_top ? top.min : lo;
+        max[i] = is_top ? top.max : hi;
+    }
+}
+
+void batch_from_bounds(constraints_soa_t& a, constraints_mask_t cm)
+{
+    assert(is_mask(cm.mask));
+    assert(~cm.mask);
+
+    known_bits_t const top = known_bits_t::top();
+    std::size_t const size = a.size();
+
+    fixed_sint_t const* const min = a.min.data();
+    fixed_sint_t const* const max = a.max.data();
+    fixed_uint_t* const known0 = a.known0.data();
+    fixed_uint_t* const known1 = a.known1.data();
+
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        // Find upper bits that are the same.
+        fixed_uint_t const x = (fixed_uint_t(min[i]) ^ fixed_uint_t(max[i])) & cm.mask;
+        fixed_uint_t const low_mask = ~((1ull << std::bit_width(x)) - 1ull);
+
+        bool const is_top = min[i] > max[i];
+        known0[i] = is_top ? top.known0 : ((~min[i] & low_mask) | ~cm.mask);
+        known1[i] = is_top ? top.known1 : ((min[i] & low_mask) & cm.mask);
+    }
+}
+
+void batch_intersect(constraints_soa_t& a, constraints_soa_t const& b)
+{
+    assert(a.size() == b.size());
+    std::size_t const size = a.size();
+
+    fixed_sint_t* const min = a.min.data();
+    fixed_sint_t* const max = a.max.data();
+    fixed_uint_t* const known0 = a.known0.data();
+    fixed_uint_t* const known1 = a.known1.data();
+
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        min[i] = std::max(min[i], b.min[i]);
+        max[i] = std::min(max[i], b.max[i]);
+        known0[i] |= b.known0[i];
+        known1[i] |= b.known1[i];
+    }
+}
+
+void batch_union(constraints_soa_t& a, constraints_soa_t const& b)
+{
+    assert(a.size() == b.size());
+    std::size_t const size = a.size();
+
+    fixed_sint_t* const min = a.min.data();
+    fixed_sint_t* const max = a.max.data();
+    fixed_uint_t* const known0 = a.known0.data();
+    fixed_uint_t* const known1 = a.known1.data();
+
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        bool const a_top = min[i] > max[i];
+        bool const b_top = b.min[i] > b.max[i];
+        min[i] = a_top ? b.min[i] : b_top ? min[i] : std::min(min[i], b.min[i]);
+        max[i] = a_top ? b.max[i] : b_top ? max[i] : std::max(max[i], b.max[i]);
+
+        bool const a_bits_top = (known0[i] & known1[i]) != 0;
+        bool const b_bits_top = (b.known0[i] & b.known1[i]) != 0;
+        known0[i] = a_bits_top ? b.known0[i] : b_bits_top ? known0[i] : (known0[i] & b.known0[i]);
+        known1[i] = a_bits_top ? b.known1[i] : b_bits_top ? known1[i] : (known1[i] & b.known1[i]);
+    }
+}
+
+void batch_add_bits(constraints_soa_t& a, constraints_soa_t const& lhs,
+                    constraints_soa_t const& rhs, constraints_soa_t const& carry,
+                    constraints_mask_t cm)
+{
+    assert(a.size() == lhs.size());
+    assert(a.size() == rhs.size());
+    assert(a.size() == carry.size());
+    std::size_t const size = a.size();
+
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        known_bits_t const bits = add_bits(
+            { lhs.known0[i], lhs.known1[i] },
+            { rhs.known0[i], rhs.known1[i] },
+            { carry.known0[i], carry.known1[i] }, cm);
+        a.known0[i] = bits.known0;
+        a.known1[i] = bits.known1;
+    }
+}
+
 static bool any_top(constraints_def_t const* cv, unsigned argn)
 {
     for(unsigned i = 0; i < argn; ++i)
@@ -454,6 +732,8 @@ ABSTRACT(SSA_read_array16_b) = abstract_bottom;
 ABSTRACT(SSA_write_array16_b) = abstract_bottom;
 ABSTRACT(SSA_mul8_lo) = abstract_bottom;
 ABSTRACT(SSA_mul8_hi) = abstract_bottom;
+ABSTRACT(SSA_div8) = abstract_bottom;
+ABSTRACT(SSA_div8_rem) = abstract_bottom;
 ABSTRACT(SSA_read_mapper_state) = abstract_bottom;
 ABSTRACT(SSA_write_mapper_state) = abstract_bottom;
 ABSTRACT(SSA_nmi_counter) = abstract_bottom;
@@ -683,63 +963,18 @@ void abstract_add_sub(constraints_def_t const* cv, unsigned argn, constraints_de
     // If we know bits in L and R, we can determine which bits are
     // known in the output.
     //
-    // SLOW BUT ACCURATE TECHNIQUE (used)
     // - Treat constraints as ternary. Trits can be 0, 1, or ? (unknown value).
-    // - Add using the standard arithmetic algorithm, starting at the
-    //   rightmost bit and working left, carrying as you go.
-    // - When adding to a ?, the output trit is always ?, and the carry 
-    //   depends on the other value. Carrying a ? is allowed!
-    // - Performance is improved slightly by using lookup tables.
-    //
-    // FAST BUT INACCURATE TECHNIQUE (not used)
-    // - If the rightmost bits of both L and R are known, we know
-    //   the rightmost bits of the output.
-    // - If we know both bits along with the carry, we know the outpit bit.
-    //   (The carry is known when L bit == R bit.)
-    //
-    // (FAST is about 10x faster than SLOW)
+    // - Adding to a ? makes the output trit ?, and the carry can become ? too.
+    // - Rather than rippling the carry one trit at a time,
+    //   'add_bits' computes every trit at once using integer addition.
 
     value = {};
 
-    fixed_uint_t const neg_mask = ~(L.bits.known0 & R.bits.known0 & shifted_C.bits.known0) & cm.mask;
-    std::uint64_t const start_i = neg_mask ? (builtin::ctz(neg_mask) & ~1ull): 0;
-    std::uint64_t const end_i = ((1 + (cm.mask ? builtin::rclz(cm.mask) : sizeof_bits<fixed_uint_t>)) & ~1ull);
-    value.bits.known0 = (1ull << start_i) - 1ull;
-
-    known_bits_t lhs_bits = L.bits;
-    known_bits_t rhs_bits = R.bits;
-
-    lhs_bits.known0 >>= start_i;
-    lhs_bits.known1 >>= start_i;
-    rhs_bits.known0 >>= start_i;
-    rhs_bits.known1 >>= start_i;
-
-    fixed_uint_t i = start_i;
-    // 'j' holds the carry.
-    fixed_uint_t j = C.to_carry();
-    assert(j <= 4);
-    assert(C.to_carry() != CARRY_TOP);
-    for(; i < end_i; i += 2ull)
-    {
-        j |= (lhs_bits.known0 & 0b11) << 2ull;
-        j |= (lhs_bits.known1 & 0b11) << 4ull;
-        j |= (rhs_bits.known0 & 0b11) << 6ull;
-        j |= (rhs_bits.known1 & 0b11) << 8ull;
-
-        j = add_constraints_table[j];
-        value.bits.known0 |= ((j >> 2ull) & 0b11ull) << i;
-        value.bits.known1 |= ((j >> 4ull) & 0b11ull) << i;
-        j &= 0b11;
-
-        lhs_bits.known0 >>= 2ull;
-        lhs_bits.known1 >>= 2ull;
-        rhs_bits.known0 >>= 2ull;
-        rhs_bits.known1 >>= 2ull;
-    }
-    assert((carry_t)j != CARRY_TOP);
-    carry = constraints_t::carry((carry_t)j);
-    if(i < sizeof_bits<fixed_uint_t>)
-        value.bits.known0 |= ~((1ull << i) - 1ull);
+    carry_t carry_out;
+    value.bits = add_bits(L.bits, R.bits, shifted_C.bits, cm, &carry_out);
+    assert(carry_out != CARRY_TOP);
+    carry = constraints_t::carry(carry_out);
+    fixed_uint_t const j = carry_out;
 
     value.bits = apply_mask(value.bits, cm);
     assert(!value.bits.is_top());
@@ -854,6 +1089,73 @@ ABSTRACT(SSA_mul) = ABSTRACT_FN
     assert(result[0].is_normalized(result.cm));
 };
 
+// Division and modulo are only defined for unsigned integers.
+// Matching the run-time routine, dividing by zero yields all ones,
+// while the remainder is the low byte of the dividend.
+template<bool Mod>
+static constexpr auto abstract_div_mod = ABSTRACT_FN
+{
+    passert(argn == 2 && result.vec.size() >= 1, argn, result.vec.size());
+
+    if(handle_top(cv, argn, result))
+        return;
+
+    auto const& L = cv[0][0];
+    auto const& R = cv[1][0];
+
+    if(result.cm.signed_ || cv[0].cm.signed_ || cv[1].cm.signed_)
+    {
+        result[0] = constraints_t::bottom(result.cm);
+        return;
+    }
+
+    fixed_uint_t const l_min = fixed_uint_t(L.bounds.min) >> fixed_t::shift;
+    fixed_uint_t const l_max = fixed_uint_t(L.bounds.max) >> fixed_t::shift;
+    fixed_uint_t const r_min = fixed_uint_t(R.bounds.min) >> fixed_t::shift;
+    fixed_uint_t const r_max = fixed_uint_t(R.bounds.max) >> fixed_t::shift;
+
+    if(r_max == 0)
+    {
+        if(!Mod)
+            result[0] = constraints_t::const_(result.cm.mask, result.cm);
+        else if(L.is_const())
+            result[0] = constraints_t::const_(L.bounds.min & (0xFFull << fixed_t::shift) & result.cm.mask, result.cm);
+        else
+            result[0] = constraints_t::bottom(result.cm);
+        return;
+    }
+
+    if(r_min == 0)
+    {
+        result[0] = constraints_t::bottom(result.cm);
+        return;
+    }
+
+    if(Mod)
+    {
+        if(l_max < r_min)
+        {
+            result[0] = L;
+            return;
+        }
+
+        if(L.is_const() && R.is_const())
+            result[0].bounds = bounds_t::whole(l_min % r_min);
+        else
+            result[0].bounds = { 0, fixed_sint_t(std::min(l_max, r_max - 1) << fixed_t::shift) };
+    }
+    else
+        result[0].bounds = { fixed_sint_t((l_min / r_max) << fixed_t::shift), 
+                             fixed_sint_t((l_max / r_min) << fixed_t::shift) };
+
+    result[0].bits = from_bounds(result[0].bounds, result.cm);
+    result[0] = normalize(result[0], result.cm);
+    assert(result[0].is_normalized(result.cm));
+};
+
+ABSTRACT(SSA_div) = abstract_div_mod<false>;
+ABSTRACT(SSA_mod) = abstract_div_mod<true>;
+
 constraints_t abstract_eq(constraints_t lhs, constraints_mask_t lhs_cm, 
                           constraints_t rhs, constraints_mask_t rhs_cm,
                           bool sign_diff)
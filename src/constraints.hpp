@@ -53,6 +53,17 @@ bounds_t union_(bounds_t a, bounds_t b);
 known_bits_t union_(known_bits_t a, known_bits_t b);
 constraints_t union_(constraints_t a, constraints_t b);
 
+// Widening operators, for use by abstract interpretation.
+// The result contains both 'prev' and 'next', with unstable bounds 
+// jumping straight to the limits of 'cm'.
+bounds_t widen(bounds_t prev, bounds_t next, constraints_mask_t cm);
+constraints_t widen(constraints_t prev, constraints_t next, constraints_mask_t cm);
+
+// Narrowing operators, the dual of the above.
+// Only refines the bounds of 'prev' which sit at the limits of 'cm'.
+bounds_t narrow(bounds_t prev, bounds_t next, constraints_mask_t cm);
+constraints_t narrow(constraints_t prev, constraints_t next, constraints_mask_t cm);
+
 // Fairly expensive; use sparingly.
 bool is_subset(bounds_t small, bounds_t big);
 bool is_subset(known_bits_t small, known_bits_t big);
@@ -292,6 +303,50 @@ bool all_normalized(constraints_def_t const& def);
 bool all_subset(constraints_vec_t const& a, constraints_vec_t const& b, constraints_mask_t cm);
 bool bit_eq(constraints_vec_t const& a, constraints_vec_t const& b);
 
+// Known bits of 'lhs + rhs + carry', where 'carry' is a shifted carry.
+// This is branch-free, but produces the same result as adding the bits
+// one trit at a time using a ternary ripple-carry.
+known_bits_t add_bits(known_bits_t lhs, known_bits_t rhs, known_bits_t carry,
+                      constraints_mask_t cm, carry_t* carry_out = nullptr);
+
+// Structure-of-arrays storage for many constraints at once,
+// to be used with the 'batch_' functions below.
+// These functions have no data-dependent branches, allowing the
+// compiler to vectorize them.
+struct constraints_soa_t
+{
+    bc::small_vector<fixed_sint_t, 4> min;
+    bc::small_vector<fixed_sint_t, 4> max;
+    bc::small_vector<fixed_uint_t, 4> known0;
+    bc::small_vector<fixed_uint_t, 4> known1;
+
+    std::size_t size() const { return min.size(); }
+
+    void resize(std::size_t size);
+    void assign(std::size_t size, constraints_t c);
+    void load(constraints_vec_t const& vec) { load(vec, vec.size()); }
+    void load(constraints_vec_t const& vec, std::size_t size);
+    void store(constraints_vec_t& vec) const;
+
+    constraints_t get(std::size_t i) const
+        { assert(i < size()); return {{ min[i], max[i] }, { known0[i], known1[i] }}; }
+    void set(std::size_t i, constraints_t c)
+        { assert(i < size()); min[i] = c.bounds.min; max[i] = c.bounds.max; known0[i] = c.bits.known0; known1[i] = c.bits.known1; }
+};
+
+// Each of these modifies 'a' in place, element-wise.
+void batch_apply_mask(constraints_soa_t& a, constraints_mask_t cm);
+void batch_from_bits(constraints_soa_t& a, constraints_mask_t cm);   // Sets bounds based on bits.
+void batch_from_bounds(constraints_soa_t& a, constraints_mask_t cm); // Sets bits based on bounds.
+void batch_intersect(constraints_soa_t& a, constraints_soa_t const& b);
+void batch_union(constraints_soa_t& a, constraints_soa_t const& b);
+
+// Sets the bits of 'a' to the bits of 'lhs + rhs + carry'.
+// Bounds are left unchanged.
+void batch_add_bits(constraints_soa_t& a, constraints_soa_t const& lhs,
+                    constraints_soa_t const& rhs, constraints_soa_t const& carry,
+                    constraints_mask_t cm);
+
 using abstract_fn_t = std::type_identity_t<
     void(constraints_def_t const*, unsigned, constraints_def_t&)>;
 extern std::array<abstract_fn_t*, NUM_SSA_OPS> const abstract_fn_table;
@@ -5,10 +5,12 @@
 #include <cstdlib>
 #include <ctime>
 #include <iostream> // TODO
+#include <vector>
 
 #include <boost/container/small_vector.hpp>
 
 #include "alloca.hpp"
+#include "builtin.hpp"
 #include "type_mask.hpp"
 
 namespace bc = ::boost::container;
@@ -294,6 +296,55 @@ TEST_CASE("union_", "[constraints]")
     }
 }
 
+TEST_CASE("widen", "[constraints]")
+{
+    for(unsigned signed_ = 0; signed_ < 2; ++signed_)
+    for(unsigned i = 0; i < TEST_ITER; ++i)
+    {
+        constraints_mask_t const cm = { 0xF << 4, signed_ };
+
+        constraints_t c1 = random_constraint(cm);
+        constraints_t c2 = random_constraint(cm);
+        constraints_t w = widen(c1, c2, cm);
+        for(fixed_uint_t i = 0; i <= 15; ++i)
+            if(c1(i<<4, cm) || c2(i<<4, cm))
+                REQUIRE(w(i<<4, cm));
+
+        // Unstable bounds go to the limits:
+        bounds_t const limit = bounds_t::bottom(cm);
+        if(c2.bounds.min < c1.bounds.min)
+            REQUIRE(w.bounds.min == limit.min);
+        if(c2.bounds.max > c1.bounds.max)
+            REQUIRE(w.bounds.max == limit.max);
+
+        REQUIRE(widen(c1, constraints_t::top(), cm).bit_eq(c1));
+        REQUIRE(widen(constraints_t::top(), c1, cm).bit_eq(c1));
+    }
+}
+
+TEST_CASE("narrow", "[constraints]")
+{
+    for(unsigned signed_ = 0; signed_ < 2; ++signed_)
+    for(unsigned i = 0; i < TEST_ITER; ++i)
+    {
+        constraints_mask_t const cm = { 0xF << 4, signed_ };
+
+        constraints_t c1 = random_constraint(cm);
+        constraints_t c2 = random_subset(c1, cm);
+        constraints_t w = widen(c2, c1, cm);
+        constraints_t n = narrow(w, c2, cm);
+        for(fixed_uint_t i = 0; i <= 15; ++i)
+        {
+            if(n(i<<4, cm))
+                REQUIRE(w(i<<4, cm));
+            if(c2(i<<4, cm))
+                REQUIRE(n(i<<4, cm));
+        }
+
+        REQUIRE(narrow(c1, constraints_t::top(), cm).bounds.bit_eq(c1.bounds));
+    }
+}
+
 TEST_CASE("tighten_bounds", "[constraints]")
 {
     for(unsigned signed_ = 0; signed_ < 2; ++signed_)
@@ -587,6 +638,20 @@ TEST_CASE("abstract_mul", "[constraints]")
         test_op<int_cm_t, int_cm_t, int_cm_t, bool_cm_t>(SSA_mul, [](fixed_sint_t* c) { return c[0] * c[1]; });
 }
 
+TEST_CASE("abstract_div", "[constraints]")
+{
+    std::srand(std::time(nullptr));
+    for(unsigned i = 0; i < TEST_ITER; ++i)
+        test_op<uint_cm_t, uint_cm_t, uint_cm_t>(SSA_div, [](fixed_sint_t* c) { return c[1] ? c[0] / c[1] : -1; });
+}
+
+TEST_CASE("abstract_mod", "[constraints]")
+{
+    std::srand(std::time(nullptr));
+    for(unsigned i = 0; i < TEST_ITER; ++i)
+        test_op<uint_cm_t, uint_cm_t, uint_cm_t>(SSA_mod, [](fixed_sint_t* c) { return c[1] ? c[0] % c[1] : c[0]; });
+}
+
 TEST_CASE("abstract_eq", "[constraints]")
 {
     std::srand(std::time(nullptr));
@@ -676,3 +741,226 @@ TEST_CASE("abstract_shr", "[constraints]")
 }
 */
 
+
+// All known bits in 'range', including TOP.
+static std::vector<known_bits_t> all_bits(fixed_uint_t step, fixed_uint_t range)
+{
+    std::vector<known_bits_t> ret;
+    for(fixed_uint_t k0 = 0; k0 <= range; k0 += step)
+    for(fixed_uint_t k1 = 0; k1 <= range; k1 += step)
+        ret.push_back({ k0 | ~range, k1 });
+    return ret;
+}
+
+// All bounds between [lo, hi], including TOP.
+static std::vector<bounds_t> all_bounds(constraints_mask_t cm, int lo, int hi)
+{
+    std::vector<bounds_t> ret;
+    fixed_sint_t const step = low_bit_only(cm.mask);
+    for(int min = lo; min <= hi; ++min)
+    for(int max = lo; max <= hi; ++max)
+        ret.push_back({ min * step, max * step });
+    return ret;
+}
+
+TEST_CASE("batch_unary", "[constraints]")
+{
+    for(unsigned signed_ = 0; signed_ < 2; ++signed_)
+    {
+        constraints_mask_t const cm = { 0xF << 4, signed_ };
+
+        auto const bits = all_bits(1, 0xFF);
+        auto const bounds = all_bounds(cm, -24, 24);
+
+        constraints_soa_t soa;
+        soa.resize(bits.size());
+        for(std::size_t i = 0; i < bits.size(); ++i)
+            soa.set(i, { bounds[i % bounds.size()], bits[i] });
+
+        constraints_soa_t masked = soa;
+        batch_apply_mask(masked, cm);
+        for(std::size_t i = 0; i < soa.size(); ++i)
+            REQUIRE(masked.get(i).bit_eq(apply_mask(soa.get(i), cm)));
+
+        // 'from_bits' and 'from_bounds' expect masked input.
+        constraints_soa_t from = masked;
+        batch_from_bits(from, cm);
+        for(std::size_t i = 0; i < soa.size(); ++i)
+            REQUIRE(from.get(i).bounds.bit_eq(from_bits(masked.get(i).bits, cm)));
+
+        from = masked;
+        batch_from_bounds(from, cm);
+        for(std::size_t i = 0; i < soa.size(); ++i)
+            REQUIRE(from.get(i).bits.bit_eq(from_bounds(masked.get(i).bounds, cm)));
+    }
+}
+
+TEST_CASE("batch_binary", "[constraints]")
+{
+    constraints_mask_t const cm = { 0xF << 4, false };
+
+    auto const bits = all_bits(0x10, 0xF0);
+    auto const bounds = all_bounds(cm, -8, 15);
+
+    constraints_soa_t a;
+    constraints_soa_t b;
+    constraints_soa_t result;
+
+    // Every pair of bounds and every pair of bits gets tested.
+    for(std::size_t i = 0; i < std::max(bounds.size(), bits.size()); ++i)
+    {
+        constraints_t const c = { bounds[i % bounds.size()], bits[i % bits.size()] };
+        std::size_t const size = std::max(bounds.size(), bits.size());
+
+        a.assign(size, c);
+        b.resize(size);
+        for(std::size_t j = 0; j < size; ++j)
+            b.set(j, { bounds[j % bounds.size()], bits[j % bits.size()] });
+
+        result = a;
+        batch_intersect(result, b);
+        for(std::size_t j = 0; j < size; ++j)
+            REQUIRE(result.get(j).bit_eq(intersect(c, b.get(j))));
+
+        result = a;
+        batch_union(result, b);
+        for(std::size_t j = 0; j < size; ++j)
+            REQUIRE(result.get(j).bit_eq(union_(c, b.get(j))));
+    }
+}
+
+extern std::uint8_t const add_constraints_table[1024];
+
+// Adds known bits one trit at a time, using the lookup table.
+static known_bits_t ripple_add_bits(known_bits_t lhs, known_bits_t rhs, carry_t carry, 
+                                    constraints_mask_t cm, carry_t& carry_out)
+{
+    known_bits_t ret = { 0, 0 };
+    fixed_uint_t const start_i = builtin::ctz(cm.mask) & ~1ull;
+    fixed_uint_t const end_i = (1 + builtin::rclz(cm.mask)) & ~1ull;
+    ret.known0 = (1ull << start_i) - 1ull;
+
+    fixed_uint_t j = carry;
+    for(fixed_uint_t i = start_i; i < end_i; i += 2ull)
+    {
+        j |= ((lhs.known0 >> i) & 0b11) << 2ull;
+        j |= ((lhs.known1 >> i) & 0b11) << 4ull;
+        j |= ((rhs.known0 >> i) & 0b11) << 6ull;
+        j |= ((rhs.known1 >> i) & 0b11) << 8ull;
+
+        j = add_constraints_table[j];
+        ret.known0 |= ((j >> 2ull) & 0b11ull) << i;
+        ret.known1 |= ((j >> 4ull) & 0b11ull) << i;
+        j &= 0b11;
+    }
+    ret.known0 |= ~((1ull << end_i) - 1ull);
+
+    carry_out = (carry_t)j;
+    return apply_mask(ret, cm);
+}
+
+TEST_CASE("add_bits", "[constraints]")
+{
+    constraints_mask_t const cm = { 0xF << 4, false };
+
+    std::vector<known_bits_t> bits;
+    for(known_bits_t b : all_bits(0x10, 0xF0))
+        if(!b.is_top())
+            bits.push_back(b);
+
+    constraints_soa_t lhs, rhs, carry, result;
+
+    for(carry_t c : { CARRY_CLEAR, CARRY_SET, CARRY_BOTTOM })
+    for(known_bits_t l : bits)
+    {
+        constraints_t const shifted_c = constraints_t::shifted_carry(c, cm.mask);
+
+        lhs.assign(bits.size(), { bounds_t::bottom(cm), l });
+        carry.assign(bits.size(), shifted_c);
+        rhs.resize(bits.size());
+        for(std::size_t i = 0; i < bits.size(); ++i)
+            rhs.set(i, { bounds_t::bottom(cm), bits[i] });
+
+        result = lhs;
+        batch_add_bits(result, lhs, rhs, carry, cm);
+
+        for(std::size_t i = 0; i < bits.size(); ++i)
+        {
+            known_bits_t const r = bits[i];
+
+            carry_t ripple_carry, carry_out;
+            known_bits_t const expected = ripple_add_bits(l, r, c, cm, ripple_carry);
+            known_bits_t const sum = add_bits(l, r, shifted_c.bits, cm, &carry_out);
+
+            REQUIRE(sum.bit_eq(expected));
+            REQUIRE(carry_out == ripple_carry);
+            REQUIRE(result.get(i).bits.bit_eq(sum));
+        }
+    }
+}
+
+TEST_CASE("batch_benchmark", "[.][benchmark]")
+{
+    constexpr std::size_t N = 1 << 14;
+    constraints_mask_t const cm = { 0xFF << 8, false };
+
+    std::srand(0);
+    std::vector<constraints_t> a(N), b(N);
+    constraints_soa_t a_soa, b_soa, carry_soa, result;
+    carry_soa.assign(N, constraints_t::shifted_carry(CARRY_BOTTOM, cm.mask));
+    a_soa.resize(N);
+    b_soa.resize(N);
+    for(std::size_t i = 0; i < N; ++i)
+    {
+        a_soa.set(i, a[i] = random_constraint(cm));
+        b_soa.set(i, b[i] = random_constraint(cm));
+    }
+
+    std::cout << "Throughput in constraints per benchmark run: " << N << std::endl;
+
+    BENCHMARK("scalar union_")
+    {
+        fixed_uint_t sum = 0;
+        for(std::size_t i = 0; i < N; ++i)
+            sum += union_(a[i], b[i]).bounds.min;
+        return sum;
+    };
+
+    BENCHMARK("batch_union")
+    {
+        result = a_soa;
+        batch_union(result, b_soa);
+        return result.min[N/2];
+    };
+
+    BENCHMARK("scalar from_bounds")
+    {
+        fixed_uint_t sum = 0;
+        for(std::size_t i = 0; i < N; ++i)
+            sum += from_bounds(a[i].bounds, cm).known0;
+        return sum;
+    };
+
+    BENCHMARK("batch_from_bounds")
+    {
+        result = a_soa;
+        batch_from_bounds(result, cm);
+        return result.known0[N/2];
+    };
+
+    BENCHMARK("ripple add")
+    {
+        fixed_uint_t sum = 0;
+        carry_t carry;
+        for(std::size_t i = 0; i < N; ++i)
+            sum += ripple_add_bits(a[i].bits, b[i].bits, CARRY_BOTTOM, cm, carry).known0;
+        return sum;
+    };
+
+    BENCHMARK("batch_add_bits")
+    {
+        result = a_soa;
+        batch_add_bits(result, a_soa, b_soa, carry_soa, cm);
+        return result.known0[N/2];
+    };
+}
@@ -1,5 +1,6 @@
 #include "convert.hpp"
 
+#include <cstring>
 #include <filesystem>
 
 #include "compiler_error.hpp"
@@ -30,7 +31,7 @@ ext_lex::token_type_t lex_extension(char const* str)
     for(char const* ptr = str; lexed > ext_lex::TOK_LAST_STATE; ++ptr)
     {
         unsigned char const c = *ptr;
-        lexed = ext_lex::lexer_transition_table[lexed + ext_lex::lexer_ec_table[c]];
+        lexed = ext_lex::lexer_transition(lexed, c);
         if(!c)
             break;
     }
@@ -103,7 +104,7 @@ conversion_t convert_file(char const* source, pstring_t script, fs::path preferr
         std::string_view const view = script.view(source);
         conversion_t ret;
 
-        auto const read_as_vec = [&]{ return read_binary_file(path.string(), filename.pstring); };
+        auto const read_contents = [&]{ return cached_file(path.string(), filename.pstring); };
         auto const get_extension = [&]{ return lex_extension(path.extension().string().c_str()); };
 
         constexpr auto valid_mods = MOD_spr_8x16 | MOD_palette_3 | MOD_palette_25;
@@ -120,23 +121,32 @@ conversion_t convert_file(char const* source, pstring_t script, fs::path preferr
             if(pal3 && pal25)
                 compiler_error(filename.pstring, "+palette_3 is incompatible with +palette_25.");
 
-            std::vector<std::uint8_t> vec = read_as_vec();
+            file_view_t const contents = read_contents();
+            std::vector<std::uint8_t> vec;
 
             if(format)
             {
                 switch(get_extension())
                 {
                 case ext_lex::TOK_png:
-                    vec = png_to_chr(vec.data(), vec.size(), spr16);
+                    // Decode straight from the cached file, without copying it first.
+                    vec = png_to_chr(contents.begin(), contents.size, spr16);
                     break;
 
                 case ext_lex::TOK_txt:
-                    vec.resize(normalize_line_endings(reinterpret_cast<char*>(vec.data()), vec.size()));
-                    //fall-through
+                    vec.assign(contents.begin(), contents.end());
+                    // Only rewrite the buffer if there are line endings to normalize:
+                    if(std::memchr(contents.data, '\r', contents.size))
+                        vec.resize(normalize_line_endings(reinterpret_cast<char*>(vec.data()), vec.size()));
+                    if(spr16)
+                        vec = convert_spr16(vec);
+                    break;
+
                 case ext_lex::TOK_chr:
                 case ext_lex::TOK_bin:
                 case ext_lex::TOK_nam:
                 case ext_lex::TOK_pal:
+                    vec.assign(contents.begin(), contents.end());
                     if(spr16)
                         vec = convert_spr16(vec);
                     break;
@@ -145,8 +155,12 @@ conversion_t convert_file(char const* source, pstring_t script, fs::path preferr
                     compiler_error(filename.pstring, fmt("% cannot process file format: %", view, filename.string));
                 }
             }
-            else if(spr16)
-                vec = convert_spr16(vec);
+            else
+            {
+                vec.assign(contents.begin(), contents.end());
+                if(spr16)
+                    vec = convert_spr16(vec);
+            }
 
             if(pal3)
                 vec = convert_pal3(vec);
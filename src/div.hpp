@@ -0,0 +1,67 @@
+#ifndef DIV_HPP
+#define DIV_HPP
+
+// Code for dividing by constants using reciprocal multiplication.
+
+#include <cassert>
+
+// Describes how to divide a byte by a constant, using the high byte of a product.
+// When 'add' is false:
+//     q = (x * mul) >> (8 + shift)
+// When 'add' is true, 'mul' is 9 bits, and the 9th bit is applied using an add:
+//     t = (x * (mul & 0xFF)) >> 8
+//     q = (((x - t) >> 1) + t) >> (shift - 1)
+struct div_magic_t
+{
+    unsigned mul = 0;
+    unsigned shift = 0;
+    bool add = false;
+
+    constexpr explicit operator bool() const { return mul; }
+};
+
+constexpr unsigned div_magic_eval(div_magic_t magic, unsigned x)
+{
+    assert(magic);
+    unsigned const t = (x * (magic.mul & 0xFF)) >> 8;
+    if(magic.add)
+        return (((x - t) >> 1) + t) >> (magic.shift - 1);
+    return t >> magic.shift;
+}
+
+// Finds a 'div_magic_t' that is exact for every 'x' in [0, max_x],
+// preferring the cheaper form. Returns an empty result if none exists.
+constexpr div_magic_t div_magic(unsigned divisor, unsigned max_x = 0xFF)
+{
+    assert(divisor > 0 && divisor <= 0xFF);
+    assert(max_x <= 0xFF);
+
+    auto const verify = [&](div_magic_t magic) -> bool
+    {
+        for(unsigned x = 0; x <= max_x; ++x)
+            if(div_magic_eval(magic, x) != x / divisor)
+                return false;
+        return true;
+    };
+
+    for(bool add : { false, true })
+    {
+        for(unsigned shift = add; shift <= 8; ++shift)
+        {
+            unsigned const pow = 1u << (8 + shift);
+            div_magic_t const magic = { (pow + divisor - 1) / divisor, shift, add };
+
+            if(magic.mul > (add ? 0x1FFu : 0xFFu))
+                break;
+            if((magic.mul > 0xFF) != add)
+                continue;
+
+            if(verify(magic))
+                return magic;
+        }
+    }
+
+    return {};
+}
+
+#endif
@@ -0,0 +1,301 @@
+#include "catch/catch.hpp"
+#include "div.hpp"
+#include "asm.hpp"
+#include "builtin.hpp"
+
+#include <array>
+#include <iostream>
+#include <vector>
+
+// Finds the magic number the same way 'o_div_consts' does.
+static div_magic_t find_magic(unsigned divisor, unsigned& shifts)
+{
+    shifts = 0;
+    if(div_magic_t magic = div_magic(divisor))
+        return magic;
+    shifts = builtin::ctz(divisor);
+    return div_magic(divisor >> shifts, 0xFF >> shifts);
+}
+
+TEST_CASE("div_magic", "[div]")
+{
+    // (Dividing by 1 never multiplies.)
+    for(unsigned d = 2; d <= 0xFF; ++d)
+    {
+        unsigned shifts;
+        div_magic_t const magic = find_magic(d, shifts);
+        REQUIRE(magic);
+
+        for(unsigned x = 0; x <= 0xFF; ++x)
+            REQUIRE(div_magic_eval(magic, x >> shifts) == x / d);
+    }
+}
+
+TEST_CASE("div_magic_max_x", "[div]")
+{
+    for(unsigned d = 1; d <= 0xFF; ++d)
+    for(unsigned max_x = 0; max_x <= 0xFF; max_x += 15)
+    {
+        div_magic_t const magic = div_magic(d, max_x);
+        if(!magic)
+            continue;
+        for(unsigned x = 0; x <= max_x; ++x)
+            REQUIRE(div_magic_eval(magic, x) == x / d);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Cycle benchmark ////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// Runs the generated code in 'cpu_2a03.hpp' to compare the cost of
+// the run-time division routine against reciprocal multiplication.
+
+unsigned char mem_rd(unsigned address);
+void mem_wr(unsigned address, unsigned char data);
+
+#include "cpu_2a03.hpp"
+
+namespace
+{
+    std::array<unsigned char, 1 << 16> memory;
+
+    constexpr unsigned ZP_0 = 0x00;
+    constexpr unsigned ZP_1 = 0x01;
+    constexpr unsigned ZP_X = 0x02;
+    constexpr unsigned ZP_T = 0x03;
+    constexpr unsigned MUL8 = 0x8000;
+    constexpr unsigned DIV8 = 0x8100;
+    constexpr unsigned DRIVER = 0x8200;
+    constexpr unsigned HALT = 0x8300;
+
+    struct assembler_t
+    {
+        unsigned pc;
+
+        unsigned emit(op_t op, unsigned arg = 0)
+        {
+            unsigned const at = pc;
+            memory[pc++] = op_code(op);
+            if(op_size(op) > 1)
+                memory[pc++] = arg;
+            if(op_size(op) > 2)
+                memory[pc++] = arg >> 8;
+            return at;
+        }
+
+        // Points the branch at 'at' to the current position.
+        void land(unsigned at) { memory[at + 1] = pc - (at + 2); }
+        void branch_to(op_t op, unsigned target) { emit(op, target - (pc + 2)); }
+    };
+
+    // Matches 'make_mul8' in 'runtime.cpp'.
+    void assemble_mul8()
+    {
+        assembler_t a = { MUL8 };
+        a.emit(LSR_IMPLIED);
+        a.emit(STA_ZERO_PAGE, ZP_0);
+        a.emit(TYA_IMPLIED);
+        unsigned const early_return = a.emit(BEQ_RELATIVE);
+        a.emit(DEY_IMPLIED);
+        a.emit(STY_ZERO_PAGE, ZP_1);
+        a.emit(LDA_IMMEDIATE, 0);
+        for(unsigned i = 0; i < 8; ++i)
+        {
+            if(i != 0)
+                a.emit(ROR_ZERO_PAGE, ZP_0);
+            unsigned const bcc = a.emit(BCC_RELATIVE);
+            a.emit(ADC_ZERO_PAGE, ZP_1);
+            a.land(bcc);
+            a.emit(ROR_IMPLIED);
+        }
+        a.emit(TAY_IMPLIED);
+        a.emit(LDA_ZERO_PAGE, ZP_0);
+        a.emit(ROR_IMPLIED);
+        a.land(early_return);
+        a.emit(RTS_IMPLIED);
+    }
+
+    // Matches 'make_div8' in 'runtime.cpp'.
+    void assemble_div8()
+    {
+        assembler_t a = { DIV8 };
+        a.emit(STY_ZERO_PAGE, ZP_1);
+        a.emit(STX_ZERO_PAGE, ZP_0);
+        a.emit(LDY_IMMEDIATE, 8);
+        unsigned const loop = a.pc;
+        a.emit(ASL_ZERO_PAGE, ZP_0);
+        a.emit(ROL_IMPLIED);
+        unsigned const bcs = a.emit(BCS_RELATIVE);
+        a.emit(CMP_ZERO_PAGE, ZP_1);
+        unsigned const bcc = a.emit(BCC_RELATIVE);
+        a.land(bcs);
+        a.emit(SBC_ZERO_PAGE, ZP_1);
+        a.emit(INC_ZERO_PAGE, ZP_0);
+        a.land(bcc);
+        a.emit(DEY_IMPLIED);
+        a.branch_to(BNE_RELATIVE, loop);
+        a.emit(TAY_IMPLIED);
+        a.emit(LDA_ZERO_PAGE, ZP_0);
+        a.emit(RTS_IMPLIED);
+    }
+
+    // Approximates the code 'o_div_consts' generates for dividing 'ZP_X'.
+    void assemble_reciprocal(unsigned divisor)
+    {
+        unsigned shifts;
+        div_magic_t const magic = find_magic(divisor, shifts);
+
+        assembler_t a = { DRIVER };
+        a.emit(LDA_ZERO_PAGE, ZP_X);
+        for(unsigned i = 0; i < shifts; ++i)
+            a.emit(LSR_IMPLIED);
+        if(magic.add)
+            a.emit(STA_ZERO_PAGE, ZP_X);
+        a.emit(LDY_IMMEDIATE, magic.mul & 0xFF);
+        a.emit(JSR_ABSOLUTE, MUL8);
+        a.emit(TYA_IMPLIED);
+        unsigned shift = magic.shift;
+        if(magic.add)
+        {
+            a.emit(STA_ZERO_PAGE, ZP_T);
+            a.emit(LDA_ZERO_PAGE, ZP_X);
+            a.emit(SEC_IMPLIED);
+            a.emit(SBC_ZERO_PAGE, ZP_T);
+            a.emit(LSR_IMPLIED);
+            a.emit(CLC_IMPLIED);
+            a.emit(ADC_ZERO_PAGE, ZP_T);
+            shift -= 1;
+        }
+        for(unsigned i = 0; i < shift; ++i)
+            a.emit(LSR_IMPLIED);
+        a.emit(JMP_ABSOLUTE, HALT);
+    }
+
+    // Divides the two bytes of a 16-bit dividend, as byteify does.
+    void assemble_long_division(unsigned bytes)
+    {
+        assembler_t a = { DRIVER };
+        a.emit(LDA_IMMEDIATE, 0);
+        for(unsigned i = 0; i < bytes; ++i)
+        {
+            a.emit(LDX_ZERO_PAGE, ZP_X + bytes - i - 1);
+            a.emit(LDY_ZERO_PAGE, ZP_T + 1);
+            a.emit(JSR_ABSOLUTE, DIV8);
+            a.emit(STA_ZERO_PAGE, ZP_T + 2 + i);
+            a.emit(TYA_IMPLIED);
+        }
+        a.emit(JMP_ABSOLUTE, HALT);
+    }
+
+    std::array<op_t, 256> const opcode_table = []
+    {
+        std::array<op_t, 256> table;
+        table.fill(BAD_OP);
+        for(unsigned i = 0; i < NUM_NORMAL_OPS; ++i)
+            if(op_name(op_t(i)) != BAD_OP_NAME && table[op_code(op_t(i))] == BAD_OP)
+                table[op_code(op_t(i))] = op_t(i);
+        return table;
+    }();
+
+    // Returns the number of cycles taken to reach 'HALT'.
+    // (Page crossings are not counted.)
+    unsigned run()
+    {
+        unsigned cycles = 0;
+        CPU.S = 0xFF;
+        CPU.PC.hl = DRIVER;
+        while(CPU.PC.hl != HALT)
+        {
+            unsigned const pc = CPU.PC.hl;
+            op_t const op = opcode_table[memory[pc]];
+            REQUIRE((op != BAD_OP));
+            cpu_tick();
+            cycles += op_cycles(op);
+            if(is_branch(op) && op_addr_mode(op) == MODE_RELATIVE && CPU.PC.hl != pc + 2)
+                cycles += 1;
+        }
+        return cycles;
+    }
+
+    struct cycle_stats_t
+    {
+        unsigned min = ~0u;
+        unsigned max = 0;
+        unsigned long long sum = 0;
+        unsigned count = 0;
+
+        void add(unsigned cycles)
+        {
+            min = std::min(min, cycles);
+            max = std::max(max, cycles);
+            sum += cycles;
+            ++count;
+        }
+
+        void print(char const* name) const
+        {
+            std::cout << name << ": min " << min << ", avg " << (sum / double(count)) << ", max " << max << std::endl;
+        }
+    };
+}
+
+unsigned char mem_rd(unsigned address) { return memory[address & 0xFFFF]; }
+void mem_wr(unsigned address, unsigned char data) { memory[address & 0xFFFF] = data; }
+
+TEST_CASE("div_cycle_benchmark", "[.][benchmark]")
+{
+    assemble_mul8();
+    assemble_div8();
+
+    cycle_stats_t reciprocal_total, runtime_total, long_total;
+
+    for(unsigned d = 2; d <= 0xFF; ++d)
+    {
+        cycle_stats_t reciprocal, runtime;
+
+        assemble_reciprocal(d);
+        for(unsigned x = 0; x <= 0xFF; ++x)
+        {
+            memory[ZP_X] = x;
+            unsigned const cycles = run();
+            REQUIRE(CPU.A == x / d);
+            reciprocal.add(cycles);
+            reciprocal_total.add(cycles);
+        }
+
+        assemble_long_division(1);
+        memory[ZP_T + 1] = d;
+        for(unsigned x = 0; x <= 0xFF; ++x)
+        {
+            memory[ZP_X] = x;
+            unsigned const cycles = run();
+            REQUIRE(memory[ZP_T + 2] == x / d);
+            REQUIRE(CPU.A == x % d);
+            runtime.add(cycles);
+            runtime_total.add(cycles);
+        }
+
+        assemble_long_division(2);
+        for(unsigned x = 0; x <= 0xFFFF; x += 97)
+        {
+            memory[ZP_X] = x;
+            memory[ZP_X + 1] = x >> 8;
+            unsigned const cycles = run();
+            REQUIRE((memory[ZP_T + 2] << 8 | memory[ZP_T + 3]) == x / d);
+            REQUIRE(CPU.A == x % d);
+            long_total.add(cycles);
+        }
+
+        if(d == 3 || d == 7 || d == 10 || d == 100)
+        {
+            std::cout << "divisor " << d << std::endl;
+            reciprocal.print("    U reciprocal");
+            runtime.print("    U run-time div8");
+        }
+    }
+
+    reciprocal_total.print("U reciprocal, all divisors");
+    runtime_total.print("U run-time div8, all divisors");
+    long_total.print("UU run-time div8, all divisors");
+}
@@ -10,6 +10,7 @@
 
 #include "alloca.hpp"
 #include "bitset.hpp"
+#include "builtin.hpp"
 #include "rval.hpp"
 #include "decl.hpp"
 #include "globals.hpp"
@@ -257,6 +258,9 @@ public:
     template<typename Policy>
     expr_value_t do_mul(expr_value_t lhs, expr_value_t rhs, token_t const& token);
 
+    template<typename Policy>
+    expr_value_t do_div(expr_value_t lhs, expr_value_t rhs, token_t const& token);
+
     //template<typename Policy>
     //expr_value_t interpret_shift(expr_value_t lhs, expr_value_t rhs, token_t const& token);
 
@@ -275,6 +279,9 @@ public:
     template<typename Policy>
     expr_value_t do_assign_mul(expr_value_t lhs, expr_value_t rhs, token_t const& token);
 
+    template<typename Policy>
+    expr_value_t do_assign_div(expr_value_t lhs, expr_value_t rhs, token_t const& token);
+
     template<do_t D>
     expr_value_t do_logical(ast_node_t const& ast);
 
@@ -2152,7 +2159,10 @@ expr_value_t eval_t::do_expr(ast_node_t const& ast)
                         {
                             fn_ht const fn = lval->global().handle<fn_ht>();
                             if(lval->arg < 0)
+                            {
+                                fn->mark_referenced_label();
                                 return make_ptr(locator_t::fn(fn, lval->ulabel(), offset), type_t::addr(true), true, nonconst_index);
+                            }
                             else
                             {
                                 locator_t loc;
@@ -3144,13 +3154,8 @@ expr_value_t eval_t::do_expr(ast_node_t const& ast)
                         ir->gmanager.for_each_gmember_set(base_fn->handle(),
                         [&](bitset_uint_t const* gmember_set, gmanager_t::index_t index,locator_t locator)
                         {
-                            if(!callable->precheck_fences())
-                            {
-                                bitset_copy(gmember_bs_size, temp_bs, callable->ir_reads().data());
-                                bitset_and(gmember_bs_size, temp_bs, gmember_set);
-                                if(bitset_all_clear(gmember_bs_size, temp_bs))
-                                    return;
-                            }
+                            if(!callable->precheck_fences() && !callable->ir_reads().intersects(gmember_set))
+                                return;
                             fn_inputs.push_back(var_lookup(builder.cfg, to_var_i(index), 0));
                             fn_inputs.push_back(locator);
                         });
@@ -3237,13 +3242,8 @@ expr_value_t eval_t::do_expr(ast_node_t const& ast)
                         ir->gmanager.for_each_gmember_set(base_fn->handle(),
                         [&](bitset_uint_t const* gvar_set, gmanager_t::index_t index, locator_t locator)
                         {
-                            if(!callable->precheck_fences())
-                            {
-                                bitset_copy(gmember_bs_size, temp_bs, gvar_set);
-                                bitset_and(gmember_bs_size, temp_bs, callable->ir_writes().data());
-                                if(bitset_all_clear(gmember_bs_size, temp_bs))
-                                    return;
-                            }
+                            if(!callable->precheck_fences() && !callable->ir_writes().intersects(gvar_set))
+                                return;
 
                             ssa_ht read = builder.cfg->emplace_ssa(
                                 SSA_read_global, TYPE_VOID, fn_node, locator);
@@ -3553,6 +3553,9 @@ expr_value_t eval_t::do_expr(ast_node_t const& ast)
                         if(precheck_tracked)
                             precheck_tracked->calls.emplace(g.handle<fn_ht>(), sub.token.pstring);
 
+                        // Calls from assembly can't use 'reg_conv_t'.
+                        g.handle<fn_ht>()->mark_referenced_label();
+
                         if(!is_check(D))
                         {
                             bool const is_call = sub.token.type == TOK_byte_block_call;
@@ -4408,12 +4411,29 @@ expr_value_t eval_t::do_expr(ast_node_t const& ast)
                     compiler_error(at, "Division by zero.");
                 return fixed_div(lhs, rhs); 
             }
-            static ssa_op_t op() { return SSA_null; }
+            static ssa_op_t op() { return SSA_div; }
         };
-        return infix(&eval_t::do_arith<div_p>);
+        return infix(&eval_t::do_div<div_p>);
 
     case TOK_div_assign:
-        return infix(&eval_t::do_assign_arith<div_p>, false, true);
+        return infix(&eval_t::do_assign_div<div_p>, false, true);
+
+    case TOK_percent:
+        struct mod_p : do_wrapper_t<D>
+        {
+            static auto lt() { return TOK_percent; }
+            static S interpret(S lhs, S rhs, pstring_t at) 
+            { 
+                if(!rhs)
+                    compiler_error(at, "Division by zero.");
+                return fixed_mod(lhs, rhs); 
+            }
+            static ssa_op_t op() { return SSA_mod; }
+        };
+        return infix(&eval_t::do_div<mod_p>);
+
+    case TOK_mod_assign:
+        return infix(&eval_t::do_assign_div<mod_p>, false, true);
 
     case TOK_plus:
         struct plus_p : do_wrapper_t<D>
@@ -5895,14 +5915,63 @@ expr_value_t eval_t::do_arith(expr_value_t lhs, expr_value_t rhs, token_t const&
         result.val = rval_t{ ssa_value_t(f, result.type.name()) };
     }
     else if(is_compile(Policy::D))
+        return compile_binary_operator(lhs, rhs, Policy::op(), result.type, ssa_argn(Policy::op()) > 2);
+
+    return result;
+}
+
+template<typename Policy>
+expr_value_t eval_t::do_div(expr_value_t lhs, expr_value_t rhs, token_t const& token)
+{
+    assert(lhs.is_rval() && rhs.is_rval());
+    req_quantity(token, lhs, rhs);
+
+    type_t const rhs_type = rhs.type;
+    auto const is_uint = [](type_t type) { return !is_signed(type.name()) && !frac_bytes(type.name()); };
+
+    // A byte-sized divisor can divide a larger dividend, so widen it:
+    if(!is_interpret(Policy::D) && lhs.type != rhs.type && !is_ct(lhs.type) && !is_ct(rhs.type)
+       && is_uint(lhs.type) && is_uint(rhs.type) && whole_bytes(rhs.type.name()) < whole_bytes(lhs.type.name()))
     {
-        if(!Policy::op())
-            compiler_error(result.pstring, "Cannot perform division at run-time.");
+        rhs = throwing_cast<Policy::D>(std::move(rhs), lhs.type, true);
+    }
 
-        return compile_binary_operator(lhs, rhs, Policy::op(), result.type, ssa_argn(Policy::op()) > 2);
+    // Division at run-time is only implemented for unsigned integers,
+    // and the divisor must fit in a byte (not counting trailing zero bits).
+    if(is_compile(Policy::D) && !(lhs.is_ct() && rhs.is_ct()) && !lhs.is_lt() && !rhs.is_lt())
+    {
+        type_t const type = is_ct(lhs.type) ? rhs.type : lhs.type;
+        if(!is_uint(type) || (!is_ct(rhs.type) && !is_uint(rhs.type)))
+        {
+            compiler_error(concat(lhs.pstring, rhs.pstring), 
+                fmt("Operator % is only defined at run-time for unsigned integer types. (Operands are % and %)", 
+                    token_string(token.type), lhs.type, rhs_type));
+        }
+
+        if(rhs.is_ct())
+        {
+            fixed_uint_t divisor = rhs.whole();
+            if(!divisor)
+                compiler_error(rhs.pstring, "Division by zero.");
+            divisor >>= builtin::ctz(divisor);
+            if(divisor > 0xFF)
+            {
+                compiler_error(rhs.pstring, fmt("Unable to divide by % at run-time. Constant divisors must be a byte times a power of two.",
+                                                rhs.whole()));
+            }
+        }
+        else if(!is_ct(rhs_type) && whole_bytes(rhs_type.name()) > 1)
+            compiler_error(rhs.pstring, fmt("Run-time divisors must be of type U. (Divisor is %)", rhs_type));
     }
 
-    return result;
+    return do_arith<Policy>(std::move(lhs), std::move(rhs), token);
+}
+
+template<typename Policy>
+expr_value_t eval_t::do_assign_div(expr_value_t lhs, expr_value_t rhs, token_t const& token)
+{
+    expr_value_t lhs_copy = to_rval<Policy::D>(lhs);
+    return do_assign<Policy::D>(std::move(lhs), do_div<Policy>(std::move(lhs_copy), std::move(rhs), token), token);
 }
 
 template<typename Policy>
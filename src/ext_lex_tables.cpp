@@ -1,15 +1,16 @@
 #include "ext_lex_tables.hpp"
 namespace ext_lex
 {
-extern unsigned const lexer_ec_table[256] = {
+// 36 states, 27 character classes, 52 comb entries (972 dense)
+extern std::uint8_t const lexer_ec_table[256] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 36, 72, 108, 0, 0, 0, 144, 180, 216, 0, 0, 252, 288, 324, 0,
-    360, 0, 396, 0, 432, 0, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0,
-    0, 504, 540, 576, 0, 0, 0, 612, 648, 684, 0, 0, 720, 756, 792, 0,
-    828, 0, 864, 0, 900, 0, 0, 0, 936, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 3, 0, 0, 0, 4, 5, 6, 0, 0, 7, 8, 9, 0,
+    10, 0, 11, 0, 12, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0,
+    0, 14, 15, 16, 0, 0, 0, 17, 18, 19, 0, 0, 20, 21, 22, 0,
+    23, 0, 24, 0, 25, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -19,68 +20,20 @@ extern unsigned const lexer_ec_table[256] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
-extern token_type_t const lexer_transition_table[972] = {
-
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 1, 2, 3, 4, 6, 5, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 5, 0, 0, 0, 15,
-    13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 5,
-    25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2,
-    3, 4, 6, 5, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0,
-    0, 0, 1, 2, 3, 4, 6, 5, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 5, 0, 0, 16, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 5,
-    0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 1, 2,
-    3, 4, 6, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20,
-    0, 0, 1, 2, 3, 4, 6, 5, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 18, 1, 2, 3, 4, 6, 5, 27, 0, 0, 0,
-    14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 5,
-    28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 1, 2,
-    3, 4, 6, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0,
-    0, 0, 1, 2, 3, 4, 6, 5, 29, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 5, 0, 0, 0, 0,
-    0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 5,
-    0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2,
-    3, 4, 6, 5, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 1, 2, 3, 4, 6, 5, 31, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 5, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 5,
-    0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2,
-    3, 4, 6, 5, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 1, 2, 3, 4, 6, 5, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0,
-    0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 5, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 5,
-    32, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2,
-    3, 4, 6, 5, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0,
-    0, 0, 1, 2, 3, 4, 6, 5, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 5, 34, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 5,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0,
+extern lexer_row_t const lexer_row_table[36] = {
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {2,0,0,0}, {0,0,0,0}, {4,0,0,0}, {1,0,0,0}, {0,0,0,0}, {2,0,0,0}, {3,0,0,0},
+    {4,0,0,0}, {1,0,0,0}, {3,0,0,0}, {0,5,0,0}, {1,0,0,0}, {7,0,0,0}, {0,4,0,0}, {0,6,0,0},
+    {8,0,0,0}, {0,3,0,0}, {6,0,0,0}, {0,2,0,0}, {9,0,0,0}, {0,1,0,0}, {20,0,0,0}, {1,0,0,0},
+    {0,0,0,0}, {3,0,0,0}, {22,0,0,0}, {25,0,0,0},
+};
+extern lexer_comb_t const lexer_comb_table[52] = {
+    {0,0}, {10,33}, {7,8}, {7,9}, {32,22}, {11,31}, {8,35}, {9,34},
+    {31,23}, {7,10}, {7,11}, {33,25}, {7,12}, {11,32}, {12,30}, {7,13},
+    {7,14}, {15,24}, {16,20}, {13,28}, {14,26}, {20,23}, {7,15}, {7,16},
+    {21,22}, {7,17}, {16,21}, {17,18}, {18,19}, {24,25}, {26,27}, {28,29},
+    {30,19}, {34,27}, {35,29}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0},
 };
 } // namespace ext_lex
@@ -1,11 +1,14 @@
 #include "file.hpp"
 
+#include <atomic>
 #include <cassert>
 #include <cstdio>
+#include <cstring>
 #include <stdexcept>
 #include <deque>
 #include <mutex>
 
+#include "robin/map.hpp"
 #include "robin/set.hpp"
 
 #include "platform.hpp"
@@ -107,22 +110,51 @@ bool resource_path(fs::path preferred_dir, fs::path name, fs::path& result)
     return false;
 }
 
-bool read_binary_file(char const* filename, std::function<void*(std::size_t)> const& alloc)
+////////////////
+// FILE CACHE //
+////////////////
+
+// Files are never evicted, as views into them live until the end of compilation.
+static std::mutex file_cache_mutex;
+static rh::robin_map<std::string, file_view_t> file_cache;
+static std::atomic<std::uint64_t> bytes_mapped = 0;
+static std::atomic<std::uint64_t> bytes_copied = 0;
+
+static bool load_file(char const* filename, file_view_t& result)
 {
 #ifdef PLATFORM_UNIX
     int fd = open(filename, O_RDONLY);
+    if(fd == -1)
+        return false;
     auto scope_guard = make_scope_guard([&]{ close(fd); });
 
     struct stat sb;
     if(fstat(fd, &sb) == -1)
         return false;
 
-    void* data = alloc(std::size_t(sb.st_size));
+    std::size_t const size = sb.st_size;
+    std::size_t const page_size = sysconf(_SC_PAGESIZE);
 
-    if(!data || read(fd, data, sb.st_size) != sb.st_size)
-        return false;
+    // The kernel zero-fills the rest of the last mapped page, 
+    // so if there's room, that provides our padding.
+    if(size % page_size != 0 && page_size - (size % page_size) >= FILE_PADDING)
+    {
+        void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(data != MAP_FAILED)
+        {
+            result = { static_cast<char const*>(data), size, true };
+            bytes_mapped += size;
+            return true;
+        }
+    }
 
-    return data;
+    // Otherwise, copy into a padded buffer:
+    char* data = new char[size + FILE_PADDING]();
+    if(read(fd, data, size) != ssize_t(size))
+    {
+        delete[] data;
+        return false;
+    }
 #else
     FILE* fp = std::fopen(filename, "rb");
     if(!fp)
@@ -131,16 +163,89 @@ bool read_binary_file(char const* filename, std::function<void*(std::size_t)> co
 
     // Get the file size
     std::fseek(fp, 0, SEEK_END);
-    std::size_t const file_size = ftell(fp);
+    std::size_t const size = ftell(fp);
     std::fseek(fp, 0, SEEK_SET);
 
-    auto* data = alloc(file_size);
-
-    if(!data || std::fread(data, file_size, 1, fp) != 1)
+    char* data = new char[size + FILE_PADDING]();
+    if(size && std::fread(data, size, 1, fp) != 1)
+    {
+        delete[] data;
         return false;
+    }
+#endif
 
-    return data;
+    result = { data, size, false };
+    bytes_copied += size;
+    return true;
+}
+
+static void unload_file(file_view_t const& view)
+{
+#ifdef PLATFORM_UNIX
+    if(view.mapped)
+    {
+        munmap(const_cast<char*>(view.data), view.size);
+        return;
+    }
 #endif
+    delete[] view.data;
+}
+
+bool cached_file(char const* filename, file_view_t& result)
+{
+    std::string key = fs::path(filename).lexically_normal().string();
+
+    {
+        std::lock_guard<std::mutex> lock(file_cache_mutex);
+        if(auto const* pair = file_cache.lookup(key))
+        {
+            result = pair->second;
+            return true;
+        }
+    }
+
+    // Load without holding the lock, so that threads can read different files in parallel:
+    file_view_t loaded;
+    if(!load_file(filename, loaded))
+        return false;
+
+    std::lock_guard<std::mutex> lock(file_cache_mutex);
+    auto const pair = file_cache.insert({ std::move(key), loaded });
+    result = pair.first->second;
+
+    // If another thread beat us to it, use its copy instead:
+    if(!pair.second)
+        unload_file(loaded);
+
+    return true;
+}
+
+file_view_t cached_file(std::string const& filename, pstring_t at)
+{
+    file_view_t view;
+    if(!cached_file(filename.c_str(), view))
+        compiler_error(at, "Unable to read: " + filename);
+    return view;
+}
+
+file_cache_stats_t file_cache_stats()
+{
+    return { bytes_mapped.load(), bytes_copied.load() };
+}
+
+bool read_binary_file(char const* filename, std::function<void*(std::size_t)> const& alloc)
+{
+    file_view_t view;
+    if(!cached_file(filename, view))
+        return false;
+
+    void* data = alloc(view.size);
+    if(!data)
+        return false;
+
+    std::memcpy(data, view.data, view.size);
+    bytes_copied += view.size;
+    return true;
 }
 
 std::vector<std::uint8_t> read_binary_file(std::string filename, pstring_t at)
@@ -204,7 +309,6 @@ fs::path source_path(unsigned file_i)
 void file_contents_t::reset(unsigned file_i)
 {
     m_size = 0;
-    m_alloc.reset();
     m_source = nullptr;
     m_path = fs::path();
     m_private_globals = nullptr;
@@ -217,18 +321,13 @@ void file_contents_t::reset(unsigned file_i)
     {
         m_path = source_path(file_i);
 
-        if(!read_binary_file(m_path.string().c_str(), [this](std::size_t size)
-        {
-            m_size = size + 2;
-            m_alloc.reset(new char[m_size]);
-            return reinterpret_cast<void*>(m_alloc.get());
-        }))
-        {
+        // The cache's zero padding terminates the source, so no copy is needed:
+        file_view_t view;
+        if(!cached_file(m_path.string().c_str(), view))
             throw std::runtime_error("Unable to open file: " + input().file.string());
-        }
 
-        m_alloc[m_size-1] = m_alloc[m_size-2] = '\0';
-        m_source = m_alloc.get();
+        m_size = view.size + FILE_PADDING;
+        m_source = view.data;
     }
     else
     {
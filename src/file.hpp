@@ -57,6 +57,35 @@ void invoke_macro(
 std::pair<unsigned, unsigned> finalize_macros();
 
 bool resource_path(fs::path preferred_dir, fs::path name, fs::path& result);
+
+// How many zero bytes follow the contents of every 'file_view_t'.
+constexpr std::size_t FILE_PADDING = 2;
+
+// A read-only view of a file's contents, followed by 'FILE_PADDING' zero bytes.
+struct file_view_t
+{
+    char const* data = nullptr;
+    std::size_t size = 0;
+    bool mapped = false; // If 'data' points to memory-mapped pages.
+
+    std::uint8_t const* begin() const { return reinterpret_cast<std::uint8_t const*>(data); }
+    std::uint8_t const* end() const { return begin() + size; }
+};
+
+// Loads a file into the process-wide file cache, or returns the cached view.
+// Files are memory-mapped where possible, and remain valid for the rest of compilation.
+// Views are shared between threads and must never be written to.
+bool cached_file(char const* filename, file_view_t& result);
+file_view_t cached_file(std::string const& filename, pstring_t at);
+
+struct file_cache_stats_t
+{
+    std::uint64_t bytes_mapped = 0; // Loaded into the cache using mmap.
+    std::uint64_t bytes_copied = 0; // Copied into buffers, by the cache or by 'read_binary_file'.
+};
+
+file_cache_stats_t file_cache_stats();
+
 bool read_binary_file(char const* filename, std::function<void*(std::size_t)> const& alloc);
 std::vector<std::uint8_t> read_binary_file(std::string filename, pstring_t at);
 std::vector<std::uint8_t> read_binary_file(std::string filename);
@@ -85,14 +114,13 @@ public:
     ident_map_t<group_ht> const* private_groups() const { return m_private_groups; }
     macro_invocation_t const* invoke() const { return m_invoke; }
 
-    void clear() { m_alloc.reset(); m_size = 0; m_source = nullptr; }
+    void clear() { m_size = 0; m_source = nullptr; }
     void reset(unsigned file_i);
 private:
     unsigned m_file_i = 0;
     int m_size = 0;
     fs::path m_path;
-    char const* m_source;
-    std::unique_ptr<char[]> m_alloc;
+    char const* m_source = nullptr; // Points into the file cache, or a macro result.
     ident_map_t<global_ht> const* m_private_globals = nullptr;
     ident_map_t<group_ht> const* m_private_groups = nullptr;
     macro_invocation_t const* m_invoke = nullptr;
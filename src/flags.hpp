@@ -33,20 +33,33 @@ constexpr std::uint16_t FLAG_UNLOOP         = 1ull << 11;
 // Flags that should propagate:
 constexpr std::uint16_t FLAGS_PROP = FLAG_NO_UNROLL | FLAG_UNROLL | FLAG_UNLOOP;
 
-class flag_owner_t
+// Implements the flag functions on top of 'Derived::flags_ref()'.
+template<typename Derived>
+class flag_interface_t
 {
 public:
-    void set_flags(std::uint16_t f) { m_flags |= f; }
-    void clear_flags(std::uint16_t f) { m_flags &= ~f; }
-    bool test_flags(std::uint16_t f) const { return (m_flags & f) == f; }
+    void set_flags(std::uint16_t f) { flags() |= f; }
+    void clear_flags(std::uint16_t f) { flags() &= ~f; }
+    bool test_flags(std::uint16_t f) const { return (flags() & f) == f; }
 
-    void set_mark(mark_t mark) { m_flags &= ~MARK_MASK; m_flags |= mark; }
-    void clear_mark() { m_flags &= ~MARK_MASK; }
-    mark_t get_mark() const { return (mark_t)(m_flags & MARK_MASK); }
+    void set_mark(mark_t mark) { flags() &= ~MARK_MASK; flags() |= mark; }
+    void clear_mark() { flags() &= ~MARK_MASK; }
+    mark_t get_mark() const { return (mark_t)(flags() & MARK_MASK); }
 
-    std::uint16_t prop_flags() const { return m_flags & FLAGS_PROP; }
+    std::uint16_t prop_flags() const { return flags() & FLAGS_PROP; }
+private:
+    std::uint16_t& flags() { return static_cast<Derived*>(this)->flags_ref(); }
+    std::uint16_t flags() const { return static_cast<Derived const*>(this)->flags_ref(); }
+};
+
+class flag_owner_t : public flag_interface_t<flag_owner_t>
+{
+    friend class flag_interface_t<flag_owner_t>;
 protected:
     std::uint16_t m_flags = 0;
+private:
+    std::uint16_t& flags_ref() { return m_flags; }
+    std::uint16_t flags_ref() const { return m_flags; }
 };
 
 #endif
@@ -26,6 +26,7 @@
 #include "debug_print.hpp"
 #include "text.hpp"
 #include "switch.hpp"
+#include "tier.hpp"
 
 //////////////
 // global_t //
@@ -804,6 +805,25 @@ std::vector<local_const_t> const* global_t::local_consts() const
     return nullptr;
 }
 
+////////////////
+// callable_t //
+////////////////
+
+std::size_t callable_t::summary_bytes() const
+{
+    return (m_precheck_rw.heap_bytes() + m_precheck_calls.heap_bytes()
+            + m_ir_reads.heap_bytes() + m_ir_writes.heap_bytes() + m_ir_group_vars.heap_bytes()
+            + m_ir_deref_groups.heap_bytes() + m_ir_calls.heap_bytes());
+}
+
+std::size_t callable_t::dense_summary_bytes() const
+{
+    auto const dense = [](auto const& bs) -> std::size_t { return bs ? bs.size() * sizeof(bitset_uint_t) : 0; };
+    return (dense(m_precheck_rw) + dense(m_precheck_calls)
+            + dense(m_ir_reads) + dense(m_ir_writes) + dense(m_ir_group_vars)
+            + dense(m_ir_deref_groups) + dense(m_ir_calls));
+}
+
 ///////////
 // fn_t  //
 ///////////
@@ -831,6 +851,7 @@ fn_t::fn_t(global_t& global, type_t type, fn_def_t&& fn_def, std::unique_ptr<mod
     }
 
     m_sloppy = compiler_options().sloppy || mod_test(this->mods(), MOD_sloppy);
+    m_sloppy |= compiler_options().tiered && !tier_hot(global.name);
     m_sloppy &= !mod_test(this->mods(), MOD_sloppy, false);
 
     if(mod_test(this->mods(), MOD_solo_interrupt))
@@ -1312,6 +1333,10 @@ void fn_t::compile()
             graphviz_ssa(ossa, ir);
     };
 
+    ai_stats_t ai_stats;
+    motion_stats_t motion_stats;
+    std::vector<switch_lowering_t> switch_lowerings;
+
     auto const optimize_suite = [&](bool post_byteified)
     {
 #define RUN_O(o, ...) do { if(o(__VA_ARGS__)) { \
@@ -1358,13 +1383,13 @@ void fn_t::compile()
             save_graph(ir, fmt("pre_loop_%_%", post_byteified, iter).c_str());
             RUN_O(o_loop, log, ir, post_byteified, sloppy());
             save_graph(ir, fmt("pre_ai_%_%", post_byteified, iter).c_str());
-            RUN_O(o_abstract_interpret, log, ir, post_byteified);
+            RUN_O(o_abstract_interpret, log, ir, post_byteified, &ai_stats);
             save_graph(ir, fmt("post_ai_%_%", post_byteified, iter).c_str());
 
             RUN_O(o_remove_unused_ssa, log, ir);
 
             save_graph(ir, fmt("pre_motion_%_%", post_byteified, iter).c_str());
-            RUN_O(o_motion, log, ir);
+            RUN_O(o_motion, log, ir, &motion_stats);
             save_graph(ir, fmt("post_motion_%_%", post_byteified, iter).c_str());
 
             if(post_byteified)
@@ -1394,9 +1419,9 @@ void fn_t::compile()
     calc_ir_bitsets(&ir);
     assert(ir_reads());
 
-    // Convert shifts and switches:
+    // Convert shifts, divisions, and switches:
     // NOTE: Do NOT use operator || here.
-    if(o_shl_tables(log, ir) | switch_partial_to_full(ir))
+    if(o_shl_tables(log, ir) | o_div_consts(log, ir) | switch_partial_to_full(ir, &switch_lowerings))
         optimize_suite(false);
     save_graph(ir, "3_transform");
 
@@ -1408,9 +1433,46 @@ void fn_t::compile()
     optimize_suite(true);
     save_graph(ir, "5_o2");
 
+    // Estimate how hot this function is, for tiered compilation:
+    if(compiler_options().tiered)
+    {
+        build_loops_and_order(ir);
+
+        std::uint64_t score = 0;
+        for(cfg_node_t const& cfg_node : ir)
+            score += depth_exp(loop_depth(cfg_node.handle())) * cfg_node.ssa_size();
+        m_tier_score = score * (precheck_called() + 1);
+    }
+
     std::size_t const proc_size = code_gen(log, ir, *this);
     save_graph(ir, "6_cg");
 
+    if(std::ostream* os = info_stream())
+    {
+        *os << "\nAI_STATS " << global.name << '\n';
+        *os << "  runs:          " << ai_stats.runs << '\n';
+        *os << "  visits:        " << ai_stats.visits << '\n';
+        *os << "  max visits:    " << ai_stats.max_visits << '\n';
+        *os << "  widenings:     " << ai_stats.widenings << '\n';
+        *os << "  narrow visits: " << ai_stats.narrow_visits << '\n';
+
+        *os << "\nPRE_STATS " << global.name << '\n';
+        *os << "  eliminated:    " << motion_stats.pre_eliminated << '\n';
+        *os << "  inserted:      " << motion_stats.pre_inserted << '\n';
+        *os << "  cost saved:    " << motion_stats.pre_cost_saved << '\n';
+
+        if(!switch_lowerings.empty())
+        {
+            *os << "\nSWITCH_STATS " << global.name << '\n';
+            for(switch_lowering_t const& l : switch_lowerings)
+            {
+                *os << "  " << to_string(l.strategy) << ": " << l.cases << " cases, " 
+                    << l.tables << " tables (" << l.table_entries << " entries), "
+                    << l.compares << " compares, ~" << l.bytes << " bytes, weight " << l.weight << '\n';
+            }
+        }
+    }
+
     // Calculate inline-ability
     assert(m_always_inline == false);
     if(fclass == FN_FN && !mod_test(mods(), MOD_inline, false))
@@ -1537,8 +1599,10 @@ void fn_t::calc_precheck_bitsets()
     assert(!m_precheck_calls);
 
     m_precheck_group_vars.alloc();
-    m_precheck_rw.alloc();
-    m_precheck_calls.alloc();
+
+    // These get compressed once built:
+    xbitset_t<gmember_ht> precheck_rw(nullptr);
+    xbitset_t<fn_ht> precheck_calls(nullptr);
 
     // For efficiency, we'll convert the mod groups into a bitset.
     bitset_uint_t* temp_bs = ALLOCA_T(bitset_uint_t, gv_bs_size);
@@ -1698,7 +1762,7 @@ void fn_t::calc_precheck_bitsets()
         for(auto const& pair : m_precheck_tracked->gvars_used)
         {
             gvar_ht const gvar = pair.first;
-            m_precheck_rw.set_n(gvar->begin().id, gvar->num_members());
+            precheck_rw.set_n(gvar->begin().id, gvar->num_members());
 
             if(group_ht const group = gvar->group())
             {
@@ -1729,17 +1793,20 @@ void fn_t::calc_precheck_bitsets()
             }
 
             m_precheck_group_vars |= call.m_precheck_group_vars;
-            m_precheck_rw |= call.m_precheck_rw;
+            precheck_rw |= call.m_precheck_rw;
 
             // Calls
-            m_precheck_calls.set(pair.first.id);
-            m_precheck_calls |= call.m_precheck_calls;
+            precheck_calls.set(pair.first.id);
+            precheck_calls |= call.m_precheck_calls;
 
             // 'wait_nmi' and 'fences'
             m_precheck_fences |= call.m_precheck_fences;
             m_precheck_wait_nmi |= call.m_precheck_wait_nmi;
         }
     }
+
+    m_precheck_rw = precheck_rw;
+    m_precheck_calls = precheck_calls;
 }
 
 void fn_t::mark_referenced_return()
@@ -1749,6 +1816,15 @@ void fn_t::mark_referenced_return()
     assert(referenced_return());
 }
 
+regs_t reg_conv_t::arg_regs() const
+{
+    regs_t regs = 0;
+    for(unsigned i = 0; i < args.size(); ++i)
+        if(args[i])
+            regs |= 1 << i;
+    return regs;
+}
+
 void fn_t::mark_referenced_param(unsigned param)
 {
     assert(param < 63);
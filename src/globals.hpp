@@ -356,20 +356,24 @@ public:
     bool bank_switches() const { assert(m_ir_writes); return m_bank_switches; }
 
     virtual void for_each_fn(std::function<void(fn_ht)> const& fn) const = 0;
+    // Heap memory used by the summary bitsets, compressed and as dense bitsets.
+    std::size_t summary_bytes() const;
+    std::size_t dense_summary_bytes() const;
 protected:
+    // Bitsets sized to every gmember or fn are stored compressed, as most of their bits are clear.
     xbitset_t<group_vars_ht> m_precheck_group_vars;
-    xbitset_t<gmember_ht> m_precheck_rw; // TODO: replace with more accurate reads and writes
-    xbitset_t<fn_ht> m_precheck_calls;
+    sparse_xbitset_t<gmember_ht> m_precheck_rw; // TODO: replace with more accurate reads and writes
+    sparse_xbitset_t<fn_ht> m_precheck_calls;
     romv_flags_t m_precheck_romv = 0;
     // If the function (or a called fn) waits on NMI
     bool m_precheck_wait_nmi = false;
     bool m_precheck_fences = false;
 
-    xbitset_t<gmember_ht> m_ir_reads;
-    xbitset_t<gmember_ht> m_ir_writes;
-    xbitset_t<group_vars_ht> m_ir_group_vars;
-    xbitset_t<group_ht> m_ir_deref_groups;
-    xbitset_t<fn_ht> m_ir_calls;
+    sparse_xbitset_t<gmember_ht> m_ir_reads;
+    sparse_xbitset_t<gmember_ht> m_ir_writes;
+    sparse_xbitset_t<group_vars_ht> m_ir_group_vars;
+    sparse_xbitset_t<group_ht> m_ir_deref_groups;
+    sparse_xbitset_t<fn_ht> m_ir_calls;
 
     // If the function uses a 'SSA_ready' node:
     bool m_ir_tests_ready = false;
@@ -446,6 +450,27 @@ struct precheck_tracked_t
     fc::vector_map<gvar_ht, pstring_t> gvars_used;
 };
 
+// Describes which one-byte arguments and returns a fn passes in registers,
+// rather than through memory.
+struct reg_conv_t
+{
+    std::array<locator_t, 3> args = {}; // Indexed by 'REG_A', 'REG_X', 'REG_Y'.
+    locator_t ret = {}; // Returned in 'REG_A'.
+
+    regs_t arg_regs() const;
+    explicit operator bool() const { return arg_regs() || ret; }
+
+    template<typename Fn>
+    void for_each_locator(Fn const& fn) const
+    {
+        for(locator_t const& arg : args)
+            if(arg)
+                fn(arg);
+        if(ret)
+            fn(ret);
+    }
+};
+
 class fn_t : public callable_t, public modded_t
 {
 friend class global_t;
@@ -478,6 +503,7 @@ public:
     static fn_t* solo_irq() { assert(compiler_phase() > PHASE_PARSE); return m_solo_irq; }
 
     bool sloppy() const { return m_sloppy; }
+    std::uint64_t tier_score() const { assert(global.compiled()); return m_tier_score; }
 
     precheck_tracked_t const& precheck_tracked() const { assert(m_precheck_tracked); return *m_precheck_tracked; }
     auto const& precheck_group_vars() const { assert(m_precheck_group_vars); return m_precheck_group_vars; }
@@ -493,6 +519,9 @@ public:
     locator_t first_bank_switch() const { assert(global.compiled()); return m_first_bank_switch; }
     void assign_first_bank_switch(locator_t loc) { assert(compiler_phase() == PHASE_COMPILE); m_first_bank_switch = loc; }
 
+    locator_t exit_bank() const { assert(global.compiled()); return m_exit_bank; }
+    void assign_exit_bank(locator_t loc) { assert(compiler_phase() == PHASE_COMPILE); m_exit_bank = loc; }
+
     rom_proc_ht rom_proc() const { return m_rom_proc; }
 
     void assign_lvars(lvars_manager_t&& lvars);
@@ -513,6 +542,19 @@ public:
     void for_each_referenced_locator(std::function<void(locator_t)> const& fn) const;
     void for_each_referenced_param_locator(std::function<void(locator_t)> const& fn) const;
 
+    // Tracks if the fn's label was used by something other than a fn call expression,
+    // i.e. inline assembly or the address-of operator.
+    void mark_referenced_label() { m_referenced_label.store(true); }
+    bool referenced_label() const { return m_referenced_label.load(); }
+
+    reg_conv_t const& reg_conv() const { assert(compiler_phase() >= PHASE_COMPILE); return m_reg_conv; }
+    void assign_reg_conv(reg_conv_t const& conv) { assert(compiler_phase() == PHASE_COMPILE); m_reg_conv = conv; }
+
+    // Counts the calls this fn makes, and how many of them used 'reg_conv_t':
+    unsigned num_calls() const { assert(compiler_phase() > PHASE_COMPILE); return m_num_calls; }
+    unsigned num_reg_conv_calls() const { assert(compiler_phase() > PHASE_COMPILE); return m_num_reg_conv_calls; }
+    void assign_num_calls(unsigned calls, unsigned reg_conv_calls) { m_num_calls = calls; m_num_reg_conv_calls = reg_conv_calls; }
+
     // Iterates this function, and every inline function it calls, once each.
     template<typename Fn>
     void for_each_inlined(Fn const& fn) const
@@ -584,6 +626,9 @@ private:
     // If we're using faster, but less accurate code generation:
     bool m_sloppy = false;
 
+    // Loop-weighted size, used to rank functions for tiered compilation:
+    std::uint64_t m_tier_score = 0;
+
     // If the function should be inlined:
     bool m_always_inline = false;
 
@@ -591,9 +636,18 @@ private:
     // (This is the bank the fn should be called from.)
     locator_t m_first_bank_switch = {};
 
+    // The bank every return of this function leaves loaded, if known.
+    // (Callers can use this to skip switching back to it.)
+    locator_t m_exit_bank = {};
+
     // Holds the assembly code generated.
     rom_proc_ht m_rom_proc;
 
+    // Arguments and returns passed in registers:
+    reg_conv_t m_reg_conv;
+    unsigned m_num_calls = 0;
+    unsigned m_num_reg_conv_calls = 0;
+
     // Aids in allocating RAM for local variables:
     lvars_manager_t m_lvars;
     std::array<std::vector<span_t>, NUM_ROMV> m_lvar_spans;
@@ -619,6 +673,7 @@ private:
     // (i.e. used with unary operator '&')
     // The first bit tracks the return. 
     std::atomic<std::uint64_t> m_referenced = 0;
+    std::atomic<bool> m_referenced_label = false;
 
     std::atomic<unsigned> m_precheck_called = 0; // Counts how many times this has been called.
 
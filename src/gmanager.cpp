@@ -68,8 +68,8 @@ void gmanager_t::init(fn_ht fn)
                 continue;
 
             assert(set_size == call.ir_reads().size());
-            bitset_or(set_size, initial_set, call.ir_reads().data());
-            bitset_or(set_size, initial_set, call.ir_writes().data());
+            call.ir_reads().or_into(initial_set);
+            call.ir_writes().or_into(initial_set);
         }
 
         for(auto const& pair : fn.precheck_tracked().goto_modes)
@@ -95,7 +95,7 @@ void gmanager_t::init(fn_ht fn)
     std::vector<bitset_uint_t*> eq_classes = { initial_set };
     std::vector<bitset_uint_t*> new_eq_classes;
 
-    auto const split = [&]( bitset_uint_t const* a, bitset_uint_t const* b)
+    auto const split = [&](bitset_uint_t const* rw_set)
     {
         bitset_uint_t* comp_set = bitset_pool.alloc(set_size);
         assert(bitset_all_clear(set_size, comp_set));
@@ -112,7 +112,7 @@ void gmanager_t::init(fn_ht fn)
             assert(set_size);
             for(unsigned i = 0; i < set_size; ++i)
             {
-                bitset_uint_t const rw = a[i] | b[i];
+                bitset_uint_t const rw = rw_set[i];
                 comp_set[i] = (in_set[i] & ~rw);
                 any_comp |= comp_set[i];
                 any_in |= (in_set[i] &= rw);
@@ -138,6 +138,8 @@ void gmanager_t::init(fn_ht fn)
         new_eq_classes.clear();
     };
 
+    bitset_uint_t* const call_rw = bitset_pool.alloc(set_size);
+
     fn->for_each_inlined([&](fn_t const& fn)
     {
         // Split calls.
@@ -154,7 +156,9 @@ void gmanager_t::init(fn_ht fn)
             if(call.always_inline())
                 continue;
 
-            split(call.ir_reads().data(), call.ir_writes().data());
+            call.ir_reads().copy_into(call_rw);
+            call.ir_writes().or_into(call_rw);
+            split(call_rw);
         }
     });
 
@@ -167,7 +171,7 @@ void gmanager_t::init(fn_ht fn)
             {
                 mods->for_each_list_vars(MODL_PRESERVES, [&](group_vars_ht gv, pstring_t)
                 {
-                    split((*gv)->vars()->gmembers().data(), (*gv)->vars()->gmembers().data());
+                    split((*gv)->vars()->gmembers().data());
                 });
             }
         }
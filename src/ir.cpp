@@ -1,8 +1,124 @@
 #include "ir.hpp"
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
 #include "builtin.hpp"
 #include "globals.hpp"
 #include "multi.hpp"
+#include "thread.hpp"
+
+////////////////////////////////////////
+// io_arena_t                         //
+////////////////////////////////////////
+
+static std::atomic<std::uint64_t> total_arena_allocs = 0;
+static std::atomic<std::uint64_t> total_arena_heap_allocs = 0;
+
+// Node buffers that don't fit in their small buffer get allocated from this.
+// Memory is bump allocated out of chunks that live as long as the thread,
+// and the whole arena gets reset each time an 'ir_t' is destroyed.
+// Capacities are powers of two, so freed buffers go on a free list per capacity,
+// to be reused when nodes grow during optimization.
+template<typename T>
+class io_arena_t
+{
+public:
+    T* alloc(std::uint16_t capacity)
+    {
+        assert(builtin::popcount((unsigned)capacity) == 1);
+        unsigned const size_class = builtin::ctz((unsigned)capacity);
+        ++num_allocs;
+
+        if(free_node_t* node = free_lists[size_class])
+        {
+            free_lists[size_class] = node->next;
+            return reinterpret_cast<T*>(node);
+        }
+
+        std::size_t const bytes = round_up(capacity * sizeof(T));
+
+        if(bytes > CHUNK_SIZE / 4)
+        {
+            ++num_heap_allocs;
+            return reinterpret_cast<T*>(large.emplace_back(new char[bytes]).get());
+        }
+
+        if(next + bytes > end)
+        {
+            if(chunks_used == chunks.size())
+            {
+                ++num_heap_allocs;
+                chunks.emplace_back(new char[CHUNK_SIZE]);
+            }
+
+            next = chunks[chunks_used++].get();
+            end = next + CHUNK_SIZE;
+        }
+
+        T* const ptr = reinterpret_cast<T*>(next);
+        next += bytes;
+        return ptr;
+    }
+
+    void free(T* ptr, std::uint16_t capacity)
+    {
+        assert(builtin::popcount((unsigned)capacity) == 1);
+        unsigned const size_class = builtin::ctz((unsigned)capacity);
+        free_node_t* node = reinterpret_cast<free_node_t*>(ptr);
+        node->next = free_lists[size_class];
+        free_lists[size_class] = node;
+    }
+
+    // Invalidates every buffer allocated, keeping the chunks around for reuse.
+    void reset()
+    {
+        free_lists = {};
+        large.clear();
+        chunks_used = 0;
+        next = end = nullptr;
+
+        total_arena_allocs += num_allocs;
+        total_arena_heap_allocs += num_heap_allocs;
+        num_allocs = num_heap_allocs = 0;
+    }
+
+private:
+    static constexpr std::size_t CHUNK_SIZE = 1 << 16;
+    static constexpr std::size_t ALIGN = alignof(std::max_align_t);
+
+    static_assert(sizeof(T) * 2 >= sizeof(void*)); // Capacities are always at least 2.
+    static_assert(alignof(T) <= ALIGN);
+
+    struct free_node_t { free_node_t* next; };
+
+    static constexpr std::size_t round_up(std::size_t bytes) { return (bytes + ALIGN - 1) & ~(ALIGN - 1); }
+
+    std::array<free_node_t*, 16> free_lists = {};
+    std::vector<std::unique_ptr<char[]>> chunks;
+    std::vector<std::unique_ptr<char[]>> large;
+    std::size_t chunks_used = 0;
+    char* next = nullptr;
+    char* end = nullptr;
+
+    std::uint64_t num_allocs = 0;
+    std::uint64_t num_heap_allocs = 0;
+};
+
+template<typename T>
+static io_arena_t<T>& io_arena()
+{
+    static TLS io_arena_t<T> arena;
+    return arena;
+}
+
+ir_arena_stats_t ir_arena_stats()
+{
+    return { total_arena_allocs.load(), total_arena_heap_allocs.load() };
+}
 
 // Allocates the specified amount, using small buffer optimization 
 // whenever possible.
@@ -25,7 +141,7 @@ void sbo_resize(T*& ptr, std::uint16_t& size, std::uint16_t& capacity,
         capacity = 1 << (builtin::rclz(new_size + 2u));
         passert(capacity >= new_size, capacity);
         passert(builtin::popcount((unsigned)capacity) == 1, capacity);
-        ptr = new T[capacity];
+        ptr = io_arena<T>().alloc(capacity);
     }
     else
     {
@@ -37,7 +153,7 @@ void sbo_resize(T*& ptr, std::uint16_t& size, std::uint16_t& capacity,
     size = new_size;
 
     if(old_capacity > StorageSize)
-        delete[] old_ptr;
+        io_arena<T>().free(old_ptr, old_capacity);
 }
 
 // This is like 'sbo_resize', except only used for the first allocation.
@@ -55,7 +171,7 @@ void sbo_alloc(T*& ptr, std::uint16_t& size, std::uint16_t& capacity,
         capacity = 1 << (builtin::rclz(new_size + 2u));
         assert(builtin::popcount((unsigned)capacity) == 1);
         assert(capacity >= new_size);
-        ptr = new T[capacity];
+        ptr = io_arena<T>().alloc(capacity);
     }
     else
     {
@@ -79,7 +195,7 @@ void sbo_free(T* ptr, std::uint16_t capacity,
               std::array<T, StorageSize>& storage)
 {
     if(capacity > StorageSize)
-        delete[] ptr;
+        io_arena<T>().free(ptr, capacity);
 }
 
 // Call while moving to properly move the small buffer.
@@ -200,10 +316,10 @@ void node_io_buffers_t<I, O, ISize, OSize>::reset()
 void ssa_node_t::create(cfg_ht cfg_h, ssa_op_t op, type_t type)
 {
     passert(m_io.empty(), input_size(), output_size(), cfg_h, handle(), (int)test_flags(FLAG_PRUNED), output(0));
+    hot() = { cfg_h, op, 0 };
     m_cfg_h = cfg_h;
     m_op = op;
     m_type = type;
-    m_flags = 0;
 #ifndef NDEBUG
     clear_flags(FLAG_PRUNED);
 #endif
@@ -215,7 +331,7 @@ void ssa_node_t::destroy()
     assert(!test_flags(FLAG_PRUNED));
     set_flags(FLAG_PRUNED);
 #endif
-    m_op = SSA_null;
+    hot().op = m_op = SSA_null;
     m_io.reset();
     assert(m_io.empty());
 }
@@ -705,7 +821,7 @@ void cfg_node_t::steal_ssa_nodes(cfg_ht cfg)
 
         cfg->list_erase(node);
         assert(!node.in_daisy());
-        node.m_cfg_h = handle();
+        node.set_cfg(handle());
         list_insert(node);
         if(in_daisy)
             list_append_daisy(node);
@@ -730,7 +846,7 @@ ssa_ht cfg_node_t::steal_ssa(ssa_ht ssa, bool steal_linked)
     old_cfg.list_erase(*ssa);
     old_cfg.m_ssa_size -= 1;
 
-    ssa->m_cfg_h = handle();
+    ssa->set_cfg(handle());
     list_insert(*ssa);
     if(in_daisy)
         list_append_daisy(*ssa);
@@ -892,6 +1008,12 @@ ir_t::~ir_t()
 {
     cfg_pool::clear();
     ssa_pool::clear();
+
+    // Every node is gone, so their buffers can be dropped all at once:
+    io_arena<ssa_fwd_edge_t>().reset();
+    io_arena<ssa_bck_edge_t>().reset();
+    io_arena<cfg_fwd_edge_t>().reset();
+    io_arena<cfg_bck_edge_t>().reset();
 }
 
 cfg_ht ir_t::emplace_cfg(std::uint16_t flags)
@@ -1125,6 +1247,13 @@ void ir_t::assert_valid(bool cg) const
                 assert(ssa_it->input(0)->op() == SSA_mul8_lo);
             }
 
+            // Div checks
+            if(ssa_it->op() == SSA_div8_rem)
+            {
+                assert(ssa_it->input(0).holds_ref());
+                assert(ssa_it->input(0)->op() == SSA_div8);
+            }
+
             // Cast Checks
             if(ssa_it->op() == SSA_cast)
             {
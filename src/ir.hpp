@@ -102,22 +102,47 @@ public:
 using ssa_buffer_t = node_io_buffers_t<ssa_fwd_edge_t, ssa_bck_edge_t, 3, 1>;
 using cfg_buffer_t = node_io_buffers_t<cfg_fwd_edge_t, cfg_bck_edge_t, 3, 2>;
 
+// Buffers that outgrow their SBO come from a per-thread arena,
+// which gets reset whenever an 'ir_t' is destroyed.
+struct ir_arena_stats_t
+{
+    std::uint64_t allocs = 0;      // Buffers handed out by the arena.
+    std::uint64_t heap_allocs = 0; // Chunks the arena requested from the heap.
+};
+
+ir_arena_stats_t ir_arena_stats();
+
 ////////////////////////////////////////
 // ssa_node_t                         //
 ////////////////////////////////////////
 
 class cfg_node_t;
 
-class alignas(32) ssa_node_t : public intrusive_t<ssa_ht>, public flag_owner_t
+// The fields of 'ssa_node_t' that passes scan most, stored in 'ssa_pool's parallel array.
+// Freed nodes have an op of 'SSA_null'.
+// The op and CFG node are mirrored inside 'ssa_node_t', as they're read through 
+// node pointers far more often than they're written.
+struct ssa_hot_t
+{
+    cfg_ht cfg = {};
+    ssa_op_t op = SSA_null;
+    std::uint16_t flags = 0;
+};
+
+static_assert(sizeof(ssa_hot_t) == 8);
+
+class alignas(32) ssa_node_t : public intrusive_t<ssa_ht>, public flag_interface_t<ssa_node_t>
 {
     friend class ssa_fwd_edge_t;
     friend class ssa_bck_edge_t;
     friend class cfg_node_t;
     friend class ir_t;
+    friend class flag_interface_t<ssa_node_t>;
     friend ssa_ht split_output_edge(ssa_ht ssa_node, bool this_cfg, unsigned output_i, ssa_op_t op);
 
     // The following data members have been carefully aligned based on 
     // 64-byte cache lines. Don't mess with it unless you understand it!
+    // Flags live in 'ssa_hot_t' instead.
 private:
     type_t m_type = TYPE_VOID;
     cfg_ht m_cfg_h = {};
@@ -129,6 +154,7 @@ public:
     ssa_node_t& operator=(ssa_node_t&&) = default;
 
     ssa_ht handle() const { return { this - ssa_pool::data() }; }
+    ssa_hot_t& hot() const { return handle().hot(); }
 
     cfg_ht cfg_node() const { return m_cfg_h; }
     cfg_ht input_cfg(std::size_t i) const;
@@ -147,7 +173,7 @@ public:
 
     // Be careful with this; don't change from/to phi nodes or other
     // nodes that have some extra behavior tied to their op.
-    void unsafe_set_op(ssa_op_t new_op) { m_op = new_op; }
+    void unsafe_set_op(ssa_op_t new_op) { hot().op = m_op = new_op; }
 
     // Allocates memory for input/output, but doesn't link anything up.
     void alloc_input(unsigned size);
@@ -197,6 +223,10 @@ private:
 
     void create(cfg_ht cfg_h, ssa_op_t op, type_t type);
     void destroy();
+    void set_cfg(cfg_ht cfg_h) { hot().cfg = m_cfg_h = cfg_h; }
+
+    std::uint16_t& flags_ref() { return hot().flags; }
+    std::uint16_t flags_ref() const { return hot().flags; }
 
     unsigned append_output(ssa_bck_edge_t edge);
     void remove_inputs_output(unsigned i);
@@ -356,6 +386,19 @@ public:
     std::size_t cfg_size() const { return m_size; }
     std::size_t ssa_size() const;
 
+    // Calls 'fn(ssa_ht)' on every SSA node, in handle order.
+    // This only reads the hot array, so prefer it over walking each CFG node
+    // when the order doesn't matter.
+    template<typename Fn>
+    void for_each_ssa(Fn const& fn) const
+    {
+        ssa_hot_t const* const hot = ssa_pool::hot_data();
+        std::uint32_t const size = ssa_pool::array_size();
+        for(std::uint32_t i = 1; i < size; ++i)
+            if(hot[i].op != SSA_null)
+                fn(ssa_ht{ i });
+    }
+
     // Creates a new node along an edge.
     cfg_ht split_edge(cfg_bck_edge_t edge);
 
@@ -1,11 +1,14 @@
 #include "ir_algo.hpp"
 
+#include <algorithm>
+
 #include "ir.hpp"
 
 TLS std::vector<cfg_algo_d> cfg_algo_pool;
 TLS std::vector<cfg_ht> postorder;
 TLS std::vector<cfg_ht> preorder;
 TLS std::vector<cfg_ht> loop_headers;
+TLS std::vector<cfg_ht> wto;
 
 ////////////////////////////////////////
 // order
@@ -210,6 +213,105 @@ void build_loops_and_order(ir_t& ir)
     assert(postorder.empty() || postorder.back() == ir.root);
 }
 
+////////////////////////////////////////
+// weak topological order
+////////////////////////////////////////
+
+// Paper: Efficient chaotic iteration strategies with widenings
+// By François Bourdoncle
+
+static TLS std::vector<unsigned> _wto_dfn;
+static TLS std::vector<cfg_ht> _wto_stack;
+static TLS unsigned _wto_num;
+
+static unsigned _visit_wto(cfg_ht h, std::vector<cfg_ht>& rev_partition);
+
+// Components are appended to 'rev_partition' in reverse order.
+static void _visit_wto_component(cfg_ht h, std::vector<cfg_ht>& rev_partition)
+{
+    unsigned const output_size = h->output_size();
+    for(unsigned i = 0; i < output_size; ++i)
+    {
+        cfg_ht const succ = h->output(i);
+        if(_wto_dfn[succ.id] == 0)
+            _visit_wto(succ, rev_partition);
+    }
+
+    algo(h).is_wto_head = true;
+    rev_partition.push_back(h);
+}
+
+static unsigned _visit_wto(cfg_ht h, std::vector<cfg_ht>& rev_partition)
+{
+    _wto_stack.push_back(h);
+    unsigned const dfn = _wto_dfn[h.id] = ++_wto_num;
+    unsigned head = dfn;
+    bool loop = false;
+
+    unsigned const output_size = h->output_size();
+    for(unsigned i = 0; i < output_size; ++i)
+    {
+        cfg_ht const succ = h->output(i);
+        unsigned const min = _wto_dfn[succ.id] ? _wto_dfn[succ.id] : _visit_wto(succ, rev_partition);
+        if(min <= head)
+        {
+            head = min;
+            loop = true;
+        }
+    }
+
+    if(head == dfn)
+    {
+        _wto_dfn[h.id] = UNVISITED; // Acts as infinity.
+
+        cfg_ht element = _wto_stack.back();
+        _wto_stack.pop_back();
+
+        if(loop)
+        {
+            while(element != h)
+            {
+                _wto_dfn[element.id] = 0;
+                element = _wto_stack.back();
+                _wto_stack.pop_back();
+            }
+
+            _visit_wto_component(h, rev_partition);
+        }
+        else
+            rev_partition.push_back(h);
+    }
+
+    return head;
+}
+
+void build_wto(ir_t const& ir)
+{
+    cfg_algo_pool.resize(cfg_pool::array_size());
+
+    for(auto& u : cfg_algo_pool)
+    {
+        u.wto_i = UNVISITED;
+        u.is_wto_head = false;
+    }
+
+    _wto_dfn.assign(cfg_pool::array_size(), 0);
+    _wto_stack.clear();
+    _wto_num = 0;
+
+    wto.clear();
+    wto.reserve(ir.cfg_size());
+
+    _visit_wto(ir.root, wto);
+    assert(_wto_stack.empty());
+
+    std::reverse(wto.begin(), wto.end());
+    for(unsigned i = 0; i < wto.size(); ++i)
+        algo(wto[i]).wto_i = i;
+
+    assert(wto.empty() || wto.front() == ir.root);
+}
+
 cfg_ht this_loop_header(cfg_ht h)
 {
     assert(h);
@@ -267,19 +369,13 @@ bool loop_is_parent_of(cfg_ht loop_header, cfg_ht node)
 
 bool dominates(cfg_ht a, cfg_ht b)
 {
-    assert(a);
-    while(b != a)
-    {
-        assert(a);
-        assert(b);
-
-        if(algo(b).postorder_i >= algo(a).postorder_i)
-            return false;
+    assert(a && b);
 
+    unsigned const depth = algo(a).dom_depth;
+    while(algo(b).dom_depth > depth)
         b = algo(b).idom;
-    }
-    assert(dom_intersect(a, b) == a);
-    return true;
+
+    return a == b;
 }
 
 bool orderless_dominates(cfg_ht a, cfg_ht b)
@@ -301,6 +397,27 @@ cfg_ht dom_intersect(cfg_ht a, cfg_ht b)
 {
     assert(a && b);
 
+    while(algo(a).dom_depth > algo(b).dom_depth)
+        a = algo(a).idom;
+    while(algo(b).dom_depth > algo(a).dom_depth)
+        b = algo(b).idom;
+
+    while(a != b)
+    {
+        a = algo(a).idom;
+        b = algo(b).idom;
+        assert(a && b);
+    }
+
+    return a;
+}
+
+// Like 'dom_intersect', but only requires 'idom' and the postorder,
+// which is all that's available while building.
+static cfg_ht _order_intersect(cfg_ht a, cfg_ht b)
+{
+    assert(a && b);
+
     while(a != b)
     {
         if(algo(a).postorder_i < algo(b).postorder_i)
@@ -313,6 +430,23 @@ cfg_ht dom_intersect(cfg_ht a, cfg_ht b)
     return a;
 }
 
+static unsigned _dom_depth(cfg_ht h)
+{
+    auto& a = algo(h);
+    if(a.dom_depth == UNVISITED)
+        a.dom_depth = a.idom ? _dom_depth(a.idom) + 1 : 0;
+    return a.dom_depth;
+}
+
+static void _update_dom_depths(ir_t const& ir)
+{
+    for(cfg_ht h = ir.cfg_begin(); h; ++h)
+        algo(h).dom_depth = UNVISITED;
+
+    for(cfg_ht h = ir.cfg_begin(); h; ++h)
+        _dom_depth(h);
+}
+
 // Finds the immediate dominator of every cfg node.
 // 
 // Paper: A Simple, Fast Dominance Algorithm
@@ -340,7 +474,7 @@ void build_dominators_from_order(ir_t& ir)
             {
                 cfg_ht pred = h->input(i);
                 if(pred == ir.root || algo(pred).idom)
-                    new_idom = new_idom ? dom_intersect(new_idom, pred) : pred;
+                    new_idom = new_idom ? _order_intersect(new_idom, pred) : pred;
             }
 
             if(new_idom != algo(h).idom)
@@ -351,6 +485,348 @@ void build_dominators_from_order(ir_t& ir)
         }
     }
     while(changed);
+
+    _update_dom_depths(ir);
+}
+
+////////////////////////////////////////
+// incremental dominance
+////////////////////////////////////////
+
+static TLS std::vector<unsigned> _dom_mark;
+static TLS unsigned _dom_stamp;
+static TLS std::vector<cfg_ht> _dom_stack;
+static TLS std::vector<cfg_ht> _dom_order;
+static TLS std::vector<unsigned> _dom_po;
+static TLS std::vector<std::pair<cfg_ht, unsigned>> _dom_dfs;
+static TLS std::vector<std::pair<unsigned, cfg_ht>> _dom_heap;
+
+static bool _dom_reachable(ir_t const& ir, cfg_ht h)
+{
+    return h == ir.root || algo(h).idom;
+}
+
+// Starts a new set of marks, all cleared.
+static void _new_dom_marks()
+{
+    _dom_mark.resize(cfg_pool::array_size());
+    if(++_dom_stamp == 0)
+    {
+        std::fill(_dom_mark.begin(), _dom_mark.end(), 0);
+        _dom_stamp = 1;
+    }
+}
+
+static bool _dom_marked(cfg_ht h) { return _dom_mark[h.id] == _dom_stamp; }
+static void _dom_set_mark(cfg_ht h) { _dom_mark[h.id] = _dom_stamp; }
+
+// Recomputes the dominator tree below 'sub_root' after edges were deleted.
+// Deletions only ever push immediate dominators further down the tree,
+// and every path into the subtree still passes through 'sub_root', 
+// so the subtree can be solved on its own.
+static void _rebuild_dom_subtree(ir_t const& ir, cfg_ht sub_root)
+{
+    _new_dom_marks();
+
+    // Order the nodes still reachable from 'sub_root' that it used to dominate:
+    _dom_po.resize(cfg_pool::array_size());
+    _dom_order.clear();
+    _dom_dfs.clear();
+    _dom_dfs.emplace_back(sub_root, 0);
+    _dom_set_mark(sub_root);
+    while(!_dom_dfs.empty())
+    {
+        auto& [h, i] = _dom_dfs.back();
+
+        if(i == h->output_size())
+        {
+            _dom_po[h.id] = _dom_order.size();
+            _dom_order.push_back(h);
+            _dom_dfs.pop_back();
+            continue;
+        }
+
+        cfg_ht const succ = h->output(i++);
+        if(!_dom_marked(succ) && dominates(sub_root, succ))
+        {
+            _dom_set_mark(succ);
+            _dom_dfs.emplace_back(succ, 0);
+        }
+    }
+
+    // Anything in the old subtree that wasn't reached is now unreachable:
+    _dom_stack.clear();
+    for(cfg_ht h = ir.cfg_begin(); h; ++h)
+        if(!_dom_marked(h) && dominates(sub_root, h))
+            _dom_stack.push_back(h);
+
+    for(cfg_ht h : _dom_stack)
+        algo(h).idom = {};
+
+    for(cfg_ht h : _dom_order)
+        if(h != sub_root)
+            algo(h).idom = {};
+
+    auto const intersect = [](cfg_ht a, cfg_ht b) -> cfg_ht
+    {
+        while(a != b)
+        {
+            if(_dom_po[a.id] < _dom_po[b.id])
+                a = algo(a).idom;
+            if(_dom_po[a.id] > _dom_po[b.id])
+                b = algo(b).idom;
+            assert(a && b);
+        }
+        return a;
+    };
+
+    // Same as 'build_dominators_from_order', but rooted at 'sub_root':
+    bool changed;
+    do
+    {
+        changed = false;
+
+        for(auto it = _dom_order.rbegin()+1; it < _dom_order.rend(); ++it)
+        {
+            cfg_ht const h = *it;
+            cfg_ht new_idom = {};
+
+            unsigned const input_size = h->input_size();
+            for(unsigned i = 0; i < input_size; ++i)
+            {
+                cfg_ht const pred = h->input(i);
+                // Predecessors outside the subtree are unreachable.
+                if(_dom_marked(pred) && (pred == sub_root || algo(pred).idom))
+                    new_idom = new_idom ? intersect(new_idom, pred) : pred;
+            }
+
+            if(new_idom != algo(h).idom)
+            {
+                algo(h).idom = new_idom;
+                changed = true;
+            }
+        }
+    }
+    while(changed);
+
+    _update_dom_depths(ir);
+}
+
+// Paper: An Experimental Study of Dynamic Dominators
+// By Loukas Georgiadis, Giuseppe F. Italiano, Luigi Laura, and Federico Santaroni
+// (This implements the depth-based search of their 'DSNCA' insertion.)
+void dom_insert_edge(ir_t const& ir, cfg_ht from, cfg_ht to)
+{
+    cfg_algo_pool.resize(cfg_pool::array_size());
+
+    if(!_dom_reachable(ir, from))
+        return;
+
+    if(!_dom_reachable(ir, to))
+    {
+        // 'to' just became reachable, along with anything it leads to.
+        algo(to).idom = from;
+        algo(to).dom_depth = algo(from).dom_depth + 1;
+
+        unsigned const output_size = to->output_size();
+        for(unsigned i = 0; i < output_size; ++i)
+            dom_insert_edge(ir, to, to->output(i));
+        return;
+    }
+
+    cfg_ht const nca = dom_intersect(from, to);
+    unsigned const nca_depth = algo(nca).dom_depth;
+
+    // If 'nca' is already the immediate dominator, nothing changes.
+    if(algo(to).dom_depth <= nca_depth + 1)
+        return;
+
+    // A node is affected if it can be reached from 'to' using only nodes
+    // deeper than its immediate dominator. 
+    // Every affected node gets 'nca' as its new immediate dominator.
+    _new_dom_marks();
+    _dom_heap.clear();
+    _dom_order.clear();
+
+    _dom_set_mark(to);
+    _dom_heap.emplace_back(algo(to).dom_depth, to);
+
+    while(!_dom_heap.empty())
+    {
+        std::pop_heap(_dom_heap.begin(), _dom_heap.end());
+        auto const [depth, z] = _dom_heap.back();
+        _dom_heap.pop_back();
+
+        _dom_order.push_back(z);
+
+        _dom_stack.clear();
+        _dom_stack.push_back(z);
+        while(!_dom_stack.empty())
+        {
+            cfg_ht const h = _dom_stack.back();
+            _dom_stack.pop_back();
+
+            unsigned const output_size = h->output_size();
+            for(unsigned i = 0; i < output_size; ++i)
+            {
+                cfg_ht const succ = h->output(i);
+                if(_dom_marked(succ))
+                    continue;
+
+                unsigned const succ_depth = algo(succ).dom_depth;
+                if(succ_depth > depth)
+                {
+                    _dom_set_mark(succ);
+                    _dom_stack.push_back(succ);
+                }
+                else if(succ_depth > nca_depth + 1)
+                {
+                    _dom_set_mark(succ);
+                    _dom_heap.emplace_back(succ_depth, succ);
+                    std::push_heap(_dom_heap.begin(), _dom_heap.end());
+                }
+            }
+        }
+    }
+
+    for(cfg_ht h : _dom_order)
+        algo(h).idom = nca;
+
+    _update_dom_depths(ir);
+}
+
+void dom_delete_edge(ir_t const& ir, cfg_ht from, cfg_ht to)
+{
+    cfg_algo_pool.resize(cfg_pool::array_size());
+
+    if(!_dom_reachable(ir, from) || !_dom_reachable(ir, to))
+        return;
+
+    // Deleting an edge into a dominator changes nothing,
+    // as every path using it passes through 'to' beforehand.
+    cfg_ht const nca = dom_intersect(from, to);
+    if(nca == to)
+        return;
+
+    _rebuild_dom_subtree(ir, nca);
+}
+
+void dom_split_edge(ir_t const& ir, cfg_ht from, cfg_ht split, cfg_ht to)
+{
+    cfg_algo_pool.resize(cfg_pool::array_size());
+
+    if(!_dom_reachable(ir, from))
+        return;
+
+    algo(split).idom = from;
+    algo(split).dom_depth = algo(from).dom_depth + 1;
+
+    // 'split' takes over when every other way into 'to' is a back edge.
+    if(to == ir.root)
+        return;
+    unsigned const input_size = to->input_size();
+    for(unsigned i = 0; i < input_size; ++i)
+    {
+        cfg_ht const input = to->input(i);
+        if(input != split && _dom_reachable(ir, input) && !dominates(to, input))
+            return;
+    }
+
+    assert(algo(to).idom == from);
+    algo(to).idom = split;
+    _update_dom_depths(ir);
+}
+
+#ifndef NDEBUG
+void assert_dominators_valid(ir_t const& ir)
+{
+    std::vector<bool> reachable(cfg_pool::array_size());
+    std::vector<bool> reached(cfg_pool::array_size());
+
+    // Finds which nodes are reachable from the root without passing through 'removed'.
+    auto const search = [&](cfg_ht removed, std::vector<bool>& reached)
+    {
+        std::fill(reached.begin(), reached.end(), false);
+        if(ir.root == removed)
+            return;
+
+        std::vector<cfg_ht> stack = { ir.root };
+        reached[ir.root.id] = true;
+        while(!stack.empty())
+        {
+            cfg_ht const h = stack.back();
+            stack.pop_back();
+            for(unsigned i = 0; i < h->output_size(); ++i)
+            {
+                cfg_ht const succ = h->output(i);
+                if(succ != removed && !reached[succ.id])
+                {
+                    reached[succ.id] = true;
+                    stack.push_back(succ);
+                }
+            }
+        }
+    };
+
+    search({}, reachable);
+
+    for(cfg_ht h = ir.cfg_begin(); h; ++h)
+    {
+        passert(reachable[h.id] == _dom_reachable(ir, h), h, reachable[h.id]);
+        if(cfg_ht idom = algo(h).idom)
+            passert(algo(h).dom_depth == algo(idom).dom_depth + 1, h, idom);
+    }
+
+    // 'd' dominates 'h' iff removing 'd' makes 'h' unreachable.
+    for(cfg_ht d = ir.cfg_begin(); d; ++d)
+    {
+        if(!reachable[d.id])
+            continue;
+
+        search(d, reached);
+
+        for(cfg_ht h = ir.cfg_begin(); h; ++h)
+            if(h != d && reachable[h.id])
+                passert(reached[h.id] != dominates(d, h), d, h);
+    }
+}
+#endif
+
+////////////////////////////////////////
+// loop updates
+////////////////////////////////////////
+
+void loop_split_edge(cfg_ht from, cfg_ht split, cfg_ht to)
+{
+    cfg_algo_pool.resize(cfg_pool::array_size());
+
+    cfg_ht header = this_loop_header(from);
+    while(header && header != to && !loop_is_parent_of(header, to))
+        header = algo(header).iloop_header;
+
+    algo(split).iloop_header = header;
+    algo(split).is_loop_header = false;
+}
+
+void loop_move_header(ir_t const& ir, cfg_ht old_header, cfg_ht new_header)
+{
+    cfg_algo_pool.resize(cfg_pool::array_size());
+
+    for(cfg_ht h = ir.cfg_begin(); h; ++h)
+        if(h != new_header && algo(h).iloop_header == old_header)
+            algo(h).iloop_header = new_header;
+
+    auto& old_a = algo(old_header);
+    auto& new_a = algo(new_header);
+
+    assert(old_a.is_loop_header);
+    old_a.is_loop_header = false;
+    new_a.is_loop_header = true;
+    new_a.iloop_header = old_a.iloop_header;
+    new_a.header_i = old_a.header_i;
+
+    if(new_a.header_i < loop_headers.size() && loop_headers[new_a.header_i] == old_header)
+        loop_headers[new_a.header_i] = new_header;
 }
 
 ////////////////////////////////////////
@@ -19,11 +19,14 @@ struct cfg_algo_d
     unsigned preorder_i = UNVISITED;
     unsigned postorder_i = UNVISITED;
     cfg_ht idom = {};
+    unsigned dom_depth = 0; // Depth in the dominator tree, with the root at 0.
     cfg_ht iloop_header = {};
     unsigned dfsp = 0; // implementation detail, used inside loop generation algorithm.
     unsigned header_i = 0;
     bool is_loop_header = false;
     bool is_irreducible = false;
+    unsigned wto_i = UNVISITED;
+    bool is_wto_head = false;
 
     // Incoming edges with
     std::unique_ptr<reentry_set_t> reentry_in;
@@ -34,6 +37,7 @@ extern TLS std::vector<cfg_algo_d> cfg_algo_pool;
 extern TLS std::vector<cfg_ht> postorder;
 extern TLS std::vector<cfg_ht> preorder;
 extern TLS std::vector<cfg_ht> loop_headers;
+extern TLS std::vector<cfg_ht> wto;
 
 inline cfg_algo_d& algo(cfg_ht h)
 { 
@@ -48,6 +52,10 @@ void build_order(ir_t const& ir);
 // Does everything 'build_order' does, but also identifies loops.
 void build_loops_and_order(ir_t& ir);
 
+// Fills 'wto' with a weak topological order, setting 'wto_i' and 'is_wto_head'.
+// Every cycle in the CFG passes through at least one head.
+void build_wto(ir_t const& ir);
+
 bool loop_is_parent_of(cfg_ht loop_header, cfg_ht node);
 
 // If 'h' is a loop header, returns itself.
@@ -63,6 +71,22 @@ std::uint64_t depth_exp(std::uint64_t depth, std::uint64_t scale = 4, std::uint6
 // Requires that the order was built.
 void build_dominators_from_order(ir_t& ir);
 
+// These update the dominance tree after a single CFG edge changes,
+// instead of rebuilding it. Call them after modifying the edge.
+// The order isn't updated, but 'dominates' and 'dom_intersect' don't need it.
+void dom_insert_edge(ir_t const& ir, cfg_ht from, cfg_ht to);
+void dom_delete_edge(ir_t const& ir, cfg_ht from, cfg_ht to);
+// For when 'ir_t::split_edge' put 'split' along the edge from 'from' to 'to'.
+void dom_split_edge(ir_t const& ir, cfg_ht from, cfg_ht split, cfg_ht to);
+
+// Compares the dominance tree against a from-scratch computation.
+#ifdef NDEBUG
+[[gnu::always_inline]]
+inline void assert_dominators_valid(ir_t const& ir) {}
+#else
+void assert_dominators_valid(ir_t const& ir);
+#endif
+
 // If 'a' dominates 'b'
 bool dominates(cfg_ht a, cfg_ht b); 
 
@@ -76,6 +100,13 @@ cfg_ht dom_intersect(cfg_ht a, cfg_ht b);
 // Sorts a single cfg_node. Outputs in 'vec' (which should be large enough)
 void toposort_cfg_node(cfg_ht cfg_node, ssa_ht* vec);
 
+// These update loop information after a CFG change, instead of rebuilding it.
+// 'loop_split_edge' puts 'split', which was created along the edge
+// from 'from' to 'to', in the innermost loop containing both.
+void loop_split_edge(cfg_ht from, cfg_ht split, cfg_ht to);
+// Makes 'new_header' the header of the loop 'old_header' used to head.
+void loop_move_header(ir_t const& ir, cfg_ht old_header, cfg_ht new_header);
+
 // Splits edges.
 // If 'split_back_edges' is false, loop information must be built before calling.
 void split_critical_edges(ir_t& ir, bool split_back_edges = true);
@@ -17,11 +17,12 @@ struct ssa_bck_edge_t;
 struct cfg_fwd_edge_t;
 struct cfg_bck_edge_t;
 struct ssa_value_t;
+struct ssa_hot_t;
 
 using ssa_data_pool = static_any_pool_t<class ssa_node_t>;
 using cfg_data_pool = static_any_pool_t<class cfg_node_t>;
 
-using ssa_pool = static_intrusive_pool_t<class ssa_node_t>;
+using ssa_pool = static_intrusive_pool_t<class ssa_node_t, class ssa_node_t, ssa_hot_t>;
 using cfg_pool = static_intrusive_pool_t<class cfg_node_t>;
 
 using ssa_ht = ssa_pool::handle_t;
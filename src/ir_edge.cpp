@@ -49,9 +49,10 @@ type_t ssa_fwd_edge_t::type() const
 input_class_t ssa_bck_edge_t::input_class() const
 {
     assert(index < handle->input_size());
+    ssa_op_t const op = handle.hot().op;
     if(index == 0)
-        return ssa_input0_class(handle->op());
-    if(handle->op() == SSA_trace)
+        return ssa_input0_class(op);
+    if(op == SSA_trace)
         return INPUT_LINK;
     return INPUT_VALUE;
 }
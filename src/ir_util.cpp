@@ -3,6 +3,7 @@
 #include "flat/small_set.hpp"
 
 #include "globals.hpp"
+#include "mapper.hpp"
 #include "worklist.hpp"
 
 bool io_pure(ssa_node_t const& ssa_node)
@@ -32,10 +33,19 @@ bool pure(ssa_node_t const& ssa_node)
 
 bool clobbers_unknown_bank(fn_t const& fn, ssa_node_t const& ssa_node)
 {
+    // With a data window, trampolines restore the caller's code bank along with its data,
+    // which might not be the data we switched to.
+    // (Static fns that never switch banks can ignore this.)
+    bool const window = mapper().data_window 
+        && (!mod_test(fn.mods(), MOD_static) || fn.returns_in_different_bank());
+
     if(ssa_node.op() == SSA_fn_call)
     {
         fn_t const& call = *get_fn(ssa_node);
-        if(mod_test(call.mods(), MOD_static) && mod_test(fn.mods(), MOD_static) && call.returns_in_different_bank())
+        bool const call_static = mod_test(call.mods(), MOD_static);
+        if(call_static && mod_test(fn.mods(), MOD_static) && call.returns_in_different_bank())
+            return true;
+        if(window && (!call_static || ssa_node.input(1) || call.returns_in_different_bank()))
             return true;
     }
     else if(ssa_node.op() == SSA_fn_ptr_call)
@@ -43,11 +53,27 @@ bool clobbers_unknown_bank(fn_t const& fn, ssa_node_t const& ssa_node)
         fn_set_t const& call = *get_fn_set(ssa_node);
         if(call.all_static() && mod_test(fn.mods(), MOD_static) && call.returns_in_different_bank())
             return true;
+        if(window && (!call.all_static() || call.returns_in_different_bank()))
+            return true;
     }
 
     return false;
 }
 
+locator_t bank_after_call(fn_t const& fn, ssa_node_t const& ssa_node)
+{
+    // Only direct calls between static fns leave the callee's bank loaded.
+    // (Everything else goes through a trampoline.)
+    if(ssa_node.op() != SSA_fn_call || ssa_node.input(1) || !mod_test(fn.mods(), MOD_static))
+        return {};
+
+    fn_t const& call = *get_fn(ssa_node);
+    if(!mod_test(call.mods(), MOD_static))
+        return {};
+
+    return call.exit_bank();
+}
+
 unsigned estimate_cost(ssa_node_t const& ssa_node)
 {
     if(ssa_flags(ssa_node.op()) & SSAF_EXPENSIVE)
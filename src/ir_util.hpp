@@ -12,6 +12,9 @@ bool ct_pure(ssa_node_t const& ssa_node);
 // If 'ssa_node' changes the bank to an unspecified value.
 bool clobbers_unknown_bank(fn_t const& fn, ssa_node_t const& ssa_node);
 
+// If 'ssa_node' is a call that returns with a known bank loaded, returns that bank.
+locator_t bank_after_call(fn_t const& fn, ssa_node_t const& ssa_node);
+
 // Loosely approximates the cost of each ssa node, proportional to (but not equal to) cycles.
 unsigned estimate_cost(ssa_node_t const& ssa_node);
 
@@ -0,0 +1,112 @@
+#ifndef LEX_SCAN_HPP
+#define LEX_SCAN_HPP
+
+// Skips long runs of characters that loop a lexer DFA state back to itself,
+// such as the bodies of comments and identifiers.
+// 'lexer_gen' tags each DFA state whose loop matches one of these sets.
+
+#include <cstdint>
+
+#include "builtin.hpp"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+enum lex_loop_t : std::uint8_t
+{
+    LEX_LOOP_NONE = 0,
+    LEX_LOOP_SPACE,   // ' '
+    LEX_LOOP_COMMENT, // Anything but '\n', '\r', and '\0'
+    LEX_LOOP_IDCHAR,  // [A-Za-z0-9_]
+    LEX_LOOP_IDLOWER, // [a-z0-9_]
+    LEX_LOOP_IDUPPER, // [A-Z0-9_]
+    NUM_LEX_LOOPS,
+};
+
+constexpr bool lex_loop_contains(lex_loop_t loop, unsigned char c)
+{
+    bool const digit = c >= '0' && c <= '9';
+    bool const lower = c >= 'a' && c <= 'z';
+    bool const upper = c >= 'A' && c <= 'Z';
+
+    switch(loop)
+    {
+    case LEX_LOOP_SPACE:   return c == ' ';
+    case LEX_LOOP_COMMENT: return c != '\n' && c != '\r' && c != '\0';
+    case LEX_LOOP_IDCHAR:  return c == '_' || digit || lower || upper;
+    case LEX_LOOP_IDLOWER: return c == '_' || digit || lower;
+    case LEX_LOOP_IDUPPER: return c == '_' || digit || upper;
+    default: return false;
+    }
+}
+
+#ifdef __SSE2__
+namespace lex_scan_impl
+{
+    // Signed compares work, as every range is ASCII.
+    inline __m128i in_range(__m128i v, char lo, char hi)
+    {
+        return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(lo - 1)),
+                             _mm_cmplt_epi8(v, _mm_set1_epi8(hi + 1)));
+    }
+
+    inline __m128i contains(lex_loop_t loop, __m128i v)
+    {
+        __m128i const under_or_digit = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('_')), in_range(v, '0', '9'));
+
+        switch(loop)
+        {
+        case LEX_LOOP_SPACE:
+            return _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+        case LEX_LOOP_COMMENT:
+            return _mm_andnot_si128(
+                _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')),
+                                          _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'))),
+                             _mm_cmpeq_epi8(v, _mm_setzero_si128())),
+                _mm_set1_epi8(-1));
+        case LEX_LOOP_IDCHAR:
+            return _mm_or_si128(under_or_digit, _mm_or_si128(in_range(v, 'a', 'z'), in_range(v, 'A', 'Z')));
+        case LEX_LOOP_IDLOWER:
+            return _mm_or_si128(under_or_digit, in_range(v, 'a', 'z'));
+        case LEX_LOOP_IDUPPER:
+            return _mm_or_si128(under_or_digit, in_range(v, 'A', 'Z'));
+        default:
+            return _mm_setzero_si128();
+        }
+    }
+}
+#endif
+
+// Returns a pointer to the first character at or after 'ptr' not in 'loop'.
+// The string must be null-terminated, as '\0' is in no set.
+inline char const* lex_scan(char const* ptr, lex_loop_t loop)
+{
+    // Most runs are short, so check a few characters before vectorizing.
+    for(unsigned i = 0; i < 4; ++i, ++ptr)
+        if(!lex_loop_contains(loop, *ptr))
+            return ptr;
+
+#ifdef __SSE2__
+    // Aligned loads never cross a page boundary, so reading past the terminator is harmless.
+    unsigned const misalign = reinterpret_cast<std::uintptr_t>(ptr) & 15;
+    char const* block = ptr - misalign;
+    unsigned ignore = (1u << misalign) - 1;
+
+    while(true)
+    {
+        __m128i const v = _mm_load_si128(reinterpret_cast<__m128i const*>(block));
+        unsigned const outside = ~unsigned(_mm_movemask_epi8(lex_scan_impl::contains(loop, v))) & 0xFFFF & ~ignore;
+        if(outside)
+            return block + builtin::ctz(outside);
+        block += 16;
+        ignore = 0;
+    }
+#else
+    while(lex_loop_contains(loop, *ptr))
+        ++ptr;
+    return ptr;
+#endif
+}
+
+#endif
@@ -1,3322 +1,708 @@
 #include "lex_tables.hpp"
 namespace lex
 {
-extern unsigned const lexer_ec_table[256] = {
-    0, 628, 628, 628, 628, 628, 628, 628, 628, 628, 1256, 628, 628, 1884, 628, 628,
-    628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
-    2512, 3140, 3768, 4396, 5024, 5652, 6280, 6908, 7536, 8164, 8792, 9420, 10048, 10676, 11304, 11932,
-    12560, 12560, 13188, 13188, 13188, 13188, 13188, 13188, 13188, 13188, 13816, 14444, 15072, 15700, 16328, 628,
-    16956, 17584, 18212, 18840, 19468, 20096, 20724, 21352, 21352, 21980, 21352, 22608, 23236, 23864, 24492, 25120,
-    25748, 21352, 26376, 27004, 27632, 28260, 28888, 29516, 21352, 30144, 21352, 30772, 628, 31400, 32028, 32656,
-    33284, 33912, 34540, 35168, 35796, 36424, 37052, 37680, 38308, 38936, 39564, 40192, 40820, 41448, 42076, 42704,
-    43332, 43960, 44588, 45216, 45844, 46472, 47100, 47728, 48356, 48984, 49612, 50240, 50868, 51496, 52124, 628,
-    628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
-    628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
-    628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
-    628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
-    628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
-    628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
-    628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
-    628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
+// 631 states, 84 character classes, 4809 comb entries (53004 dense)
+extern std::uint8_t const lexer_ec_table[256] = {
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 3, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 22, 23, 24, 25, 26, 1,
+    27, 28, 29, 30, 31, 32, 33, 34, 34, 35, 34, 36, 37, 38, 39, 40,
+    41, 34, 42, 43, 44, 45, 46, 47, 34, 48, 34, 49, 1, 50, 51, 52,
+    53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68,
+    69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
 };
-extern token_type_t const lexer_transition_table[52752] = {
-
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 216, 1, 4, 4, 5, 82, 119, 71, 69,
-    621, 2, 2, 3, 227, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 175, 175, 175, 175, 137, 175,
-    175, 175, 175, 175, 152, 140, 175, 94, 95, 109, 0, 70, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175,
-    175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38,
-    175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39,
-    175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175,
-    51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175,
-    175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175,
-    175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19,
-    175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175,
-    175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175,
-    24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33,
-    175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37,
-    26, 40, 0, 0, 176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 176, 176, 135,
-    143, 141, 144, 142, 145, 148, 151, 147, 150, 175, 63, 175, 62, 146, 149, 58,
-    175, 175, 175, 175, 155, 153, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 67, 175, 65, 175, 175, 64, 175, 175, 175, 66, 156,
-    154, 157, 163, 159, 162, 158, 161, 176, 176, 173, 166, 167, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 57, 175, 175, 175, 175, 59, 175, 176, 172, 138,
-    136, 139, 168, 169, 176, 176, 174, 164, 165, 0, 114, 107, 0, 106, 160, 103,
-    121, 55, 175, 60, 0, 175, 56, 175, 175, 175, 175, 175, 178, 175, 179, 179,
-    177, 128, 127, 117, 129, 61, 175, 175, 125, 170, 171, 97, 0, 2, 0, 98,
-    126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 0, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 175, 175,
-    175, 175, 137, 175, 175, 175, 175, 175, 152, 140, 175, 94, 95, 109, 0, 70,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9,
-    175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175,
-    175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22,
-    175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27,
-    175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25,
-    175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41,
-    175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175,
-    18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175,
-    175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175,
-    175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175,
-    175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175,
-    175, 175, 175, 37, 26, 40, 0, 0, 176, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 176, 176, 135, 143, 141, 144, 142, 145, 148, 151, 147, 150, 175, 63, 175,
-    62, 146, 149, 58, 175, 175, 175, 175, 155, 153, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 67, 175, 65, 175, 175, 64, 175,
-    175, 175, 66, 156, 154, 157, 163, 159, 162, 158, 161, 176, 176, 173, 166, 167,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 57, 175, 175, 175, 175, 59,
-    175, 176, 172, 138, 136, 139, 168, 169, 176, 176, 174, 164, 165, 0, 114, 107,
-    0, 106, 160, 103, 121, 55, 175, 60, 0, 175, 56, 175, 175, 175, 175, 175,
-    178, 175, 179, 179, 177, 128, 127, 117, 129, 61, 175, 175, 125, 170, 171, 97,
-    0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 217,
-    1, 4, 626, 5, 82, 119, 71, 69, 225, 2, 621, 3, 229, 3, 227, 0,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    113, 84, 175, 175, 175, 175, 137, 175, 175, 175, 175, 175, 152, 140, 175, 94,
-    95, 109, 0, 70, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175,
-    49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53,
-    175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175,
-    175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175,
-    175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35,
-    52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175,
-    175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175,
-    175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21,
-    175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175,
-    175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175,
-    175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175,
-    175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0, 176, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 176, 176, 135, 143, 141, 144, 142, 145, 148, 151, 147,
-    150, 175, 63, 175, 62, 146, 149, 58, 175, 175, 175, 175, 155, 153, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 67, 175, 65,
-    175, 175, 64, 175, 175, 175, 66, 156, 154, 157, 163, 159, 162, 158, 161, 176,
-    176, 173, 166, 167, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 57, 175,
-    175, 175, 175, 59, 175, 176, 172, 138, 136, 139, 168, 169, 176, 176, 174, 164,
-    165, 0, 114, 107, 0, 106, 160, 103, 121, 55, 175, 60, 0, 175, 56, 175,
-    175, 175, 175, 175, 178, 175, 179, 179, 177, 128, 127, 117, 129, 61, 175, 175,
-    125, 170, 171, 97, 0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 218, 1, 626, 4, 5, 82, 119, 71, 69, 226, 621, 2, 3,
-    230, 227, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 175, 175, 175, 175, 137, 175, 175, 175, 175, 175,
-    152, 140, 175, 94, 95, 109, 0, 70, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81,
-    175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0,
-    83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175,
-    29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75,
-    175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175,
-    175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175,
-    175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44,
-    175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14,
-    175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175,
-    34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175,
-    15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32,
-    175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0,
-    176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 176, 176, 135, 143, 141, 144, 142,
-    145, 148, 151, 147, 150, 175, 63, 175, 62, 146, 149, 58, 175, 175, 175, 175,
-    155, 153, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 67, 175, 65, 175, 175, 64, 175, 175, 175, 66, 156, 154, 157, 163, 159,
-    162, 158, 161, 176, 176, 173, 166, 167, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 57, 175, 175, 175, 175, 59, 175, 176, 172, 138, 136, 139, 168, 169,
-    176, 176, 174, 164, 165, 0, 114, 107, 0, 106, 160, 103, 121, 55, 175, 60,
-    0, 175, 56, 175, 175, 175, 175, 175, 178, 175, 179, 179, 177, 128, 127, 117,
-    129, 61, 175, 175, 125, 170, 171, 97, 0, 2, 0, 98, 126, 178, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 219, 1, 4, 4, 219, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 175, 175, 175, 175, 137, 175,
-    175, 175, 175, 175, 152, 140, 175, 94, 95, 109, 0, 70, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175,
-    175, 175, 307, 0, 83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38,
-    175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39,
-    175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175,
-    51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175,
-    175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175,
-    175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19,
-    175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175,
-    175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175,
-    24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33,
-    175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37,
-    26, 40, 0, 0, 176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 176, 176, 135,
-    143, 141, 144, 142, 145, 148, 151, 147, 150, 175, 63, 175, 62, 146, 149, 58,
-    175, 175, 175, 175, 155, 153, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 67, 175, 65, 175, 175, 64, 175, 175, 175, 66, 156,
-    154, 157, 163, 159, 162, 158, 161, 176, 176, 173, 166, 167, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 57, 175, 175, 175, 175, 59, 175, 176, 172, 138,
-    136, 139, 168, 169, 176, 176, 174, 164, 165, 0, 114, 107, 0, 106, 160, 103,
-    121, 55, 175, 60, 0, 175, 56, 175, 175, 175, 175, 175, 178, 175, 179, 179,
-    177, 128, 127, 117, 129, 61, 175, 175, 125, 170, 171, 97, 0, 2, 0, 98,
-    126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 220, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 175, 175,
-    175, 175, 137, 175, 175, 175, 175, 175, 152, 140, 175, 94, 95, 109, 0, 70,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9,
-    175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175,
-    175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22,
-    175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27,
-    175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25,
-    175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41,
-    175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175,
-    18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175,
-    175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175,
-    175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175,
-    175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175,
-    175, 175, 175, 37, 26, 40, 0, 0, 176, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 176, 176, 135, 143, 141, 144, 142, 145, 148, 151, 147, 150, 175, 63, 175,
-    62, 146, 149, 58, 175, 175, 175, 175, 155, 153, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 67, 175, 65, 175, 175, 64, 175,
-    175, 175, 66, 156, 154, 157, 163, 159, 162, 158, 161, 176, 176, 173, 166, 167,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 57, 175, 175, 175, 175, 59,
-    175, 176, 172, 138, 136, 139, 168, 169, 176, 176, 174, 164, 165, 0, 114, 107,
-    0, 106, 160, 103, 121, 55, 175, 60, 0, 175, 56, 175, 175, 175, 175, 175,
-    178, 175, 179, 179, 177, 128, 127, 117, 129, 61, 175, 175, 125, 170, 171, 97,
-    0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 222,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    113, 84, 175, 175, 175, 175, 137, 175, 175, 175, 175, 175, 152, 140, 175, 94,
-    95, 109, 0, 70, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175,
-    49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53,
-    175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175,
-    175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175,
-    175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35,
-    52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175,
-    175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175,
-    175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21,
-    175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175,
-    175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175,
-    175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175,
-    175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0, 176, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 176, 176, 135, 143, 141, 144, 142, 145, 148, 151, 147,
-    150, 175, 63, 175, 62, 146, 149, 58, 175, 175, 175, 175, 155, 153, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 67, 175, 65,
-    175, 175, 64, 175, 175, 175, 66, 156, 154, 157, 163, 159, 162, 158, 161, 176,
-    176, 173, 166, 167, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 57, 175,
-    175, 175, 175, 59, 175, 176, 172, 138, 136, 139, 168, 169, 176, 176, 174, 164,
-    165, 0, 114, 107, 0, 106, 160, 103, 121, 55, 175, 60, 0, 175, 56, 175,
-    175, 175, 175, 175, 178, 175, 179, 179, 177, 128, 127, 117, 129, 61, 175, 175,
-    125, 170, 171, 97, 0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 223, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 175, 175, 175, 175, 137, 175, 175, 175, 175, 175,
-    152, 140, 175, 94, 95, 109, 0, 70, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81,
-    175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0,
-    83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175,
-    29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75,
-    175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175,
-    175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175,
-    175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44,
-    175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14,
-    175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175,
-    34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175,
-    15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32,
-    175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0,
-    176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 176, 176, 135, 143, 141, 144, 142,
-    145, 148, 151, 147, 150, 175, 63, 175, 62, 146, 149, 58, 175, 175, 175, 175,
-    155, 153, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 67, 175, 65, 175, 175, 64, 175, 175, 175, 66, 156, 154, 157, 163, 159,
-    162, 158, 161, 176, 176, 173, 166, 167, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 57, 175, 175, 175, 175, 59, 175, 176, 172, 138, 136, 139, 168, 169,
-    176, 176, 174, 164, 165, 0, 114, 107, 0, 106, 160, 103, 121, 55, 175, 60,
-    0, 175, 56, 175, 175, 175, 175, 175, 178, 175, 179, 179, 177, 128, 127, 117,
-    129, 61, 175, 175, 125, 170, 171, 97, 0, 2, 0, 98, 126, 178, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 231, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 175, 175, 175, 175, 137, 175,
-    175, 175, 175, 175, 152, 140, 175, 94, 95, 109, 0, 70, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175,
-    175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38,
-    175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39,
-    175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175,
-    51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175,
-    175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175,
-    175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19,
-    175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175,
-    175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175,
-    24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33,
-    175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37,
-    26, 40, 0, 0, 176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 176, 176, 135,
-    143, 141, 144, 142, 145, 148, 151, 147, 150, 175, 63, 175, 62, 146, 149, 58,
-    175, 175, 175, 175, 155, 153, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 67, 175, 65, 175, 175, 64, 175, 175, 175, 66, 156,
-    154, 157, 163, 159, 162, 158, 161, 176, 176, 173, 166, 167, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 57, 175, 175, 175, 175, 59, 175, 176, 172, 138,
-    136, 139, 168, 169, 176, 176, 174, 164, 165, 0, 114, 107, 0, 106, 160, 103,
-    121, 55, 175, 60, 0, 175, 56, 175, 175, 175, 175, 175, 178, 175, 179, 179,
-    177, 128, 127, 117, 129, 61, 175, 175, 125, 170, 171, 97, 0, 2, 0, 98,
-    126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 232, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 175, 175,
-    175, 175, 137, 175, 175, 175, 175, 175, 152, 140, 175, 94, 95, 109, 0, 70,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9,
-    175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175,
-    175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22,
-    175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27,
-    175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25,
-    175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41,
-    175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175,
-    18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175,
-    175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175,
-    175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175,
-    175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175,
-    175, 175, 175, 37, 26, 40, 0, 0, 176, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 176, 176, 135, 143, 141, 144, 142, 145, 148, 151, 147, 150, 175, 63, 175,
-    62, 146, 149, 58, 175, 175, 175, 175, 155, 153, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 67, 175, 65, 175, 175, 64, 175,
-    175, 175, 66, 156, 154, 157, 163, 159, 162, 158, 161, 176, 176, 173, 166, 167,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 57, 175, 175, 175, 175, 59,
-    175, 176, 172, 138, 136, 139, 168, 169, 176, 176, 174, 164, 165, 0, 114, 107,
-    0, 106, 160, 103, 121, 55, 175, 60, 0, 175, 56, 175, 175, 175, 175, 175,
-    178, 175, 179, 179, 177, 128, 127, 117, 129, 61, 175, 175, 125, 170, 171, 97,
-    0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 233,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0,
-    0, 611, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    113, 84, 175, 175, 175, 175, 137, 175, 175, 175, 175, 175, 152, 140, 175, 94,
-    95, 109, 0, 70, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175,
-    49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 308, 83, 175, 175, 53,
-    175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175,
-    175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175,
-    175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35,
-    52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175,
-    175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175,
-    175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21,
-    175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175,
-    175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175,
-    175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175,
-    175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0, 176, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 176, 176, 135, 143, 141, 144, 142, 145, 148, 151, 147,
-    150, 175, 63, 175, 62, 146, 149, 58, 175, 175, 175, 175, 155, 153, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 67, 175, 65,
-    175, 175, 64, 175, 175, 175, 66, 156, 154, 157, 163, 159, 162, 158, 161, 176,
-    176, 173, 166, 167, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 57, 175,
-    175, 175, 175, 59, 175, 176, 172, 138, 136, 139, 168, 169, 176, 176, 174, 164,
-    165, 0, 114, 107, 0, 106, 160, 103, 121, 55, 175, 60, 0, 175, 56, 175,
-    175, 175, 175, 175, 178, 175, 179, 179, 177, 128, 127, 117, 129, 61, 175, 175,
-    125, 170, 171, 97, 0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 234, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 175, 175, 175, 175, 137, 175, 175, 175, 175, 175,
-    152, 140, 175, 94, 95, 109, 0, 70, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81,
-    175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0,
-    83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175,
-    29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75,
-    175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175,
-    175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175,
-    175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44,
-    175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14,
-    175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175,
-    34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175,
-    15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32,
-    175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0,
-    176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 176, 176, 135, 143, 141, 144, 142,
-    145, 148, 151, 147, 150, 175, 63, 175, 62, 146, 149, 58, 175, 175, 175, 175,
-    155, 153, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 67, 175, 65, 175, 175, 64, 175, 175, 175, 66, 156, 154, 157, 163, 159,
-    162, 158, 161, 176, 176, 173, 166, 167, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 57, 175, 175, 175, 175, 59, 175, 176, 172, 138, 136, 139, 168, 169,
-    176, 176, 174, 164, 165, 0, 114, 107, 0, 106, 160, 103, 121, 55, 175, 60,
-    0, 175, 56, 175, 175, 175, 175, 175, 178, 175, 179, 179, 177, 128, 127, 117,
-    129, 61, 175, 175, 125, 170, 171, 97, 0, 2, 0, 98, 126, 178, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 235, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 175, 175, 175, 175, 137, 175,
-    175, 175, 175, 175, 152, 140, 175, 94, 95, 109, 0, 70, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175,
-    175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38,
-    175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39,
-    175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175,
-    51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175,
-    175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175,
-    175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19,
-    175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175,
-    175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175,
-    24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33,
-    175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37,
-    26, 40, 0, 0, 176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 176, 176, 135,
-    143, 141, 144, 142, 145, 148, 151, 147, 150, 175, 63, 175, 62, 146, 149, 58,
-    175, 175, 175, 175, 155, 153, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 67, 175, 65, 175, 175, 64, 175, 175, 175, 66, 156,
-    154, 157, 163, 159, 162, 158, 161, 176, 176, 173, 166, 167, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 57, 175, 175, 175, 175, 59, 175, 176, 172, 138,
-    136, 139, 168, 169, 176, 176, 174, 164, 165, 0, 114, 107, 0, 106, 160, 103,
-    121, 55, 175, 60, 0, 175, 56, 175, 175, 175, 175, 175, 178, 175, 179, 179,
-    177, 128, 127, 117, 129, 61, 175, 175, 125, 170, 171, 97, 0, 2, 0, 98,
-    126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 236, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 175, 175,
-    175, 175, 137, 175, 175, 175, 175, 175, 152, 140, 175, 94, 95, 109, 0, 70,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9,
-    175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175,
-    175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22,
-    175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27,
-    175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25,
-    175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41,
-    175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175,
-    18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175,
-    175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175,
-    175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175,
-    175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175,
-    175, 175, 175, 37, 26, 40, 0, 0, 176, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 176, 176, 135, 143, 141, 144, 142, 145, 148, 151, 147, 150, 175, 63, 175,
-    62, 146, 149, 58, 175, 175, 175, 175, 155, 153, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 67, 175, 65, 175, 175, 64, 175,
-    175, 175, 66, 156, 154, 157, 163, 159, 162, 158, 161, 176, 176, 173, 166, 167,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 57, 175, 175, 175, 175, 59,
-    175, 176, 172, 138, 136, 139, 168, 169, 176, 176, 174, 164, 165, 0, 114, 107,
-    0, 106, 160, 103, 121, 55, 175, 60, 0, 175, 56, 175, 175, 175, 175, 175,
-    178, 175, 179, 179, 177, 128, 127, 117, 129, 61, 175, 175, 125, 170, 171, 97,
-    0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 237,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 228, 177, 68, 73, 111, 124,
-    113, 84, 175, 175, 175, 175, 137, 175, 175, 175, 175, 175, 152, 140, 175, 94,
-    95, 109, 0, 70, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175,
-    49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53,
-    175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175,
-    175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175,
-    175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35,
-    52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175,
-    175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175,
-    175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21,
-    175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175,
-    175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175,
-    175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175,
-    175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0, 176, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 176, 176, 135, 143, 141, 144, 142, 145, 148, 151, 147,
-    150, 175, 63, 175, 62, 146, 149, 58, 175, 175, 175, 175, 155, 153, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 67, 175, 65,
-    175, 175, 64, 175, 175, 175, 66, 156, 154, 157, 163, 159, 162, 158, 161, 176,
-    176, 173, 166, 167, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 57, 175,
-    175, 175, 175, 59, 175, 176, 172, 138, 136, 139, 168, 169, 176, 176, 174, 164,
-    165, 0, 114, 107, 0, 106, 160, 103, 121, 55, 175, 60, 0, 175, 56, 175,
-    175, 175, 175, 175, 178, 175, 179, 179, 177, 128, 127, 117, 129, 61, 175, 175,
-    125, 170, 171, 97, 0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 238, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 619, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 175, 175, 175, 175, 137, 175, 175, 175, 175, 175,
-    152, 140, 175, 94, 95, 109, 0, 70, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81,
-    175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0,
-    83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175,
-    29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75,
-    175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175,
-    175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175,
-    175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44,
-    175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14,
-    175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175,
-    34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175,
-    15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32,
-    175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0,
-    176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 176, 176, 135, 143, 141, 144, 142,
-    145, 148, 151, 147, 150, 175, 63, 175, 62, 146, 149, 58, 175, 175, 175, 175,
-    155, 153, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 67, 175, 65, 175, 175, 64, 175, 175, 175, 66, 156, 154, 157, 163, 159,
-    162, 158, 161, 176, 176, 173, 166, 167, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 57, 175, 175, 175, 175, 59, 175, 176, 172, 138, 136, 139, 168, 169,
-    176, 176, 174, 164, 165, 0, 114, 107, 0, 106, 160, 103, 121, 55, 175, 60,
-    0, 175, 56, 175, 175, 175, 175, 175, 178, 175, 179, 179, 177, 128, 127, 117,
-    129, 61, 175, 175, 125, 170, 171, 97, 0, 2, 0, 98, 126, 178, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 239, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 175, 175, 175, 175, 137, 175,
-    175, 175, 175, 175, 152, 140, 175, 94, 95, 109, 0, 70, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175,
-    175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38,
-    175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39,
-    175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175,
-    51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175,
-    175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175,
-    175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19,
-    175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175,
-    175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175,
-    24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33,
-    175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37,
-    26, 40, 0, 0, 176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 176, 176, 135,
-    143, 141, 144, 142, 145, 148, 151, 147, 150, 175, 63, 175, 62, 146, 149, 58,
-    175, 175, 175, 175, 155, 153, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 67, 175, 65, 175, 175, 64, 175, 175, 175, 66, 156,
-    154, 157, 163, 159, 162, 158, 161, 176, 176, 173, 166, 167, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 57, 175, 175, 175, 175, 59, 175, 176, 172, 138,
-    136, 139, 168, 169, 176, 176, 174, 164, 165, 0, 114, 107, 0, 106, 160, 103,
-    121, 55, 175, 60, 0, 175, 56, 175, 175, 175, 175, 175, 178, 175, 179, 179,
-    177, 128, 127, 117, 129, 61, 175, 175, 125, 170, 171, 97, 0, 2, 0, 98,
-    126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 240, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96,
-    134, 99, 101, 74, 623, 85, 100, 177, 68, 73, 588, 124, 585, 84, 175, 175,
-    175, 175, 137, 175, 175, 175, 175, 175, 152, 140, 175, 94, 95, 109, 0, 70,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9,
-    175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175,
-    175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22,
-    175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27,
-    175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25,
-    175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41,
-    175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175,
-    18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175,
-    175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175,
-    175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175,
-    175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175,
-    175, 175, 175, 37, 26, 40, 0, 0, 176, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 176, 176, 135, 143, 141, 144, 142, 145, 148, 151, 147, 150, 175, 63, 175,
-    62, 146, 149, 58, 175, 175, 175, 175, 155, 153, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 67, 175, 65, 175, 175, 64, 175,
-    175, 175, 66, 156, 154, 157, 163, 159, 162, 158, 161, 176, 176, 173, 166, 167,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 57, 175, 175, 175, 175, 59,
-    175, 176, 172, 138, 136, 139, 168, 169, 176, 176, 174, 164, 165, 0, 114, 107,
-    0, 106, 160, 103, 121, 55, 175, 60, 0, 175, 56, 175, 175, 175, 175, 175,
-    178, 175, 179, 179, 177, 128, 127, 117, 129, 61, 175, 175, 125, 170, 171, 97,
-    0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 241,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 596, 68, 73, 111, 124,
-    113, 84, 175, 175, 175, 175, 137, 175, 175, 175, 175, 175, 152, 140, 175, 94,
-    95, 109, 0, 70, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175,
-    49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53,
-    175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175,
-    175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175,
-    175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35,
-    52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175,
-    175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175,
-    175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21,
-    175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175,
-    175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175,
-    175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175,
-    175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0, 176, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 176, 176, 135, 143, 141, 144, 142, 145, 148, 151, 147,
-    150, 175, 63, 175, 62, 146, 149, 58, 175, 175, 175, 175, 155, 153, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 67, 175, 65,
-    175, 175, 64, 175, 175, 175, 66, 156, 154, 157, 163, 159, 162, 158, 161, 176,
-    176, 173, 166, 167, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 57, 175,
-    175, 175, 175, 59, 175, 176, 172, 138, 136, 139, 168, 169, 176, 176, 174, 164,
-    165, 0, 114, 107, 0, 106, 160, 103, 121, 55, 175, 60, 0, 175, 56, 175,
-    175, 175, 175, 175, 622, 175, 620, 179, 177, 128, 127, 117, 129, 61, 175, 175,
-    125, 170, 171, 97, 0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 242, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 224, 177,
-    68, 73, 111, 124, 113, 84, 175, 175, 175, 175, 137, 175, 175, 175, 175, 175,
-    152, 140, 175, 94, 95, 109, 0, 70, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81,
-    175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0,
-    83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175,
-    29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75,
-    175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175,
-    175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175,
-    175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44,
-    175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14,
-    175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175,
-    34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175,
-    15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32,
-    175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0,
-    176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 176, 176, 135, 143, 141, 144, 142,
-    145, 148, 151, 147, 150, 175, 63, 175, 62, 146, 149, 58, 175, 175, 175, 175,
-    155, 153, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 67, 175, 65, 175, 175, 64, 175, 175, 175, 66, 156, 154, 157, 163, 159,
-    162, 158, 161, 176, 176, 173, 166, 167, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 57, 175, 175, 175, 175, 59, 175, 176, 172, 138, 136, 139, 168, 169,
-    176, 176, 174, 164, 165, 0, 114, 107, 0, 106, 160, 103, 121, 55, 175, 60,
-    0, 175, 56, 175, 175, 175, 175, 175, 178, 175, 179, 179, 177, 128, 127, 117,
-    129, 61, 175, 175, 125, 170, 171, 97, 0, 2, 0, 98, 126, 178, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 243, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 604, 606, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 243, 68, 73, 111, 124, 113, 84, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 94, 95, 109, 0, 70, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    92, 110, 93, 81, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 0, 83, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 468, 468, 468, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 468, 468, 253,
-    468, 253, 253, 253, 468, 468, 468, 253, 253, 0, 114, 107, 0, 106, 253, 103,
-    121, 253, 253, 253, 608, 253, 253, 253, 253, 253, 253, 253, 604, 253, 606, 607,
-    608, 128, 127, 117, 129, 253, 253, 253, 125, 253, 253, 97, 607, 2, 625, 98,
-    126, 625, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 243, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 604, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 243, 68, 73, 111, 124, 113, 84, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 94, 95, 109, 0, 70,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 92, 110, 93, 81, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 0, 83, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 468, 468, 468, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 468, 468, 468, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 468, 468, 253, 468, 253, 253, 253, 468, 468, 468, 253, 253, 0, 114, 107,
-    0, 106, 253, 103, 121, 253, 253, 253, 608, 253, 253, 253, 253, 253, 253, 253,
-    604, 253, 179, 179, 608, 128, 127, 117, 129, 253, 253, 253, 125, 253, 253, 97,
-    0, 2, 625, 98, 126, 625, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 244,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    113, 84, 175, 175, 175, 175, 137, 175, 175, 175, 175, 175, 152, 140, 175, 94,
-    95, 109, 0, 70, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175,
-    49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53,
-    175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175,
-    175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175,
-    175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35,
-    52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175,
-    175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175,
-    175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21,
-    175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175,
-    175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175,
-    175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175,
-    175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0, 176, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 176, 176, 135, 143, 141, 144, 142, 145, 148, 151, 147,
-    150, 175, 63, 175, 62, 146, 149, 58, 175, 175, 175, 175, 155, 153, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 67, 175, 65,
-    175, 175, 64, 175, 175, 175, 66, 156, 154, 157, 163, 159, 162, 158, 161, 176,
-    176, 173, 166, 167, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 57, 175,
-    175, 175, 175, 59, 175, 176, 172, 138, 136, 139, 168, 169, 176, 176, 174, 164,
-    165, 0, 114, 107, 0, 106, 160, 103, 121, 55, 175, 60, 0, 175, 56, 175,
-    175, 175, 175, 175, 178, 175, 179, 179, 177, 128, 127, 117, 129, 61, 175, 175,
-    125, 170, 171, 97, 0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 245, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 175, 175, 175, 175, 137, 175, 175, 175, 175, 175,
-    152, 140, 175, 94, 95, 109, 0, 70, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81,
-    175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0,
-    83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175,
-    29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75,
-    175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175,
-    175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175,
-    175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44,
-    175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14,
-    175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175,
-    34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175,
-    15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32,
-    175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0,
-    176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 176, 176, 135, 143, 141, 144, 142,
-    145, 148, 151, 147, 150, 175, 63, 175, 62, 146, 149, 58, 175, 175, 175, 175,
-    155, 153, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 67, 175, 65, 175, 175, 64, 175, 175, 175, 66, 156, 154, 157, 163, 159,
-    162, 158, 161, 176, 176, 173, 166, 167, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 57, 175, 175, 175, 175, 59, 175, 176, 172, 138, 136, 139, 168, 169,
-    176, 176, 174, 164, 165, 0, 114, 107, 0, 106, 160, 103, 121, 55, 175, 60,
-    0, 175, 56, 175, 175, 175, 175, 175, 178, 175, 179, 179, 177, 128, 127, 117,
-    129, 61, 175, 175, 125, 170, 171, 97, 0, 2, 0, 98, 126, 178, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 246, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 589, 124, 113, 84, 175, 175, 175, 175, 137, 175,
-    175, 175, 175, 175, 152, 140, 175, 94, 95, 109, 0, 70, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175,
-    175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38,
-    175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39,
-    175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175,
-    51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175,
-    175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175,
-    175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19,
-    175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175,
-    175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175,
-    24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33,
-    175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37,
-    26, 40, 0, 0, 176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 592, 132, 115, 133, 122, 176, 176, 135,
-    143, 141, 144, 142, 145, 148, 151, 147, 150, 175, 63, 175, 62, 146, 149, 58,
-    175, 175, 175, 175, 155, 153, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 67, 175, 65, 175, 175, 64, 175, 175, 175, 66, 156,
-    154, 157, 163, 159, 162, 158, 161, 176, 176, 173, 166, 167, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 57, 175, 175, 175, 175, 59, 175, 176, 172, 138,
-    136, 139, 168, 169, 176, 176, 174, 164, 165, 0, 114, 107, 591, 106, 160, 103,
-    121, 55, 175, 60, 0, 175, 56, 175, 175, 175, 175, 175, 178, 175, 179, 179,
-    177, 128, 127, 117, 129, 61, 175, 175, 125, 170, 171, 97, 0, 2, 0, 98,
-    126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 247, 1, 4, 4, 5,
-    627, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0, 0, 612, 72, 96,
-    134, 610, 616, 74, 624, 85, 609, 177, 68, 73, 488, 490, 586, 84, 175, 175,
-    175, 175, 137, 175, 175, 175, 175, 175, 152, 140, 175, 94, 95, 486, 0, 70,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 92, 214, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9,
-    175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175,
-    175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22,
-    175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27,
-    175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25,
-    175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41,
-    175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175,
-    18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175,
-    175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175,
-    175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175,
-    175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175,
-    175, 175, 175, 37, 26, 40, 0, 0, 176, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 176, 176, 135, 143, 141, 144, 142, 145, 148, 151, 147, 150, 175, 63, 175,
-    62, 146, 149, 58, 175, 175, 175, 175, 155, 153, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 67, 175, 65, 175, 175, 64, 175,
-    175, 175, 66, 156, 154, 157, 163, 159, 162, 158, 161, 176, 176, 173, 166, 167,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 57, 175, 175, 175, 175, 59,
-    175, 176, 172, 138, 136, 139, 168, 169, 176, 176, 174, 164, 165, 0, 114, 491,
-    0, 489, 160, 103, 121, 55, 175, 60, 0, 175, 56, 175, 175, 175, 175, 175,
-    178, 175, 179, 179, 177, 128, 127, 117, 129, 61, 175, 175, 125, 170, 171, 97,
-    0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 248,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    587, 84, 175, 175, 175, 175, 137, 175, 175, 175, 175, 175, 152, 140, 175, 94,
-    95, 109, 0, 70, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175,
-    49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53,
-    175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175,
-    175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175,
-    175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35,
-    52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175,
-    175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175,
-    175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21,
-    175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175,
-    175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175,
-    175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175,
-    175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0, 176, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 176, 176, 135, 143, 141, 144, 142, 145, 148, 151, 147,
-    150, 175, 63, 175, 62, 146, 149, 58, 175, 175, 175, 175, 155, 153, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 67, 175, 65,
-    175, 175, 64, 175, 175, 175, 66, 156, 154, 157, 163, 159, 162, 158, 161, 176,
-    176, 173, 166, 167, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 57, 175,
-    175, 175, 175, 59, 175, 176, 172, 138, 136, 139, 168, 169, 176, 176, 174, 164,
-    165, 487, 492, 107, 0, 106, 160, 103, 121, 55, 175, 60, 0, 175, 56, 175,
-    175, 175, 175, 175, 178, 175, 179, 179, 177, 128, 127, 117, 129, 61, 175, 175,
-    125, 170, 171, 97, 0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 249, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 175, 175, 175, 175, 137, 175, 175, 175, 175, 175,
-    152, 140, 175, 94, 95, 109, 0, 70, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81,
-    175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0,
-    83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175,
-    29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75,
-    175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175,
-    175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175,
-    175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44,
-    175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14,
-    175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175,
-    34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175,
-    15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32,
-    175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0,
-    176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 176, 176, 135, 143, 141, 144, 142,
-    145, 148, 151, 147, 150, 175, 63, 175, 62, 146, 149, 58, 175, 175, 175, 175,
-    155, 153, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 67, 175, 65, 175, 175, 64, 175, 175, 175, 66, 156, 154, 157, 163, 159,
-    162, 158, 161, 176, 176, 173, 166, 167, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 57, 175, 175, 175, 175, 59, 175, 176, 172, 138, 136, 139, 168, 169,
-    176, 176, 174, 164, 165, 0, 114, 107, 0, 106, 160, 103, 121, 55, 175, 60,
-    0, 175, 56, 175, 175, 175, 175, 175, 178, 175, 179, 179, 177, 128, 127, 117,
-    129, 61, 175, 175, 125, 170, 171, 97, 0, 2, 0, 98, 126, 178, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 250, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 604, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 583, 253, 253, 253, 253, 253,
-    253, 599, 253, 253, 253, 253, 253, 94, 95, 109, 253, 70, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175,
-    175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38,
-    175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39,
-    175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175,
-    51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175,
-    175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175,
-    175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19,
-    175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175,
-    175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175,
-    24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33,
-    175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37,
-    26, 40, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 508, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 534, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 468, 468, 468, 253, 253, 253, 253, 513, 512,
-    253, 253, 563, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 468, 468, 253,
-    468, 253, 253, 253, 468, 468, 468, 584, 253, 0, 114, 107, 0, 106, 253, 103,
-    121, 253, 595, 253, 0, 253, 253, 253, 614, 253, 506, 253, 604, 556, 179, 179,
-    177, 128, 127, 117, 129, 253, 253, 601, 125, 253, 253, 97, 0, 2, 625, 98,
-    126, 625, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 251, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 604, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 94, 95, 109, 253, 70,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9,
-    175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175,
-    175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22,
-    175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27,
-    175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25,
-    175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41,
-    175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175,
-    18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175,
-    175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175,
-    175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175,
-    175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175,
-    175, 175, 175, 37, 26, 40, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 468, 468, 468, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 468, 468, 468, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 468, 468, 253, 468, 253, 253, 253, 468, 468, 468, 253, 253, 0, 114, 107,
-    0, 106, 253, 103, 121, 253, 253, 253, 0, 253, 253, 253, 253, 253, 253, 253,
-    604, 253, 179, 179, 177, 128, 127, 117, 129, 253, 253, 253, 125, 253, 253, 97,
-    0, 2, 625, 98, 126, 625, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 252,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 604,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    113, 84, 253, 253, 578, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 94,
-    95, 109, 253, 70, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175,
-    49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53,
-    175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175,
-    175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175,
-    175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35,
-    52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175,
-    175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175,
-    175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21,
-    175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175,
-    175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175,
-    175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175,
-    175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0, 468, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 468, 468, 468, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 538, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 468,
-    468, 468, 253, 253, 253, 253, 253, 253, 561, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 468, 468, 253, 468, 253, 579, 253, 468, 468, 468, 253,
-    253, 0, 114, 107, 0, 106, 253, 103, 121, 253, 253, 253, 0, 253, 253, 253,
-    253, 253, 253, 253, 604, 557, 179, 179, 177, 128, 127, 117, 129, 253, 253, 253,
-    125, 253, 253, 97, 0, 2, 625, 98, 126, 625, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 253, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 604, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 94, 95, 109, 253, 70, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81,
-    175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0,
-    83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175,
-    29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75,
-    175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175,
-    175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175,
-    175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44,
-    175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14,
-    175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175,
-    34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175,
-    15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32,
-    175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0,
-    468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 570,
-    253, 253, 253, 253, 253, 253, 253, 524, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 541, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 468, 468, 468, 253, 253, 515, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 468, 468, 253, 468, 253, 253, 253,
-    468, 468, 468, 253, 253, 0, 114, 107, 0, 106, 253, 103, 121, 253, 253, 253,
-    0, 253, 253, 253, 615, 253, 253, 505, 604, 558, 179, 179, 177, 128, 127, 117,
-    129, 253, 603, 253, 125, 253, 253, 97, 0, 2, 625, 98, 126, 625, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 253, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 604, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 94, 95, 109, 253, 70, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175,
-    175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38,
-    175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39,
-    175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175,
-    51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175,
-    175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175,
-    175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19,
-    175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175,
-    175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175,
-    24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33,
-    175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37,
-    26, 40, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 521, 253, 253, 253, 539, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 468, 468, 468, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 468, 468, 253,
-    468, 253, 253, 253, 468, 468, 468, 253, 253, 0, 114, 107, 0, 106, 253, 103,
-    121, 253, 253, 253, 0, 253, 253, 253, 253, 253, 253, 253, 604, 253, 179, 179,
-    177, 128, 127, 117, 129, 253, 253, 253, 125, 253, 253, 97, 0, 2, 625, 98,
-    126, 625, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 254, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 604, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 253, 253,
-    253, 253, 575, 253, 253, 253, 253, 253, 516, 496, 253, 94, 95, 109, 253, 70,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9,
-    175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175,
-    175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22,
-    175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27,
-    175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25,
-    175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41,
-    175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175,
-    18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175,
-    175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175,
-    175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175,
-    175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175,
-    175, 175, 175, 37, 26, 40, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 468, 468, 468, 509, 498, 503, 500, 501, 502, 253, 504, 253, 253, 253, 253,
-    253, 510, 253, 253, 253, 253, 253, 253, 549, 543, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 547, 545, 590, 253, 548, 253, 550, 253, 468, 468, 468, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 468, 468, 577, 468, 253, 253, 253, 468, 468, 468, 253, 253, 0, 114, 107,
-    0, 106, 546, 103, 121, 253, 253, 253, 0, 253, 253, 253, 253, 253, 253, 253,
-    604, 253, 179, 179, 177, 128, 127, 117, 129, 253, 253, 253, 125, 253, 253, 97,
-    0, 2, 625, 98, 126, 625, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 253,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    113, 84, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 94,
-    95, 109, 253, 70, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175,
-    49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53,
-    175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175,
-    175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175,
-    175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35,
-    52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175,
-    175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175,
-    175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21,
-    175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175,
-    175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175,
-    175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175,
-    175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0, 468, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 468, 468, 468, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 468,
-    468, 468, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 468, 468, 253, 468, 253, 253, 253, 468, 468, 468, 253,
-    253, 0, 114, 107, 0, 106, 253, 103, 121, 253, 253, 253, 0, 253, 253, 253,
-    253, 253, 253, 253, 178, 253, 179, 179, 177, 128, 127, 117, 129, 253, 253, 253,
-    125, 253, 253, 97, 0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 255, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 94, 95, 109, 253, 70, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81,
-    175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0,
-    83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175,
-    29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75,
-    175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175,
-    175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175,
-    175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44,
-    175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14,
-    175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175,
-    34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175,
-    15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32,
-    175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0,
-    468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 468, 468, 468, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 468, 468, 253, 468, 253, 253, 253,
-    468, 468, 468, 253, 253, 0, 114, 107, 0, 106, 253, 103, 121, 253, 253, 253,
-    0, 253, 253, 253, 253, 253, 253, 253, 178, 253, 179, 179, 177, 128, 127, 117,
-    129, 253, 253, 253, 125, 253, 253, 97, 0, 2, 0, 98, 126, 178, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 253, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 94, 95, 109, 253, 70, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175,
-    175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38,
-    175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39,
-    175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175,
-    51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175,
-    175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175,
-    175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19,
-    175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175,
-    175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175,
-    24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33,
-    175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37,
-    26, 40, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    529, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 468, 468, 468, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 468, 468, 253,
-    468, 253, 253, 253, 468, 468, 468, 253, 253, 0, 114, 107, 0, 106, 253, 103,
-    121, 253, 253, 253, 0, 598, 253, 253, 253, 253, 253, 253, 178, 253, 179, 179,
-    177, 128, 127, 117, 129, 253, 253, 253, 125, 253, 253, 97, 0, 2, 0, 98,
-    126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 253, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 94, 95, 109, 253, 70,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9,
-    175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175,
-    175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22,
-    175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27,
-    175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25,
-    175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41,
-    175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175,
-    18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175,
-    175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175,
-    175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175,
-    175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175,
-    175, 175, 175, 37, 26, 40, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 468, 468, 468, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 535, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 468, 468, 468, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 569, 511, 253, 253,
-    593, 468, 468, 253, 468, 253, 253, 253, 468, 468, 468, 253, 253, 0, 114, 107,
-    0, 106, 253, 103, 121, 253, 253, 253, 0, 253, 253, 253, 253, 253, 253, 253,
-    178, 253, 179, 179, 177, 128, 127, 117, 129, 253, 253, 253, 125, 253, 253, 97,
-    0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 256,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    113, 84, 253, 253, 253, 253, 253, 253, 617, 253, 253, 253, 253, 253, 253, 94,
-    95, 109, 253, 70, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175,
-    49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53,
-    175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175,
-    175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175,
-    175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35,
-    52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175,
-    175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175,
-    175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21,
-    175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175,
-    175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175,
-    175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175,
-    175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0, 468, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 468, 468, 468, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 522, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 468,
-    468, 468, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 468, 468, 253, 468, 253, 253, 253, 468, 468, 468, 253,
-    253, 0, 114, 107, 0, 106, 253, 103, 121, 253, 253, 253, 0, 253, 253, 600,
-    253, 253, 253, 253, 178, 559, 179, 179, 177, 128, 127, 117, 129, 253, 253, 602,
-    125, 618, 253, 97, 0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 253, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 94, 95, 109, 253, 70, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81,
-    175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0,
-    83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175,
-    29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75,
-    175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175,
-    175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175,
-    175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44,
-    175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14,
-    175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175,
-    34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175,
-    15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32,
-    175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0,
-    468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 525, 253, 253, 253, 528, 253, 530, 253, 253,
-    533, 253, 253, 253, 253, 253, 253, 540, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 468, 468, 468, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 468, 468, 253, 468, 253, 253, 253,
-    468, 468, 468, 253, 253, 0, 114, 107, 0, 106, 253, 103, 121, 253, 253, 253,
-    0, 253, 253, 253, 253, 253, 253, 253, 178, 253, 179, 179, 177, 128, 127, 117,
-    129, 253, 253, 253, 125, 253, 253, 97, 0, 2, 0, 98, 126, 178, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 257, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 94, 95, 109, 253, 70, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175,
-    175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38,
-    175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39,
-    175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175,
-    51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175,
-    175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175,
-    175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19,
-    175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175,
-    175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175,
-    24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33,
-    175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37,
-    26, 40, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 531, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 468, 468, 468, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 568, 253, 253, 253, 253, 253, 468, 468, 253,
-    468, 253, 253, 253, 468, 468, 468, 253, 253, 0, 114, 107, 0, 106, 253, 103,
-    121, 253, 253, 253, 0, 253, 253, 253, 253, 253, 253, 253, 178, 253, 179, 179,
-    177, 128, 127, 117, 129, 253, 253, 253, 125, 253, 253, 97, 0, 2, 0, 98,
-    126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 258, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 253, 253,
-    253, 253, 253, 253, 253, 253, 554, 253, 253, 253, 253, 94, 95, 109, 253, 70,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9,
-    175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175,
-    175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22,
-    175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27,
-    175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25,
-    175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41,
-    175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175,
-    18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175,
-    175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175,
-    175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175,
-    175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175,
-    175, 175, 175, 37, 26, 40, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 468, 468, 468, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 526,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 468, 468, 468, 555, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 468, 468, 253, 468, 253, 253, 253, 468, 468, 468, 253, 253, 0, 114, 107,
-    0, 106, 253, 103, 121, 253, 253, 253, 0, 253, 253, 253, 253, 253, 253, 253,
-    178, 253, 179, 179, 177, 128, 127, 117, 129, 253, 253, 253, 125, 253, 253, 97,
-    0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 259,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    113, 84, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 94,
-    95, 109, 253, 70, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175,
-    49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53,
-    175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175,
-    175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175,
-    175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35,
-    52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175,
-    175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175,
-    175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21,
-    175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175,
-    175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175,
-    175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175,
-    175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0, 468, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 468, 468, 468, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 613, 253, 253, 253, 253, 253, 253, 253, 253, 572, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 468,
-    468, 468, 253, 253, 253, 253, 253, 253, 253, 567, 253, 253, 253, 253, 253, 253,
-    253, 253, 571, 253, 253, 468, 468, 253, 468, 253, 253, 253, 468, 468, 468, 253,
-    253, 0, 114, 107, 0, 106, 253, 103, 121, 253, 253, 253, 0, 253, 253, 253,
-    253, 253, 253, 253, 178, 253, 179, 179, 177, 128, 127, 117, 129, 253, 253, 253,
-    125, 253, 253, 97, 0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 260, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    517, 253, 253, 94, 95, 109, 253, 70, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81,
-    175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0,
-    83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175,
-    29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75,
-    175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175,
-    175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175,
-    175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44,
-    175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14,
-    175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175,
-    34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175,
-    15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32,
-    175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0,
-    468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 597, 253, 253, 253,
-    253, 544, 519, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 537, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 468, 468, 468, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 566, 253, 253, 253, 253, 253, 253, 253, 468, 468, 253, 468, 253, 253, 253,
-    468, 468, 468, 253, 253, 0, 114, 107, 0, 106, 253, 103, 121, 253, 253, 253,
-    0, 253, 253, 253, 253, 253, 253, 253, 178, 560, 179, 179, 177, 128, 127, 117,
-    129, 253, 253, 253, 125, 253, 253, 97, 0, 2, 0, 98, 126, 178, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 253, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 94, 95, 109, 253, 70, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175,
-    175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38,
-    175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39,
-    175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175,
-    51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175,
-    175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175,
-    175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19,
-    175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175,
-    175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175,
-    24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33,
-    175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37,
-    26, 40, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 594, 253, 253, 253, 253, 253, 520, 253, 253, 253, 253, 253, 536, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 468, 468, 468, 253, 253, 253, 514, 253, 253,
-    562, 253, 253, 564, 253, 253, 253, 253, 253, 253, 253, 253, 253, 468, 468, 253,
-    468, 253, 253, 253, 468, 468, 468, 253, 253, 0, 114, 107, 0, 106, 253, 103,
-    121, 253, 253, 253, 0, 253, 253, 253, 253, 507, 253, 253, 178, 253, 179, 179,
-    177, 128, 127, 117, 129, 253, 253, 253, 125, 253, 253, 97, 0, 2, 0, 98,
-    126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 261, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 497, 253, 94, 95, 109, 253, 70,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9,
-    175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175,
-    175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22,
-    175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27,
-    175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25,
-    175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41,
-    175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175,
-    18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175,
-    175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175,
-    175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175,
-    175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175,
-    175, 175, 175, 37, 26, 40, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 468, 468, 468, 253, 499, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 527,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 468, 468, 468, 605, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 565, 253, 253, 253, 253, 253, 253, 253,
-    253, 468, 468, 253, 468, 253, 253, 253, 468, 468, 468, 253, 253, 0, 114, 107,
-    0, 106, 253, 103, 121, 253, 253, 253, 0, 253, 253, 253, 253, 253, 253, 253,
-    178, 253, 179, 179, 177, 128, 127, 117, 129, 253, 253, 253, 125, 253, 253, 97,
-    0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 262,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    113, 84, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 94,
-    95, 109, 253, 70, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175,
-    49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53,
-    175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175,
-    175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175,
-    175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35,
-    52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175,
-    175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175,
-    175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21,
-    175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175,
-    175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175,
-    175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175,
-    175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0, 468, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 468, 468, 468, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 468,
-    468, 468, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 468, 468, 253, 468, 253, 253, 253, 468, 468, 468, 253,
-    253, 0, 114, 107, 0, 106, 253, 103, 121, 253, 253, 253, 0, 253, 253, 253,
-    253, 253, 253, 253, 178, 253, 179, 179, 177, 128, 127, 117, 129, 253, 253, 253,
-    125, 253, 253, 97, 0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 253, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 94, 95, 109, 253, 70, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81,
-    175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0,
-    83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175,
-    29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75,
-    175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175,
-    175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175,
-    175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44,
-    175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14,
-    175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175,
-    34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175,
-    15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32,
-    175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0,
-    468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 532,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 468, 468, 468, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 468, 468, 253, 468, 253, 253, 253,
-    468, 468, 468, 253, 253, 0, 114, 107, 0, 106, 253, 103, 121, 253, 253, 253,
-    0, 253, 253, 253, 253, 253, 253, 253, 178, 253, 179, 179, 177, 128, 127, 117,
-    129, 253, 253, 253, 125, 253, 253, 97, 0, 2, 0, 98, 126, 178, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 253, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 518, 253, 253, 94, 95, 109, 253, 70, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175,
-    175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38,
-    175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39,
-    175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175,
-    51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175,
-    175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175,
-    175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19,
-    175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175,
-    175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175,
-    24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33,
-    175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37,
-    26, 40, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 542, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 468, 468, 468, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 468, 468, 253,
-    468, 253, 253, 253, 468, 468, 468, 253, 253, 0, 114, 107, 0, 106, 253, 103,
-    121, 253, 253, 253, 0, 253, 253, 253, 253, 253, 253, 253, 178, 253, 179, 179,
-    177, 128, 127, 117, 129, 253, 253, 253, 125, 253, 253, 97, 0, 2, 0, 98,
-    126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 263, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 175, 175,
-    175, 175, 137, 175, 175, 175, 175, 175, 152, 140, 175, 94, 95, 109, 0, 70,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9,
-    175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175,
-    175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22,
-    175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27,
-    175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25,
-    175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41,
-    175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175,
-    18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175,
-    175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175,
-    175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175,
-    175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175,
-    175, 175, 175, 37, 26, 40, 0, 0, 176, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 176, 176, 135, 143, 141, 144, 142, 145, 148, 151, 147, 150, 175, 63, 175,
-    62, 146, 149, 58, 175, 175, 175, 175, 155, 153, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 67, 175, 65, 175, 175, 64, 175,
-    175, 175, 66, 156, 154, 157, 163, 159, 162, 158, 161, 176, 176, 173, 166, 167,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 57, 175, 175, 175, 175, 59,
-    175, 176, 172, 138, 136, 139, 168, 169, 176, 176, 174, 164, 165, 0, 114, 107,
-    0, 106, 160, 103, 121, 55, 175, 60, 0, 175, 56, 175, 175, 175, 175, 175,
-    178, 175, 179, 179, 177, 128, 127, 117, 129, 61, 175, 175, 125, 170, 171, 97,
-    0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 264,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    113, 84, 175, 175, 175, 175, 137, 175, 175, 175, 175, 175, 152, 140, 175, 94,
-    95, 109, 0, 70, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175,
-    49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53,
-    175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175,
-    175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175,
-    175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35,
-    52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175,
-    175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175,
-    175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21,
-    175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175,
-    175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175,
-    175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175,
-    175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0, 176, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 176, 176, 135, 143, 141, 144, 142, 145, 148, 151, 147,
-    150, 175, 63, 175, 62, 146, 149, 58, 175, 175, 175, 175, 155, 153, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 67, 175, 65,
-    175, 175, 64, 175, 175, 175, 66, 156, 154, 157, 163, 159, 162, 158, 161, 176,
-    176, 173, 166, 167, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 57, 175,
-    175, 175, 175, 59, 175, 176, 172, 138, 136, 139, 168, 169, 176, 176, 174, 164,
-    165, 0, 114, 107, 0, 106, 160, 103, 121, 55, 175, 60, 0, 175, 56, 175,
-    175, 175, 175, 175, 178, 175, 179, 179, 177, 128, 127, 117, 129, 61, 175, 175,
-    125, 170, 171, 97, 0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 265, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 175, 175, 175, 175, 137, 175, 175, 175, 175, 175,
-    152, 140, 175, 94, 95, 109, 0, 70, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81,
-    175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0,
-    83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175,
-    29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75,
-    175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175,
-    175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175,
-    175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44,
-    175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14,
-    175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175,
-    34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175,
-    15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32,
-    175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0,
-    176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 176, 176, 135, 143, 141, 144, 142,
-    145, 148, 151, 147, 150, 175, 63, 175, 62, 146, 149, 58, 175, 175, 175, 175,
-    155, 153, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 67, 175, 65, 175, 175, 64, 175, 175, 175, 66, 156, 154, 157, 163, 159,
-    162, 158, 161, 176, 176, 173, 166, 167, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 57, 175, 175, 175, 175, 59, 175, 176, 172, 138, 136, 139, 168, 169,
-    176, 176, 174, 164, 165, 0, 114, 107, 0, 106, 160, 103, 121, 55, 175, 60,
-    0, 175, 56, 175, 175, 175, 175, 175, 178, 175, 179, 179, 177, 128, 127, 117,
-    129, 61, 175, 175, 125, 170, 171, 97, 0, 2, 0, 98, 126, 178, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 266, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 94, 95, 109, 467, 70, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    92, 110, 93, 81, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 0, 83, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 366, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 0, 0, 468, 0, 0, 0, 0, 474, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 523, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 468, 468, 468, 253, 253, 253, 253, 253, 253,
-    253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 253, 468, 468, 253,
-    468, 253, 253, 253, 468, 468, 468, 253, 253, 0, 114, 107, 0, 106, 253, 103,
-    121, 253, 253, 253, 0, 253, 253, 253, 253, 253, 253, 253, 178, 253, 179, 179,
-    177, 128, 127, 117, 129, 253, 253, 253, 125, 253, 253, 97, 0, 2, 0, 98,
-    126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 267, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 175, 175,
-    175, 175, 137, 175, 175, 175, 175, 175, 152, 140, 175, 94, 95, 109, 0, 70,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9,
-    175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175,
-    175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22,
-    175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27,
-    175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25,
-    175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41,
-    175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175,
-    18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175,
-    175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175,
-    175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175,
-    175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175,
-    175, 175, 175, 37, 26, 40, 0, 0, 176, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 176, 176, 135, 143, 141, 144, 142, 145, 148, 151, 147, 150, 175, 63, 175,
-    62, 146, 149, 58, 175, 175, 175, 175, 155, 153, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 67, 175, 65, 175, 175, 64, 175,
-    175, 175, 66, 156, 154, 157, 163, 159, 162, 158, 161, 176, 176, 173, 166, 167,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 57, 175, 175, 175, 175, 59,
-    175, 176, 172, 138, 136, 139, 168, 169, 176, 176, 174, 164, 165, 0, 114, 107,
-    0, 106, 160, 103, 121, 55, 175, 60, 0, 175, 56, 175, 175, 175, 175, 175,
-    178, 175, 179, 179, 177, 128, 127, 117, 129, 61, 175, 175, 125, 170, 171, 97,
-    0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 268,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 604,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    113, 84, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 94,
-    95, 109, 275, 70, 275, 275, 433, 423, 275, 400, 275, 275, 275, 388, 374, 275,
-    275, 275, 275, 275, 275, 275, 300, 275, 92, 110, 93, 81, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 304, 275, 275, 275, 0, 83, 275, 275, 275,
-    275, 326, 320, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 341, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 384, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 427, 275, 275, 275, 275, 432, 275, 275, 443, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 450, 275, 275, 275, 275, 275, 456,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 469, 0, 468, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 483, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 552,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 0, 114, 107, 0, 106, 468, 103, 121, 468, 468, 468, 0, 468, 468, 468,
-    468, 468, 468, 468, 604, 468, 179, 179, 177, 128, 127, 117, 129, 468, 468, 468,
-    125, 468, 468, 97, 0, 2, 625, 98, 126, 625, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 269, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 604, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 94, 95, 109, 275, 70, 458, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 92, 110, 93, 81,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0,
-    83, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 385, 275, 275, 275,
-    391, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 0,
-    468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 0, 114, 107, 0, 106, 468, 103, 121, 468, 468, 468,
-    0, 468, 468, 468, 468, 468, 468, 468, 604, 468, 179, 179, 177, 128, 127, 117,
-    129, 468, 468, 468, 125, 468, 468, 97, 0, 2, 625, 98, 126, 625, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 270, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 604, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 94, 95, 109, 275, 70, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    92, 110, 93, 81, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 0, 83, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 323, 275, 275, 275, 275, 275, 275, 330, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 367, 275,
-    275, 275, 275, 275, 275, 275, 380, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 409, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 0, 114, 107, 0, 106, 468, 103,
-    121, 468, 468, 468, 0, 468, 468, 468, 468, 468, 468, 468, 604, 468, 179, 179,
-    177, 128, 127, 117, 129, 468, 468, 468, 125, 468, 468, 97, 0, 2, 625, 98,
-    126, 625, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 271, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 604, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 94, 95, 109, 275, 70,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 92, 110, 93, 81, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 0, 83, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 346, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 377, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    461, 275, 275, 275, 275, 275, 0, 0, 468, 0, 0, 0, 0, 0, 475, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 468, 495, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 0, 114, 107,
-    0, 106, 468, 103, 121, 468, 468, 468, 0, 468, 468, 468, 468, 468, 468, 468,
-    604, 468, 179, 179, 177, 128, 127, 117, 129, 468, 468, 468, 125, 468, 468, 97,
-    0, 2, 625, 98, 126, 625, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 272,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 604,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    113, 84, 468, 468, 468, 468, 468, 468, 468, 468, 468, 551, 468, 468, 468, 94,
-    95, 109, 275, 70, 275, 275, 275, 424, 275, 401, 275, 275, 275, 389, 275, 275,
-    275, 275, 340, 275, 275, 275, 275, 275, 92, 110, 93, 81, 275, 275, 275, 296,
-    275, 275, 299, 275, 275, 275, 275, 275, 275, 275, 275, 0, 83, 275, 311, 275,
-    275, 275, 275, 275, 275, 318, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 335, 275, 337, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 353, 275, 275, 275, 275, 355, 275, 275, 358, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 372, 275, 275, 275, 275,
-    275, 378, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 392,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 407, 275,
-    275, 410, 275, 275, 413, 275, 275, 275, 275, 275, 275, 275, 275, 422, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 442, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 453, 275, 455, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 0, 468, 0, 0, 472,
-    0, 0, 0, 481, 477, 0, 479, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 0, 114, 107, 0, 106, 468, 103, 121, 468, 468, 468, 0, 468, 468, 468,
-    468, 468, 468, 468, 604, 468, 179, 179, 177, 128, 127, 117, 129, 468, 468, 468,
-    125, 468, 468, 97, 0, 2, 625, 98, 126, 625, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 273, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 604, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 94, 95, 109, 275, 70, 275, 275, 275, 275, 275, 275, 275, 275,
-    394, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 92, 110, 93, 81,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0,
-    83, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 339, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 383, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 426, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 0,
-    468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 0, 114, 107, 0, 106, 468, 103, 121, 468, 468, 468,
-    0, 468, 468, 468, 468, 468, 468, 468, 604, 468, 179, 179, 177, 128, 127, 117,
-    129, 468, 468, 468, 125, 468, 468, 97, 0, 2, 625, 98, 126, 625, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 274, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 94, 95, 109, 275, 70, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    92, 110, 93, 81, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 0, 83, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 0, 114, 107, 0, 106, 468, 103,
-    121, 468, 468, 468, 0, 468, 468, 468, 468, 468, 468, 468, 178, 468, 179, 179,
-    177, 128, 127, 117, 129, 468, 468, 468, 125, 468, 468, 97, 0, 2, 0, 98,
-    126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 275, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 94, 95, 109, 275, 70,
-    275, 275, 434, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 292, 92, 110, 93, 81, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 0, 83, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 324, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 352, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 0, 114, 107,
-    0, 106, 468, 103, 121, 468, 468, 468, 0, 468, 468, 468, 468, 468, 468, 468,
-    178, 468, 179, 179, 177, 128, 127, 117, 129, 468, 468, 468, 125, 468, 468, 97,
-    0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 276,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    113, 84, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 94,
-    95, 109, 275, 70, 275, 275, 275, 275, 275, 402, 275, 275, 275, 275, 375, 275,
-    275, 275, 275, 312, 275, 275, 275, 275, 92, 110, 93, 81, 297, 294, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 83, 275, 275, 275,
-    275, 275, 321, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 363, 275, 365, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 439, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 462, 275, 275, 275, 275, 0, 0, 468, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 484, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 494, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 0, 114, 107, 0, 106, 468, 103, 121, 468, 468, 468, 0, 468, 468, 468,
-    468, 468, 468, 468, 178, 468, 179, 179, 177, 128, 127, 117, 129, 468, 468, 468,
-    125, 468, 468, 97, 0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 275, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 94, 95, 109, 275, 70, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 92, 110, 93, 81,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0,
-    83, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 0,
-    468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 0, 114, 107, 0, 106, 468, 103, 121, 468, 468, 468,
-    0, 468, 468, 468, 468, 468, 468, 468, 178, 468, 179, 179, 177, 128, 127, 117,
-    129, 468, 468, 468, 125, 468, 468, 97, 0, 2, 0, 98, 126, 178, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 275, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 94, 95, 109, 275, 70, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    92, 110, 93, 81, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 0, 83, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 457, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 0, 114, 107, 0, 106, 468, 103,
-    121, 468, 468, 468, 0, 468, 468, 468, 468, 468, 468, 468, 178, 468, 179, 179,
-    177, 128, 127, 117, 129, 468, 468, 468, 125, 468, 468, 97, 0, 2, 0, 98,
-    126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 277, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 94, 95, 109, 275, 70,
-    275, 275, 275, 275, 414, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 92, 110, 93, 81, 275, 275, 275, 275, 275, 298, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 0, 83, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 393, 275, 275, 275,
-    275, 275, 275, 275, 411, 275, 406, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 417, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    429, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 485, 45, 131, 104, 112, 132, 115, 133,
-    122, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 553, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 582, 468, 468, 468, 0, 114, 107,
-    0, 106, 468, 103, 121, 468, 468, 468, 0, 468, 468, 468, 468, 468, 468, 468,
-    178, 468, 179, 179, 177, 128, 127, 117, 129, 468, 468, 468, 125, 468, 468, 97,
-    0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 278,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    113, 84, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 94,
-    95, 109, 275, 70, 275, 275, 275, 275, 415, 275, 275, 275, 275, 275, 275, 364,
-    361, 275, 275, 275, 275, 275, 275, 275, 92, 110, 93, 81, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 83, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 319, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 447, 275, 449, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 464, 275, 275, 275, 275, 275, 275, 0, 466, 468, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 0, 114, 107, 0, 106, 468, 103, 121, 468, 468, 468, 0, 468, 468, 468,
-    468, 468, 468, 468, 178, 468, 179, 179, 177, 128, 127, 117, 129, 468, 468, 468,
-    125, 468, 468, 97, 0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 279, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 468, 468, 468, 468, 576, 573, 468, 468, 468, 468,
-    468, 468, 468, 94, 95, 109, 275, 70, 275, 275, 275, 275, 275, 403, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 303, 275, 275, 92, 110, 93, 81,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0,
-    83, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 345, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 362, 275, 275, 275, 275, 275, 275, 275, 370, 275, 275,
-    275, 275, 275, 379, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 390, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 408, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 437,
-    275, 275, 275, 440, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 0,
-    468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 0, 114, 107, 0, 106, 468, 103, 121, 468, 468, 468,
-    0, 468, 468, 468, 468, 468, 468, 468, 178, 468, 179, 179, 177, 128, 127, 117,
-    129, 468, 468, 468, 125, 468, 468, 97, 0, 2, 0, 98, 126, 178, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 280, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 468, 580, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 493, 94, 95, 109, 275, 70, 275, 275, 435, 425,
-    275, 404, 397, 275, 275, 275, 376, 275, 275, 348, 275, 275, 275, 275, 275, 275,
-    92, 110, 93, 81, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 0, 83, 275, 275, 275, 275, 327, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 338, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 368,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 387, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 399, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 418, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 446, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 463, 275,
-    275, 275, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 581, 468, 468, 468, 468, 0, 114, 107, 0, 106, 468, 103,
-    121, 468, 468, 468, 0, 468, 468, 468, 468, 468, 468, 468, 178, 468, 179, 179,
-    177, 128, 127, 117, 129, 468, 468, 468, 125, 468, 468, 97, 0, 2, 0, 98,
-    126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 281, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 94, 95, 109, 275, 70,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 92, 110, 93, 81, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 0, 83, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 325, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    360, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 381, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 416, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 451, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 0, 0, 468, 470, 471, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 0, 114, 107,
-    0, 106, 468, 103, 121, 468, 468, 468, 0, 468, 468, 468, 468, 468, 468, 468,
-    178, 468, 179, 179, 177, 128, 127, 117, 129, 468, 468, 468, 125, 468, 468, 97,
-    0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 275,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    113, 84, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 94,
-    95, 109, 275, 70, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 92, 110, 93, 81, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 83, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 396, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 0, 468, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 0, 114, 107, 0, 106, 468, 103, 121, 468, 468, 468, 0, 468, 468, 468,
-    468, 468, 468, 468, 178, 468, 179, 179, 177, 128, 127, 117, 129, 468, 468, 468,
-    125, 468, 468, 97, 0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 282, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 94, 95, 109, 275, 70, 275, 454, 275, 275, 275, 275, 275, 275,
-    395, 275, 275, 275, 275, 349, 275, 275, 309, 275, 275, 293, 92, 110, 93, 81,
-    275, 275, 275, 275, 275, 275, 275, 275, 301, 275, 275, 275, 305, 275, 275, 0,
-    83, 275, 275, 275, 275, 328, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 344, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 356,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    373, 275, 275, 275, 275, 275, 275, 275, 386, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    405, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 444, 275,
-    275, 275, 275, 275, 275, 275, 275, 448, 445, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 0,
-    468, 0, 0, 0, 473, 0, 476, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 0, 114, 107, 0, 106, 468, 103, 121, 468, 468, 468,
-    0, 468, 468, 468, 468, 468, 468, 468, 178, 468, 179, 179, 177, 128, 127, 117,
-    129, 468, 468, 468, 125, 468, 468, 97, 0, 2, 0, 98, 126, 178, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 283, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 94, 95, 109, 275, 70, 459, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    92, 110, 93, 81, 275, 275, 275, 275, 275, 275, 275, 275, 275, 302, 275, 275,
-    275, 275, 275, 0, 83, 275, 275, 275, 275, 275, 275, 316, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 333, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 351, 275,
-    275, 354, 275, 275, 275, 275, 359, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 412, 275, 275, 421, 275,
-    275, 275, 275, 420, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 452, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 465, 275, 275, 275, 275, 275,
-    275, 275, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0, 0, 478, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 0, 114, 107, 0, 106, 468, 103,
-    121, 468, 468, 468, 0, 468, 468, 468, 468, 468, 468, 468, 178, 468, 179, 179,
-    177, 128, 127, 117, 129, 468, 468, 468, 125, 468, 468, 97, 0, 2, 0, 98,
-    126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 284, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 94, 95, 109, 275, 70,
-    275, 275, 436, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 313,
-    275, 275, 275, 275, 92, 110, 93, 81, 275, 275, 295, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 0, 83, 275, 275, 275, 275, 275, 275, 275,
-    317, 275, 275, 275, 275, 322, 275, 275, 275, 275, 334, 275, 275, 275, 331, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 342, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 371, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 398, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 431, 275, 275, 275, 275,
-    275, 430, 275, 275, 275, 275, 275, 275, 275, 438, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 480, 46, 482, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 574, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 0, 114, 107,
-    0, 106, 468, 103, 121, 468, 468, 468, 0, 468, 468, 468, 468, 468, 468, 468,
-    178, 468, 179, 179, 177, 128, 127, 117, 129, 468, 468, 468, 125, 468, 468, 97,
-    0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 285,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    113, 84, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 94,
-    95, 109, 275, 70, 460, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 350, 275, 275, 275, 275, 275, 275, 92, 110, 93, 81, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 83, 310, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    329, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 343, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 369, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 428, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    441, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 0, 468, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 0, 114, 107, 0, 106, 468, 103, 121, 468, 468, 468, 0, 468, 468, 468,
-    468, 468, 468, 468, 178, 468, 179, 179, 177, 128, 127, 117, 129, 468, 468, 468,
-    125, 468, 468, 97, 0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 286, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 94, 95, 109, 275, 70, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 92, 110, 93, 81,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0,
-    83, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    357, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 0,
-    468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 0, 114, 107, 0, 106, 468, 103, 121, 468, 468, 468,
-    0, 468, 468, 468, 468, 468, 468, 468, 178, 468, 179, 179, 177, 128, 127, 117,
-    129, 468, 468, 468, 125, 468, 468, 97, 0, 2, 0, 98, 126, 178, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 287, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 94, 95, 109, 275, 70, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 314, 275, 275, 275, 275,
-    92, 110, 93, 81, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 0, 83, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 332, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 0, 114, 107, 0, 106, 468, 103,
-    121, 468, 468, 468, 0, 468, 468, 468, 468, 468, 468, 468, 178, 468, 179, 179,
-    177, 128, 127, 117, 129, 468, 468, 468, 125, 468, 468, 97, 0, 2, 0, 98,
-    126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 275, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 94, 95, 109, 275, 70,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 92, 110, 93, 81, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 0, 83, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 382, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 0, 114, 107,
-    0, 106, 468, 103, 121, 468, 468, 468, 0, 468, 468, 468, 468, 468, 468, 468,
-    178, 468, 179, 179, 177, 128, 127, 117, 129, 468, 468, 468, 125, 468, 468, 97,
-    0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 275,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    113, 84, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 94,
-    95, 109, 275, 70, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 315, 275, 275, 275, 275, 92, 110, 93, 81, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 306, 275, 0, 83, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 347, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 419, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 0, 468, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 0, 114, 107, 0, 106, 468, 103, 121, 468, 468, 468, 0, 468, 468, 468,
-    468, 468, 468, 468, 178, 468, 179, 179, 177, 128, 127, 117, 129, 468, 468, 468,
-    125, 468, 468, 97, 0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 275, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 94, 95, 109, 275, 70, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 92, 110, 93, 81,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0,
-    83, 275, 275, 275, 336, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
-    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 0,
-    468, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468, 468,
-    468, 468, 468, 468, 468, 0, 114, 107, 0, 106, 468, 103, 121, 468, 468, 468,
-    0, 468, 468, 468, 468, 468, 468, 468, 178, 468, 179, 179, 177, 128, 127, 117,
-    129, 468, 468, 468, 125, 468, 468, 97, 0, 2, 0, 98, 126, 178, 4, 116,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 130, 288, 1, 4, 4, 5, 82, 119, 71, 69,
-    224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74,
-    102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 175, 175, 175, 175, 137, 175,
-    175, 175, 175, 175, 152, 140, 175, 94, 95, 109, 0, 70, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    92, 110, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175,
-    175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38,
-    175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39,
-    175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175,
-    51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175,
-    175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175,
-    175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19,
-    175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175,
-    175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175,
-    24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33,
-    175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37,
-    26, 40, 0, 0, 176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133, 122, 176, 176, 135,
-    143, 141, 144, 142, 145, 148, 151, 147, 150, 175, 63, 175, 62, 146, 149, 58,
-    175, 175, 175, 175, 155, 153, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 67, 175, 65, 175, 175, 64, 175, 175, 175, 66, 156,
-    154, 157, 163, 159, 162, 158, 161, 176, 176, 173, 166, 167, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 57, 175, 175, 175, 175, 59, 175, 176, 172, 138,
-    136, 139, 168, 169, 176, 176, 174, 164, 165, 0, 114, 107, 0, 106, 160, 103,
-    121, 55, 175, 60, 0, 175, 56, 175, 175, 175, 175, 175, 178, 175, 179, 179,
-    177, 128, 127, 117, 129, 61, 175, 175, 125, 170, 171, 97, 0, 2, 0, 98,
-    126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 289, 1, 4, 4, 5,
-    82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0, 0, 108, 72, 96,
-    134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124, 113, 84, 175, 175,
-    175, 175, 137, 175, 175, 175, 175, 175, 152, 140, 175, 94, 95, 109, 0, 70,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 92, 221, 93, 81, 175, 175, 175, 175, 49, 175, 175, 9,
-    175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53, 175, 175, 175, 175,
-    175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175, 175, 175, 175, 22,
-    175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175, 175, 13, 48, 27,
-    175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35, 52, 175, 175, 25,
-    175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175, 175, 175, 16, 41,
-    175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175, 175, 20, 6, 175,
-    18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21, 175, 175, 28, 175,
-    175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175, 175, 10, 175, 175,
-    175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175, 175, 175, 12, 175,
-    175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175, 175, 11, 175, 175,
-    175, 175, 175, 37, 26, 40, 0, 0, 176, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104, 112, 132, 115, 133,
-    122, 176, 176, 135, 143, 141, 144, 142, 145, 148, 151, 147, 150, 175, 63, 175,
-    62, 146, 149, 58, 175, 175, 175, 175, 155, 153, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 67, 175, 65, 175, 175, 64, 175,
-    175, 175, 66, 156, 154, 157, 163, 159, 162, 158, 161, 176, 176, 173, 166, 167,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 57, 175, 175, 175, 175, 59,
-    175, 176, 172, 138, 136, 139, 168, 169, 176, 176, 174, 164, 165, 0, 114, 107,
-    0, 106, 160, 103, 121, 55, 175, 60, 0, 175, 56, 175, 175, 175, 175, 175,
-    178, 175, 179, 179, 177, 128, 127, 117, 129, 61, 175, 175, 125, 170, 171, 97,
-    0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 290,
-    1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3, 228, 3, 3, 0,
-    0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177, 68, 73, 111, 124,
-    113, 84, 175, 175, 175, 175, 137, 175, 175, 175, 175, 175, 152, 140, 175, 94,
-    95, 109, 0, 70, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81, 175, 175, 175, 175,
-    49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0, 83, 175, 175, 53,
-    175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175, 29, 43, 175, 175,
-    175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75, 175, 175, 175, 175,
-    175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175, 175, 175, 175, 35,
-    52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175, 175, 47, 175, 175,
-    175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44, 175, 175, 77, 175,
-    175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14, 175, 8, 175, 21,
-    175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175, 34, 175, 7, 175,
-    175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175, 15, 175, 175, 175,
-    175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32, 175, 30, 175, 175,
-    175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0, 176, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 45, 131, 104,
-    112, 132, 115, 133, 122, 176, 176, 135, 143, 141, 144, 142, 145, 148, 151, 147,
-    150, 175, 63, 175, 62, 146, 149, 58, 175, 175, 175, 175, 155, 153, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 67, 175, 65,
-    175, 175, 64, 175, 175, 175, 66, 156, 154, 157, 163, 159, 162, 158, 161, 176,
-    176, 173, 166, 167, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 57, 175,
-    175, 175, 175, 59, 175, 176, 172, 138, 136, 139, 168, 169, 176, 176, 174, 164,
-    165, 0, 114, 107, 0, 106, 160, 103, 121, 55, 175, 60, 0, 175, 56, 175,
-    175, 175, 175, 175, 178, 175, 179, 179, 177, 128, 127, 117, 129, 61, 175, 175,
-    125, 170, 171, 97, 0, 2, 0, 98, 126, 178, 4, 116, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 130, 291, 1, 4, 4, 5, 82, 119, 71, 69, 224, 2, 2, 3,
-    228, 3, 3, 0, 0, 108, 72, 96, 134, 99, 101, 74, 102, 85, 100, 177,
-    68, 73, 111, 124, 113, 84, 175, 175, 175, 175, 137, 175, 175, 175, 175, 175,
-    152, 140, 175, 94, 95, 109, 0, 70, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 92, 110, 93, 81,
-    175, 175, 175, 175, 49, 175, 175, 9, 175, 175, 23, 175, 175, 175, 175, 0,
-    83, 175, 175, 53, 175, 175, 175, 175, 175, 175, 175, 38, 175, 175, 175, 175,
-    29, 43, 175, 175, 175, 175, 175, 22, 175, 36, 175, 39, 175, 175, 175, 75,
-    175, 175, 175, 175, 175, 13, 48, 27, 175, 175, 175, 175, 51, 175, 175, 175,
-    175, 175, 175, 35, 52, 175, 175, 25, 175, 17, 175, 175, 175, 175, 175, 175,
-    175, 47, 175, 175, 175, 175, 16, 41, 175, 175, 42, 175, 175, 50, 175, 44,
-    175, 175, 77, 175, 175, 20, 6, 175, 18, 175, 175, 19, 175, 175, 175, 14,
-    175, 8, 175, 21, 175, 175, 28, 175, 175, 54, 175, 175, 175, 175, 175, 175,
-    34, 175, 7, 175, 175, 10, 175, 175, 175, 175, 31, 175, 24, 175, 175, 175,
-    15, 175, 175, 175, 175, 175, 12, 175, 175, 175, 175, 33, 175, 175, 175, 32,
-    175, 30, 175, 175, 175, 11, 175, 175, 175, 175, 175, 37, 26, 40, 0, 0,
-    176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
-    0, 45, 131, 104, 112, 132, 115, 133, 122, 176, 176, 135, 143, 141, 144, 142,
-    145, 148, 151, 147, 150, 175, 63, 175, 62, 146, 149, 58, 175, 175, 175, 175,
-    155, 153, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 67, 175, 65, 175, 175, 64, 175, 175, 175, 66, 156, 154, 157, 163, 159,
-    162, 158, 161, 176, 176, 173, 166, 167, 175, 175, 175, 175, 175, 175, 175, 175,
-    175, 175, 57, 175, 175, 175, 175, 59, 175, 176, 172, 138, 136, 139, 168, 169,
-    176, 176, 174, 164, 165, 0, 114, 107, 0, 106, 160, 103, 121, 55, 175, 60,
-    0, 175, 56, 175, 175, 175, 175, 175, 178, 175, 179, 179, 177, 128, 127, 117,
-    129, 61, 175, 175, 125, 170, 171, 97, 0, 2, 0, 98, 126, 178, 4, 116,
+extern lexer_row_t const lexer_row_table[631] = {
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,120,0,0}, {0,0,266,0}, {0,1,0,0}, {41,4,0,0}, {68,4,0,0}, {331,5,0,1}, {367,82,0,0}, {0,71,0,0},
+    {0,132,0,0}, {0,69,0,0}, {287,180,0,0}, {0,3,0,0}, {34,228,0,2}, {396,3,0,0}, {399,3,0,0}, {693,0,0,0},
+    {59,101,0,0}, {210,109,0,0}, {0,72,0,0}, {0,96,0,0}, {0,136,0,0}, {451,99,0,0}, {211,102,0,0}, {0,74,0,0},
+    {286,103,0,0}, {0,85,0,0}, {209,100,0,0}, {43,179,0,0}, {0,68,0,0}, {0,73,0,0}, {277,112,0,0}, {453,125,0,0},
+    {22,114,0,0}, {0,84,0,0}, {453,177,253,0}, {417,177,253,0}, {458,177,253,0}, {57,177,0,5}, {273,177,253,0}, {486,177,253,0},
+    {516,177,253,0}, {527,177,253,0}, {515,177,253,0}, {499,177,253,0}, {189,177,253,0}, {357,177,253,0}, {491,177,253,0}, {0,94,0,0},
+    {0,95,0,0}, {535,110,0,0}, {109,0,0,0}, {0,70,0,0}, {238,177,275,0}, {490,177,275,0}, {260,177,274,0}, {271,177,274,0},
+    {41,177,275,0}, {163,177,274,0}, {189,177,0,0}, {357,177,0,4}, {327,177,275,0}, {104,177,275,0}, {335,177,274,0}, {496,177,275,0},
+    {497,177,275,0}, {263,177,274,0}, {506,177,275,0}, {274,177,275,0}, {494,177,275,0}, {499,177,275,0}, {513,177,275,0}, {277,177,275,0},
+    {0,92,0,0}, {324,111,0,0}, {0,93,0,0}, {0,81,0,0}, {566,2,0,0}, {391,293,0,2}, {508,177,275,0}, {509,177,275,0},
+    {499,177,275,0}, {515,177,275,0}, {441,49,0,0}, {572,177,275,0}, {580,177,275,0}, {525,9,0,0}, {568,177,275,0}, {568,177,275,0},
+    {609,23,0,0}, {587,177,275,0}, {571,177,275,0}, {565,177,275,0}, {640,177,275,0}, {635,0,0,0}, {0,83,0,0}, {572,177,275,0},
+    {589,177,275,0}, {777,53,0,0}, {569,177,275,0}, {259,177,274,0}, {342,177,275,0}, {577,177,275,0}, {578,177,275,0}, {594,177,275,0},
+    {587,177,275,0}, {861,38,0,0}, {586,177,275,0}, {583,177,275,0}, {601,177,275,0}, {668,177,275,0}, {945,29,0,0}, {1029,43,0,0},
+    {657,177,275,0}, {655,177,275,0}, {659,177,275,0}, {678,177,275,0}, {668,177,275,0}, {1113,22,0,0}, {682,177,275,0}, {1197,36,0,0},
+    {698,177,275,0}, {1281,39,0,0}, {699,177,275,0}, {690,177,274,0}, {700,177,275,0}, {1365,75,0,0}, {278,177,275,0}, {703,177,275,0},
+    {693,177,275,0}, {697,177,275,0}, {702,177,275,0}, {1449,13,0,0}, {1533,48,0,0}, {1617,27,0,0}, {701,177,275,0}, {713,177,275,0},
+    {700,177,275,0}, {744,177,275,0}, {1701,51,0,0}, {734,177,275,0}, {749,177,275,0}, {737,177,275,0}, {734,177,275,0}, {753,177,275,0},
+    {740,177,275,0}, {1785,35,0,0}, {1869,52,0,0}, {746,177,275,0}, {752,177,275,0}, {1953,25,0,0}, {753,177,275,0}, {2121,17,0,0},
+    {760,177,275,0}, {749,177,274,0}, {744,177,275,0}, {752,177,275,0}, {747,177,275,0}, {763,177,275,0}, {751,177,275,0}, {2205,47,0,0},
+    {676,177,275,0}, {756,177,275,0}, {767,177,275,0}, {767,177,275,0}, {2289,16,0,0}, {2373,41,0,0}, {818,177,275,0}, {831,177,275,0},
+    {2457,42,0,0}, {837,177,275,0}, {837,177,275,0}, {2541,50,0,0}, {825,177,274,0}, {2625,44,0,0}, {840,177,275,0}, {829,177,275,0},
+    {2709,77,0,0}, {839,177,275,0}, {833,177,275,0}, {2793,20,0,0}, {2877,6,0,0}, {829,177,275,0}, {2961,18,0,0}, {827,177,275,0},
+    {833,177,274,0}, {3045,19,0,0}, {837,177,275,0}, {836,177,275,0}, {839,177,275,0}, {3129,14,0,0}, {834,177,275,0}, {3213,8,0,0},
+    {848,177,275,0}, {3297,21,0,0}, {851,177,275,0}, {850,177,275,0}, {3381,28,0,0}, {837,177,275,0}, {915,177,275,0}, {3465,54,0,0},
+    {902,177,275,0}, {906,177,275,0}, {911,177,275,0}, {909,177,274,0}, {901,177,275,0}, {908,177,275,0}, {3549,34,0,0}, {923,177,275,0},
+    {3633,7,0,0}, {909,177,275,0}, {924,177,275,0}, {3717,10,0,0}, {930,177,275,0}, {911,177,275,0}, {921,177,275,0}, {914,177,275,0},
+    {3801,31,0,0}, {934,177,275,0}, {3885,24,0,0}, {917,177,275,0}, {416,177,275,0}, {923,177,275,0}, {3969,15,0,0}, {918,177,275,0},
+    {930,177,275,0}, {926,177,275,0}, {983,177,275,0}, {1000,177,275,0}, {4053,12,0,0}, {988,177,275,0}, {989,177,275,0}, {993,177,274,0},
+    {997,177,275,0}, {4137,33,0,0}, {998,177,275,0}, {1011,177,275,0}, {997,177,275,0}, {4221,32,0,0}, {1009,177,275,0}, {4305,30,0,0},
+    {1010,177,275,0}, {1015,177,275,0}, {1006,177,275,0}, {4389,11,0,0}, {999,177,275,0}, {1006,177,275,0}, {1016,177,275,0}, {1012,177,275,0},
+    {1007,177,274,0}, {4473,37,0,0}, {4557,26,0,0}, {4641,40,0,0}, {1022,0,0,0}, {1011,0,0,0}, {1079,470,492,3}, {1073,0,0,0},
+    {1074,0,0,0}, {1086,0,0,0}, {1074,0,0,0}, {1095,0,0,0}, {412,0,0,0}, {1090,0,0,0}, {1091,0,0,0}, {1078,0,0,0},
+    {1093,0,0,0}, {1079,0,0,0}, {0,46,0,0}, {1080,0,0,0}, {1100,0,0,0}, {1093,0,0,0}, {1091,0,0,0}, {0,45,0,0},
+    {0,133,0,0}, {0,105,0,0}, {0,123,0,0}, {0,135,0,0}, {693,470,0,0}, {247,470,492,0}, {2373,470,0,0}, {777,177,253,0},
+    {441,177,253,0}, {861,177,253,0}, {945,177,253,0}, {1029,177,253,0}, {1113,177,253,0}, {2457,177,253,0}, {1197,177,253,0}, {2541,177,253,0},
+    {1115,177,253,0}, {2625,177,253,0}, {1130,177,253,0}, {2709,177,253,0}, {1281,177,253,0}, {2793,177,253,0}, {2877,177,253,0}, {1116,177,253,0},
+    {1116,177,253,0}, {1119,177,253,0}, {1194,177,253,0}, {1365,177,253,0}, {525,177,253,0}, {1183,177,253,0}, {1183,177,253,0}, {1196,177,253,0},
+    {1191,177,253,0}, {1179,177,253,0}, {188,177,253,0}, {1200,177,253,0}, {1189,177,253,0}, {1206,177,253,0}, {1196,177,253,0}, {1200,177,253,0},
+    {1198,177,253,0}, {1198,177,253,0}, {1192,177,253,0}, {1201,177,253,0}, {2961,177,253,0}, {1204,177,253,0}, {3045,177,253,0}, {1199,177,253,0},
+    {1213,177,253,0}, {3129,177,253,0}, {1205,177,253,0}, {1214,177,253,0}, {1261,177,253,0}, {3213,177,253,0}, {1449,177,253,0}, {1533,177,253,0},
+    {1617,177,253,0}, {3297,177,253,0}, {1701,177,253,0}, {3381,177,253,0}, {1785,177,253,0}, {3465,177,253,0}, {417,470,492,0}, {1245,470,580,0},
+    {3549,470,0,0}, {609,177,253,0}, {3633,177,253,0}, {1280,177,253,0}, {1268,177,253,0}, {1285,177,253,0}, {1287,177,253,0}, {445,177,253,0},
+    {1274,177,253,0}, {1289,177,253,0}, {1274,177,253,0}, {1274,177,253,0}, {1277,177,253,0}, {3717,177,253,0}, {1281,177,253,0}, {1285,177,253,0},
+    {1286,177,253,0}, {1282,177,253,0}, {3801,177,253,0}, {1288,177,253,0}, {411,470,492,0}, {3885,470,0,0}, {1869,177,253,0}, {3969,470,0,0},
+    {4053,177,253,0}, {1953,177,253,0}, {4137,177,253,0}, {156,470,492,0}, {2037,470,0,0}, {4221,470,0,0}, {2121,177,253,0}, {4305,177,253,0},
+    {1300,0,0,0}, {1301,115,0,0}, {1303,108,0,0}, {0,116,0,0}, {2205,177,253,0}, {1305,0,0,0}, {1368,107,0,0}, {1370,113,0,0},
+    {4389,177,253,0}, {1367,177,253,0}, {4473,177,253,0}, {0,122,0,0}, {0,134,0,0}, {1360,177,253,0}, {4557,177,253,0}, {0,104,0,0},
+    {1359,177,253,0}, {449,177,253,0}, {1355,177,253,0}, {1372,177,253,0}, {1370,177,253,0}, {11,0,0,0}, {357,177,253,0}, {1382,181,0,0},
+    {0,118,0,0}, {139,179,0,0}, {0,129,0,0}, {0,126,0,0}, {0,128,0,0}, {4641,177,253,0}, {1372,177,253,0}, {444,177,253,0},
+    {2289,177,253,0}, {4725,177,253,0}, {90,181,0,0}, {0,131,0,0}, {0,130,0,0}, {1384,0,0,0}, {0,2,0,0}, {0,97,0,0},
+    {1403,2,0,0}, {0,98,0,0}, {0,127,0,0}, {707,0,0,0}, {2037,180,0,0}, {0,117,0,0}, {0,4,0,0},
+};
+extern lexer_comb_t const lexer_comb_table[4809] = {
+    {217,218}, {0,0}, {217,219}, {217,220}, {217,221}, {217,222}, {217,223}, {217,225},
+    {217,231}, {217,232}, {217,233}, {217,234}, {217,235}, {217,236}, {217,237}, {217,238},
+    {217,239}, {217,240}, {217,241}, {217,242}, {217,243}, {217,243}, {217,244}, {217,245},
+    {217,246}, {217,247}, {217,248}, {217,249}, {217,250}, {217,251}, {217,252}, {605,609},
+    {605,609}, {217,254}, {228,227}, {217,255}, {228,229}, {228,230}, {217,256}, {248,584},
+    {217,257}, {217,258}, {217,259}, {217,260}, {219,630}, {217,261}, {217,262}, {248,585},
+    {248,586}, {217,263}, {217,264}, {217,265}, {217,266}, {217,267}, {217,268}, {217,269},
+    {217,270}, {217,271}, {217,272}, {217,273}, {217,274}, {243,605}, {217,276}, {243,243},
+    {243,243}, {217,277}, {217,278}, {217,279}, {217,280}, {217,281}, {220,630}, {217,282},
+    {217,283}, {217,284}, {217,285}, {217,286}, {217,287}, {253,253}, {253,253}, {232,618},
+    {217,288}, {217,289}, {217,290}, {217,291}, {232,620}, {253,253}, {253,253}, {253,253},
+    {253,253}, {253,253}, {253,253}, {253,253}, {253,253}, {253,253}, {253,253}, {253,253},
+    {253,253}, {253,253}, {253,253}, {253,253}, {253,253}, {253,253}, {253,253}, {253,253},
+    {253,253}, {253,253}, {272,416}, {272,417}, {618,621}, {253,253}, {618,618}, {253,470},
+    {253,470}, {253,470}, {253,470}, {253,470}, {253,470}, {253,470}, {253,470}, {253,470},
+    {253,470}, {253,470}, {253,470}, {253,470}, {253,470}, {253,470}, {253,470}, {253,470},
+    {253,470}, {253,470}, {253,470}, {253,470}, {253,470}, {253,470}, {253,470}, {253,470},
+    {253,470}, {266,253}, {266,253}, {266,253}, {266,253}, {266,253}, {266,253}, {266,253},
+    {266,253}, {266,253}, {266,253}, {266,253}, {266,253}, {266,253}, {266,253}, {266,253},
+    {266,253}, {266,253}, {266,253}, {266,253}, {266,253}, {266,253}, {277,390}, {609,609},
+    {609,609}, {266,469}, {277,391}, {266,275}, {266,275}, {266,275}, {266,275}, {266,275},
+    {266,275}, {266,275}, {266,275}, {266,275}, {266,275}, {266,275}, {266,275}, {266,275},
+    {266,275}, {266,275}, {266,275}, {266,275}, {266,275}, {266,275}, {266,275}, {266,275},
+    {266,275}, {266,275}, {266,275}, {266,275}, {266,275}, {260,154}, {260,154}, {260,154},
+    {260,154}, {260,154}, {260,154}, {260,154}, {260,154}, {260,154}, {260,154}, {260,154},
+    {260,154}, {260,154}, {260,154}, {260,154}, {260,154}, {260,154}, {260,154}, {260,154},
+    {260,154}, {274,275}, {274,275}, {260,154}, {260,154}, {260,154}, {260,154}, {260,154},
+    {260,154}, {273,402}, {579,470}, {522,523}, {233,608}, {273,403}, {260,515}, {242,228},
+    {579,580}, {273,404}, {238,623}, {522,524}, {242,293}, {522,525}, {273,405}, {273,406},
+    {260,516}, {522,526}, {242,610}, {233,619}, {238,611}, {260,517}, {260,154}, {260,154},
+    {260,154}, {274,275}, {260,154}, {274,275}, {274,275}, {274,275}, {274,275}, {274,275},
+    {274,275}, {274,275}, {274,275}, {274,275}, {274,275}, {274,275}, {274,275}, {274,275},
+    {274,275}, {274,399}, {274,275}, {274,275}, {274,275}, {274,275}, {274,275}, {274,275},
+    {274,275}, {274,275}, {274,275}, {274,275}, {274,275}, {260,154}, {260,154}, {260,154},
+    {260,154}, {254,139}, {254,139}, {254,139}, {254,139}, {254,139}, {254,139}, {254,139},
+    {254,139}, {254,139}, {254,139}, {254,139}, {254,139}, {254,139}, {254,139}, {254,139},
+    {254,139}, {254,139}, {254,139}, {254,139}, {254,139}, {268,460}, {246,589}, {254,139},
+    {254,139}, {254,139}, {254,139}, {254,139}, {254,139}, {246,590}, {246,591}, {240,625},
+    {493,494}, {226,627}, {254,574}, {226,226}, {226,226}, {493,470}, {268,461}, {240,626},
+    {268,462}, {315,328}, {270,435}, {226,226}, {226,226}, {226,226}, {226,226}, {226,226},
+    {226,226}, {270,436}, {254,139}, {254,139}, {254,139}, {271,425}, {254,139}, {315,329},
+    {270,437}, {271,426}, {315,330}, {281,350}, {342,343}, {270,438}, {281,351}, {221,221},
+    {283,314}, {281,352}, {287,294}, {271,427}, {254,575}, {226,226}, {226,226}, {226,226},
+    {226,226}, {226,226}, {226,226}, {283,315}, {287,295}, {289,224}, {283,316}, {342,344},
+    {283,317}, {254,139}, {254,139}, {254,139}, {254,139}, {261,142}, {261,142}, {261,142},
+    {261,142}, {261,142}, {261,142}, {261,142}, {261,142}, {261,142}, {261,142}, {261,142},
+    {261,142}, {261,142}, {261,142}, {261,142}, {261,142}, {261,142}, {261,142}, {261,142},
+    {261,142}, {275,275}, {275,275}, {261,142}, {261,142}, {261,142}, {261,142}, {261,142},
+    {261,142}, {606,555}, {276,396}, {606,556}, {606,557}, {278,376}, {261,495}, {293,622},
+    {222,629}, {293,292}, {293,624}, {606,558}, {316,322}, {278,377}, {276,397}, {229,227},
+    {606,559}, {230,227}, {261,496}, {278,378}, {316,323}, {289,216}, {261,142}, {261,142},
+    {261,142}, {275,275}, {261,142}, {275,275}, {275,275}, {275,275}, {275,275}, {275,275},
+    {275,275}, {275,275}, {275,275}, {275,275}, {275,275}, {275,275}, {275,275}, {275,275},
+    {275,275}, {275,275}, {275,275}, {275,275}, {275,275}, {275,275}, {275,275}, {275,275},
+    {275,275}, {275,275}, {275,275}, {275,275}, {275,275}, {261,142}, {261,142}, {261,142},
+    {261,142}, {496,143}, {496,143}, {496,143}, {496,143}, {496,143}, {496,143}, {496,143},
+    {496,143}, {496,143}, {496,143}, {496,143}, {496,143}, {496,143}, {496,143}, {496,143},
+    {496,143}, {496,143}, {496,143}, {496,143}, {496,143}, {298,275}, {298,275}, {496,143},
+    {496,143}, {496,143}, {496,143}, {496,143}, {496,143}, {476,477}, {436,445}, {550,551},
+    {615,602}, {572,470}, {496,497}, {559,560}, {237,612}, {601,614}, {247,587}, {550,470},
+    {601,615}, {250,582}, {615,603}, {476,478}, {572,573}, {251,579}, {496,498}, {436,446},
+    {252,577}, {559,561}, {496,143}, {496,143}, {496,143}, {298,275}, {496,143}, {298,275},
+    {298,275}, {298,275}, {298,275}, {298,275}, {298,275}, {298,275}, {298,275}, {298,275},
+    {298,275}, {298,275}, {298,275}, {298,275}, {298,275}, {298,275}, {298,275}, {298,275},
+    {298,275}, {298,275}, {298,275}, {298,275}, {298,275}, {298,275}, {298,275}, {298,275},
+    {298,275}, {496,143}, {496,143}, {496,143}, {496,143}, {516,155}, {516,155}, {516,155},
+    {516,155}, {516,155}, {516,155}, {516,155}, {516,155}, {516,155}, {516,155}, {516,155},
+    {516,155}, {516,155}, {516,155}, {516,155}, {516,155}, {516,155}, {516,155}, {516,155},
+    {516,155}, {301,275}, {301,275}, {516,155}, {516,155}, {516,155}, {516,155}, {516,155},
+    {516,155}, {255,572}, {256,616}, {257,600}, {258,553}, {259,550}, {516,542}, {262,492},
+    {265,488}, {269,456}, {279,366}, {280,363}, {282,342}, {284,311}, {285,305}, {286,302},
+    {516,543}, {292,622}, {294,299}, {295,296}, {296,297}, {297,298}, {516,155}, {516,155},
+    {516,155}, {301,275}, {516,155}, {301,275}, {301,275}, {301,275}, {301,275}, {301,275},
+    {301,275}, {301,275}, {301,275}, {301,275}, {301,275}, {301,275}, {301,275}, {301,275},
+    {301,275}, {301,275}, {301,275}, {301,275}, {301,275}, {301,275}, {301,275}, {301,275},
+    {301,275}, {301,275}, {301,275}, {301,275}, {301,275}, {516,155}, {516,155}, {516,155},
+    {516,155}, {553,168}, {553,168}, {553,168}, {553,168}, {553,168}, {553,168}, {553,168},
+    {553,168}, {553,168}, {553,168}, {553,168}, {553,168}, {553,168}, {553,168}, {553,168},
+    {553,168}, {553,168}, {553,168}, {553,168}, {553,168}, {304,275}, {304,275}, {553,168},
+    {553,168}, {553,168}, {553,168}, {553,168}, {553,168}, {299,300}, {300,301}, {302,303},
+    {303,304}, {305,306}, {306,307}, {307,308}, {308,309}, {309,310}, {311,312}, {312,313},
+    {314,338}, {317,318}, {553,554}, {318,319}, {319,320}, {320,321}, {553,606}, {322,327},
+    {323,324}, {324,325}, {553,168}, {553,168}, {553,168}, {304,275}, {553,168}, {304,275},
+    {304,275}, {304,275}, {304,275}, {304,275}, {304,275}, {304,275}, {304,275}, {304,275},
+    {304,275}, {304,275}, {304,275}, {304,275}, {304,275}, {304,275}, {304,275}, {304,275},
+    {304,275}, {304,275}, {304,275}, {304,275}, {304,275}, {304,275}, {304,275}, {304,275},
+    {304,275}, {553,168}, {553,168}, {553,168}, {553,168}, {492,178}, {492,178}, {492,178},
+    {492,178}, {492,178}, {492,178}, {492,178}, {492,178}, {492,178}, {492,178}, {492,178},
+    {492,178}, {492,178}, {492,178}, {492,178}, {492,178}, {492,178}, {492,178}, {492,178},
+    {492,178}, {231,226}, {231,226}, {492,178}, {492,178}, {492,178}, {492,178}, {492,178},
+    {492,178}, {231,226}, {231,226}, {231,226}, {231,226}, {231,226}, {231,226}, {627,628},
+    {627,628}, {325,326}, {328,336}, {329,334}, {376,382}, {330,331}, {331,332}, {627,628},
+    {627,628}, {627,628}, {627,628}, {627,628}, {627,628}, {332,333}, {492,178}, {492,178},
+    {492,178}, {376,383}, {492,178}, {231,226}, {231,226}, {231,226}, {231,226}, {231,226},
+    {231,226}, {376,384}, {334,335}, {492,493}, {336,337}, {338,339}, {339,340}, {340,341},
+    {343,348}, {627,628}, {627,628}, {627,628}, {627,628}, {627,628}, {627,628}, {344,345},
+    {345,346}, {346,347}, {350,362}, {351,355}, {352,353}, {492,178}, {492,178}, {492,178},
+    {492,178}, {495,145}, {495,145}, {495,145}, {495,145}, {495,145}, {495,145}, {495,145},
+    {495,145}, {495,145}, {495,145}, {495,145}, {495,145}, {495,145}, {495,145}, {495,145},
+    {495,145}, {495,145}, {495,145}, {495,145}, {495,145}, {313,275}, {313,275}, {495,145},
+    {495,145}, {495,145}, {495,145}, {495,145}, {495,145}, {353,354}, {355,356}, {356,357},
+    {357,358}, {358,359}, {495,508}, {359,360}, {360,361}, {363,364}, {364,365}, {366,367},
+    {368,369}, {369,370}, {370,371}, {371,372}, {372,373}, {373,374}, {374,375}, {377,381},
+    {378,379}, {379,380}, {495,145}, {495,145}, {495,145}, {313,275}, {495,145}, {313,275},
+    {313,275}, {313,275}, {313,275}, {313,275}, {313,275}, {313,275}, {313,275}, {313,275},
+    {313,275}, {313,275}, {313,275}, {313,275}, {313,275}, {313,275}, {313,275}, {313,275},
+    {313,275}, {313,275}, {313,275}, {313,275}, {313,275}, {313,275}, {313,275}, {313,275},
+    {313,275}, {495,145}, {495,145}, {495,145}, {495,145}, {497,146}, {497,146}, {497,146},
+    {497,146}, {497,146}, {497,146}, {497,146}, {497,146}, {497,146}, {497,146}, {497,146},
+    {497,146}, {497,146}, {497,146}, {497,146}, {497,146}, {497,146}, {497,146}, {497,146},
+    {497,146}, {321,275}, {321,275}, {497,146}, {497,146}, {497,146}, {497,146}, {497,146},
+    {497,146}, {382,388}, {383,385}, {385,386}, {386,387}, {388,389}, {497,502}, {390,393},
+    {391,392}, {393,394}, {394,395}, {397,398}, {399,400}, {400,401}, {402,413}, {403,410},
+    {404,408}, {406,407}, {408,409}, {410,411}, {411,412}, {413,414}, {497,146}, {497,146},
+    {497,146}, {321,275}, {497,146}, {321,275}, {321,275}, {321,275}, {321,275}, {321,275},
+    {321,275}, {321,275}, {321,275}, {321,275}, {321,275}, {321,275}, {321,275}, {321,275},
+    {321,275}, {321,275}, {321,275}, {321,275}, {321,275}, {321,275}, {321,275}, {321,275},
+    {321,275}, {321,275}, {321,275}, {321,275}, {321,275}, {497,146}, {497,146}, {497,146},
+    {497,146}, {498,144}, {498,144}, {498,144}, {498,144}, {498,144}, {498,144}, {498,144},
+    {498,144}, {498,144}, {498,144}, {498,144}, {498,144}, {498,144}, {498,144}, {498,144},
+    {498,144}, {498,144}, {498,144}, {498,144}, {498,144}, {326,275}, {326,275}, {498,144},
+    {498,144}, {498,144}, {498,144}, {498,144}, {498,144}, {414,415}, {416,423}, {417,418},
+    {418,419}, {419,420}, {498,499}, {420,421}, {421,422}, {423,424}, {425,433}, {426,428},
+    {428,429}, {429,430}, {430,431}, {431,432}, {433,434}, {435,454}, {437,439}, {439,440},
+    {440,441}, {441,442}, {498,144}, {498,144}, {498,144}, {326,275}, {498,144}, {326,275},
+    {326,275}, {326,275}, {326,275}, {326,275}, {326,275}, {326,275}, {326,275}, {326,275},
+    {326,275}, {326,275}, {326,275}, {326,275}, {326,275}, {326,275}, {326,275}, {326,275},
+    {326,275}, {326,275}, {326,275}, {326,275}, {326,275}, {326,275}, {326,275}, {326,275},
+    {326,275}, {498,144}, {498,144}, {498,144}, {498,144}, {499,147}, {499,147}, {499,147},
+    {499,147}, {499,147}, {499,147}, {499,147}, {499,147}, {499,147}, {499,147}, {499,147},
+    {499,147}, {499,147}, {499,147}, {499,147}, {499,147}, {499,147}, {499,147}, {499,147},
+    {499,147}, {327,275}, {327,275}, {499,147}, {499,147}, {499,147}, {499,147}, {499,147},
+    {499,147}, {442,443}, {443,444}, {445,450}, {446,447}, {447,448}, {499,500}, {448,449},
+    {450,451}, {451,452}, {452,453}, {454,455}, {456,457}, {457,458}, {458,459}, {460,467},
+    {461,466}, {462,463}, {463,464}, {464,465}, {468,471}, {469,468}, {499,147}, {499,147},
+    {499,147}, {327,275}, {499,147}, {327,275}, {327,275}, {327,275}, {327,275}, {327,275},
+    {327,275}, {327,275}, {327,275}, {327,275}, {327,275}, {327,275}, {327,275}, {327,275},
+    {327,275}, {327,275}, {327,275}, {327,275}, {327,275}, {327,275}, {327,275}, {327,275},
+    {327,275}, {327,275}, {327,275}, {327,275}, {327,275}, {499,147}, {499,147}, {499,147},
+    {499,147}, {500,150}, {500,150}, {500,150}, {500,150}, {500,150}, {500,150}, {500,150},
+    {500,150}, {500,150}, {500,150}, {500,150}, {500,150}, {500,150}, {500,150}, {500,150},
+    {500,150}, {500,150}, {500,150}, {500,150}, {500,150}, {333,275}, {333,275}, {500,150},
+    {500,150}, {500,150}, {500,150}, {500,150}, {500,150}, {470,470}, {471,472}, {472,473},
+    {473,474}, {474,475}, {500,501}, {475,476}, {477,483}, {478,479}, {479,480}, {480,481},
+    {481,482}, {483,484}, {484,485}, {485,486}, {486,487}, {504,613}, {506,507}, {511,597},
+    {512,593}, {513,571}, {500,150}, {500,150}, {500,150}, {333,275}, {500,150}, {333,275},
+    {333,275}, {333,275}, {333,275}, {333,275}, {333,275}, {333,275}, {333,275}, {333,275},
+    {333,275}, {333,275}, {333,275}, {333,275}, {333,275}, {333,275}, {333,275}, {333,275},
+    {333,275}, {333,275}, {333,275}, {333,275}, {333,275}, {333,275}, {333,275}, {333,275},
+    {333,275}, {500,150}, {500,150}, {500,150}, {500,150}, {502,149}, {502,149}, {502,149},
+    {502,149}, {502,149}, {502,149}, {502,149}, {502,149}, {502,149}, {502,149}, {502,149},
+    {502,149}, {502,149}, {502,149}, {502,149}, {502,149}, {502,149}, {502,149}, {502,149},
+    {502,149}, {335,275}, {335,275}, {502,149}, {502,149}, {502,149}, {502,149}, {502,149},
+    {502,149}, {514,569}, {517,518}, {518,519}, {519,520}, {520,521}, {502,503}, {521,522},
+    {523,538}, {524,535}, {525,533}, {526,527}, {527,528}, {528,529}, {529,530}, {530,531},
+    {531,532}, {533,534}, {535,536}, {536,537}, {538,539}, {539,540}, {502,149}, {502,149},
+    {502,149}, {335,275}, {502,149}, {335,275}, {335,275}, {335,275}, {335,275}, {335,275},
+    {335,275}, {335,275}, {335,275}, {335,275}, {335,275}, {335,275}, {335,275}, {335,275},
+    {335,275}, {335,275}, {335,275}, {335,275}, {335,275}, {335,275}, {335,275}, {335,275},
+    {335,275}, {335,275}, {335,275}, {335,275}, {335,275}, {502,149}, {502,149}, {502,149},
+    {502,149}, {508,148}, {508,148}, {508,148}, {508,148}, {508,148}, {508,148}, {508,148},
+    {508,148}, {508,148}, {508,148}, {508,148}, {508,148}, {508,148}, {508,148}, {508,148},
+    {508,148}, {508,148}, {508,148}, {508,148}, {508,148}, {337,275}, {337,275}, {508,148},
+    {508,148}, {508,148}, {508,148}, {508,148}, {508,148}, {540,541}, {551,552}, {555,514},
+    {556,513}, {557,512}, {508,509}, {558,511}, {560,566}, {561,562}, {562,563}, {563,564},
+    {564,565}, {566,567}, {567,568}, {568,510}, {569,570}, {571,592}, {584,489}, {585,490},
+    {586,491}, {589,599}, {508,148}, {508,148}, {508,148}, {337,275}, {508,148}, {337,275},
+    {337,275}, {337,275}, {337,275}, {337,275}, {337,275}, {337,275}, {337,275}, {337,275},
+    {337,275}, {337,275}, {337,275}, {337,275}, {337,275}, {337,275}, {337,275}, {337,275},
+    {337,275}, {337,275}, {337,275}, {337,275}, {337,275}, {337,275}, {337,275}, {337,275},
+    {337,275}, {508,148}, {508,148}, {508,148}, {508,148}, {515,157}, {515,157}, {515,157},
+    {515,157}, {515,157}, {515,157}, {515,157}, {515,157}, {515,157}, {515,157}, {515,157},
+    {515,157}, {515,157}, {515,157}, {515,157}, {515,157}, {515,157}, {515,157}, {515,157},
+    {515,157}, {341,275}, {341,275}, {515,157}, {515,157}, {515,157}, {515,157}, {515,157},
+    {515,157}, {590,596}, {591,595}, {593,594}, {597,598}, {600,601}, {515,548}, {602,506},
+    {603,505}, {604,504}, {607,607}, {614,604}, {621,607}, {624,622}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {515,157}, {515,157},
+    {515,157}, {341,275}, {515,157}, {341,275}, {341,275}, {341,275}, {341,275}, {341,275},
+    {341,275}, {341,275}, {341,275}, {341,275}, {341,275}, {341,275}, {341,275}, {341,275},
+    {341,275}, {341,275}, {341,275}, {341,275}, {341,275}, {341,275}, {341,275}, {341,275},
+    {341,275}, {341,275}, {341,275}, {341,275}, {341,275}, {515,157}, {515,157}, {515,157},
+    {515,157}, {542,158}, {542,158}, {542,158}, {542,158}, {542,158}, {542,158}, {542,158},
+    {542,158}, {542,158}, {542,158}, {542,158}, {542,158}, {542,158}, {542,158}, {542,158},
+    {542,158}, {542,158}, {542,158}, {542,158}, {542,158}, {347,275}, {347,275}, {542,158},
+    {542,158}, {542,158}, {542,158}, {542,158}, {542,158}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {542,546}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {542,158}, {542,158}, {542,158}, {347,275}, {542,158}, {347,275},
+    {347,275}, {347,275}, {347,275}, {347,275}, {347,275}, {347,275}, {347,275}, {347,275},
+    {347,275}, {347,275}, {347,275}, {347,275}, {347,275}, {347,275}, {347,275}, {347,275},
+    {347,275}, {347,275}, {347,275}, {347,275}, {347,275}, {347,275}, {347,275}, {347,275},
+    {347,275}, {542,158}, {542,158}, {542,158}, {542,158}, {543,156}, {543,156}, {543,156},
+    {543,156}, {543,156}, {543,156}, {543,156}, {543,156}, {543,156}, {543,156}, {543,156},
+    {543,156}, {543,156}, {543,156}, {543,156}, {543,156}, {543,156}, {543,156}, {543,156},
+    {543,156}, {348,275}, {348,275}, {543,156}, {543,156}, {543,156}, {543,156}, {543,156},
+    {543,156}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {543,544}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {543,156}, {543,156},
+    {543,156}, {348,275}, {543,156}, {348,275}, {348,275}, {348,275}, {348,275}, {348,275},
+    {348,275}, {348,275}, {348,275}, {348,275}, {348,275}, {348,275}, {348,275}, {348,275},
+    {348,275}, {348,275}, {348,275}, {348,275}, {348,275}, {348,275}, {348,275}, {348,275},
+    {348,275}, {348,275}, {348,275}, {348,349}, {348,275}, {543,156}, {543,156}, {543,156},
+    {543,156}, {544,159}, {544,159}, {544,159}, {544,159}, {544,159}, {544,159}, {544,159},
+    {544,159}, {544,159}, {544,159}, {544,159}, {544,159}, {544,159}, {544,159}, {544,159},
+    {544,159}, {544,159}, {544,159}, {544,159}, {544,159}, {349,275}, {349,275}, {544,159},
+    {544,159}, {544,159}, {544,159}, {544,159}, {544,159}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {544,588}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {544,159}, {544,159}, {544,159}, {349,275}, {544,159}, {349,275},
+    {349,275}, {349,275}, {349,275}, {349,275}, {349,275}, {349,275}, {349,275}, {349,275},
+    {349,275}, {349,275}, {349,275}, {349,275}, {349,275}, {349,275}, {349,275}, {349,275},
+    {349,275}, {349,275}, {349,275}, {349,275}, {349,275}, {349,275}, {349,275}, {349,275},
+    {349,275}, {544,159}, {544,159}, {544,159}, {544,159}, {546,161}, {546,161}, {546,161},
+    {546,161}, {546,161}, {546,161}, {546,161}, {546,161}, {546,161}, {546,161}, {546,161},
+    {546,161}, {546,161}, {546,161}, {546,161}, {546,161}, {546,161}, {546,161}, {546,161},
+    {546,161}, {354,275}, {354,275}, {546,161}, {546,161}, {546,161}, {546,161}, {546,161},
+    {546,161}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {546,547}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {546,161}, {546,161},
+    {546,161}, {354,275}, {546,161}, {354,275}, {354,275}, {354,275}, {354,275}, {354,275},
+    {354,275}, {354,275}, {354,275}, {354,275}, {354,275}, {354,275}, {354,275}, {354,275},
+    {354,275}, {354,275}, {354,275}, {354,275}, {354,275}, {354,275}, {354,275}, {354,275},
+    {354,275}, {354,275}, {354,275}, {354,275}, {354,275}, {546,161}, {546,161}, {546,161},
+    {546,161}, {548,160}, {548,160}, {548,160}, {548,160}, {548,160}, {548,160}, {548,160},
+    {548,160}, {548,160}, {548,160}, {548,160}, {548,160}, {548,160}, {548,160}, {548,160},
+    {548,160}, {548,160}, {548,160}, {548,160}, {548,160}, {361,275}, {361,275}, {548,160},
+    {548,160}, {548,160}, {548,160}, {548,160}, {548,160}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {548,549}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {548,160}, {548,160}, {548,160}, {361,275}, {548,160}, {361,275},
+    {361,275}, {361,275}, {361,275}, {361,275}, {361,275}, {361,275}, {361,275}, {361,275},
+    {361,275}, {361,275}, {361,275}, {361,275}, {361,275}, {361,275}, {361,275}, {361,275},
+    {361,275}, {361,275}, {361,275}, {361,275}, {361,275}, {361,275}, {361,275}, {361,275},
+    {361,275}, {548,160}, {548,160}, {548,160}, {548,160}, {574,140}, {574,140}, {574,140},
+    {574,140}, {574,140}, {574,140}, {574,140}, {574,140}, {574,140}, {574,140}, {574,140},
+    {574,140}, {574,140}, {574,140}, {574,140}, {574,140}, {574,140}, {574,140}, {574,140},
+    {574,140}, {362,275}, {362,275}, {574,140}, {574,140}, {574,140}, {574,140}, {574,140},
+    {574,140}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {574,576}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {574,140}, {574,140},
+    {574,140}, {362,275}, {574,140}, {362,275}, {362,275}, {362,275}, {362,275}, {362,275},
+    {362,275}, {362,275}, {362,275}, {362,275}, {362,275}, {362,275}, {362,275}, {362,275},
+    {362,275}, {362,275}, {362,275}, {362,275}, {362,275}, {362,275}, {362,275}, {362,275},
+    {362,275}, {362,275}, {362,275}, {362,275}, {362,275}, {574,140}, {574,140}, {574,140},
+    {574,140}, {577,170}, {577,170}, {577,170}, {577,170}, {577,170}, {577,170}, {577,170},
+    {577,170}, {577,170}, {577,170}, {577,170}, {577,170}, {577,170}, {577,170}, {577,170},
+    {577,170}, {577,170}, {577,170}, {577,170}, {577,170}, {365,275}, {365,275}, {577,170},
+    {577,170}, {577,170}, {577,170}, {577,170}, {577,170}, {0,0}, {0,0}, {577,578},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {577,170}, {577,170}, {577,170}, {365,275}, {577,170}, {365,275},
+    {365,275}, {365,275}, {365,275}, {365,275}, {365,275}, {365,275}, {365,275}, {365,275},
+    {365,275}, {365,275}, {365,275}, {365,275}, {365,275}, {365,275}, {365,275}, {365,275},
+    {365,275}, {365,275}, {365,275}, {365,275}, {365,275}, {365,275}, {365,275}, {365,275},
+    {365,275}, {577,170}, {577,170}, {577,170}, {577,170}, {580,178}, {580,178}, {580,178},
+    {580,178}, {580,178}, {580,178}, {580,178}, {580,178}, {580,178}, {580,178}, {580,178},
+    {580,178}, {580,178}, {580,178}, {580,178}, {580,178}, {580,178}, {580,178}, {580,178},
+    {580,178}, {628,628}, {628,628}, {580,178}, {580,178}, {580,178}, {580,178}, {580,178},
+    {580,178}, {628,628}, {628,628}, {628,628}, {628,628}, {628,628}, {628,628}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {580,178}, {580,178},
+    {580,178}, {0,0}, {580,178}, {628,628}, {628,628}, {628,628}, {628,628}, {628,628},
+    {628,628}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {580,581}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {580,178}, {580,178}, {580,178},
+    {580,178}, {582,166}, {582,166}, {582,166}, {582,166}, {582,166}, {582,166}, {582,166},
+    {582,166}, {582,166}, {582,166}, {582,166}, {582,166}, {582,166}, {582,166}, {582,166},
+    {582,166}, {582,166}, {582,166}, {582,166}, {582,166}, {367,275}, {367,275}, {582,166},
+    {582,166}, {582,166}, {582,166}, {582,166}, {582,166}, {582,583}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {582,166}, {582,166}, {582,166}, {367,368}, {582,166}, {367,275},
+    {367,275}, {367,275}, {367,275}, {367,275}, {367,275}, {367,275}, {367,275}, {367,275},
+    {367,275}, {367,275}, {367,275}, {367,275}, {367,275}, {367,275}, {367,275}, {367,275},
+    {367,275}, {367,275}, {367,275}, {367,275}, {367,275}, {367,275}, {367,275}, {367,275},
+    {367,275}, {582,166}, {582,166}, {582,166}, {582,166}, {588,162}, {588,162}, {588,162},
+    {588,162}, {588,162}, {588,162}, {588,162}, {588,162}, {588,162}, {588,162}, {588,162},
+    {588,162}, {588,162}, {588,162}, {588,162}, {588,162}, {588,162}, {588,162}, {588,162},
+    {588,162}, {375,275}, {375,275}, {588,162}, {588,162}, {588,162}, {588,162}, {588,162},
+    {588,162}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {588,545}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {588,162}, {588,162},
+    {588,162}, {375,275}, {588,162}, {375,275}, {375,275}, {375,275}, {375,275}, {375,275},
+    {375,275}, {375,275}, {375,275}, {375,275}, {375,275}, {375,275}, {375,275}, {375,275},
+    {375,275}, {375,275}, {375,275}, {375,275}, {375,275}, {375,275}, {375,275}, {375,275},
+    {375,275}, {375,275}, {375,275}, {375,275}, {375,275}, {588,162}, {588,162}, {588,162},
+    {588,162}, {616,172}, {616,172}, {616,172}, {616,172}, {616,172}, {616,172}, {616,172},
+    {616,172}, {616,172}, {616,172}, {616,172}, {616,172}, {616,172}, {616,172}, {616,172},
+    {616,172}, {616,172}, {616,172}, {616,172}, {616,172}, {380,275}, {380,275}, {616,172},
+    {616,172}, {616,172}, {616,172}, {616,172}, {616,172}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {616,617},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {616,172}, {616,172}, {616,172}, {380,275}, {616,172}, {380,275},
+    {380,275}, {380,275}, {380,275}, {380,275}, {380,275}, {380,275}, {380,275}, {380,275},
+    {380,275}, {380,275}, {380,275}, {380,275}, {380,275}, {380,275}, {380,275}, {380,275},
+    {380,275}, {380,275}, {380,275}, {380,275}, {380,275}, {380,275}, {380,275}, {380,275},
+    {380,275}, {616,172}, {616,172}, {616,172}, {616,172}, {494,137}, {494,137}, {494,137},
+    {494,137}, {494,137}, {494,137}, {494,137}, {494,137}, {494,137}, {494,137}, {494,137},
+    {494,137}, {494,137}, {494,137}, {494,137}, {494,137}, {494,137}, {494,137}, {494,137},
+    {494,137}, {381,275}, {381,275}, {494,137}, {494,137}, {494,137}, {494,137}, {494,137},
+    {494,137}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {494,137}, {494,137},
+    {494,137}, {381,275}, {494,137}, {381,275}, {381,275}, {381,275}, {381,275}, {381,275},
+    {381,275}, {381,275}, {381,275}, {381,275}, {381,275}, {381,275}, {381,275}, {381,275},
+    {381,275}, {381,275}, {381,275}, {381,275}, {381,275}, {381,275}, {381,275}, {381,275},
+    {381,275}, {381,275}, {381,275}, {381,275}, {381,275}, {494,137}, {494,137}, {494,137},
+    {494,137}, {501,153}, {501,153}, {501,153}, {501,153}, {501,153}, {501,153}, {501,153},
+    {501,153}, {501,153}, {501,153}, {501,153}, {501,153}, {501,153}, {501,153}, {501,153},
+    {501,153}, {501,153}, {501,153}, {501,153}, {501,153}, {384,275}, {384,275}, {501,153},
+    {501,153}, {501,153}, {501,153}, {501,153}, {501,153}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {501,153}, {501,153}, {501,153}, {384,275}, {501,153}, {384,275},
+    {384,275}, {384,275}, {384,275}, {384,275}, {384,275}, {384,275}, {384,275}, {384,275},
+    {384,275}, {384,275}, {384,275}, {384,275}, {384,275}, {384,275}, {384,275}, {384,275},
+    {384,275}, {384,275}, {384,275}, {384,275}, {384,275}, {384,275}, {384,275}, {384,275},
+    {384,275}, {501,153}, {501,153}, {501,153}, {501,153}, {503,152}, {503,152}, {503,152},
+    {503,152}, {503,152}, {503,152}, {503,152}, {503,152}, {503,152}, {503,152}, {503,152},
+    {503,152}, {503,152}, {503,152}, {503,152}, {503,152}, {503,152}, {503,152}, {503,152},
+    {503,152}, {387,275}, {387,275}, {503,152}, {503,152}, {503,152}, {503,152}, {503,152},
+    {503,152}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {503,152}, {503,152},
+    {503,152}, {387,275}, {503,152}, {387,275}, {387,275}, {387,275}, {387,275}, {387,275},
+    {387,275}, {387,275}, {387,275}, {387,275}, {387,275}, {387,275}, {387,275}, {387,275},
+    {387,275}, {387,275}, {387,275}, {387,275}, {387,275}, {387,275}, {387,275}, {387,275},
+    {387,275}, {387,275}, {387,275}, {387,275}, {387,275}, {503,152}, {503,152}, {503,152},
+    {503,152}, {505,63}, {505,63}, {505,63}, {505,63}, {505,63}, {505,63}, {505,63},
+    {505,63}, {505,63}, {505,63}, {505,63}, {505,63}, {505,63}, {505,63}, {505,63},
+    {505,63}, {505,63}, {505,63}, {505,63}, {505,63}, {389,275}, {389,275}, {505,63},
+    {505,63}, {505,63}, {505,63}, {505,63}, {505,63}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {505,63}, {505,63}, {505,63}, {389,275}, {505,63}, {389,275},
+    {389,275}, {389,275}, {389,275}, {389,275}, {389,275}, {389,275}, {389,275}, {389,275},
+    {389,275}, {389,275}, {389,275}, {389,275}, {389,275}, {389,275}, {389,275}, {389,275},
+    {389,275}, {389,275}, {389,275}, {389,275}, {389,275}, {389,275}, {389,275}, {389,275},
+    {389,275}, {505,63}, {505,63}, {505,63}, {505,63}, {507,62}, {507,62}, {507,62},
+    {507,62}, {507,62}, {507,62}, {507,62}, {507,62}, {507,62}, {507,62}, {507,62},
+    {507,62}, {507,62}, {507,62}, {507,62}, {507,62}, {507,62}, {507,62}, {507,62},
+    {507,62}, {392,275}, {392,275}, {507,62}, {507,62}, {507,62}, {507,62}, {507,62},
+    {507,62}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {507,62}, {507,62},
+    {507,62}, {392,275}, {507,62}, {392,275}, {392,275}, {392,275}, {392,275}, {392,275},
+    {392,275}, {392,275}, {392,275}, {392,275}, {392,275}, {392,275}, {392,275}, {392,275},
+    {392,275}, {392,275}, {392,275}, {392,275}, {392,275}, {392,275}, {392,275}, {392,275},
+    {392,275}, {392,275}, {392,275}, {392,275}, {392,275}, {507,62}, {507,62}, {507,62},
+    {507,62}, {509,151}, {509,151}, {509,151}, {509,151}, {509,151}, {509,151}, {509,151},
+    {509,151}, {509,151}, {509,151}, {509,151}, {509,151}, {509,151}, {509,151}, {509,151},
+    {509,151}, {509,151}, {509,151}, {509,151}, {509,151}, {395,275}, {395,275}, {509,151},
+    {509,151}, {509,151}, {509,151}, {509,151}, {509,151}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {509,151}, {509,151}, {509,151}, {395,275}, {509,151}, {395,275},
+    {395,275}, {395,275}, {395,275}, {395,275}, {395,275}, {395,275}, {395,275}, {395,275},
+    {395,275}, {395,275}, {395,275}, {395,275}, {395,275}, {395,275}, {395,275}, {395,275},
+    {395,275}, {395,275}, {395,275}, {395,275}, {395,275}, {395,275}, {395,275}, {395,275},
+    {395,275}, {509,151}, {509,151}, {509,151}, {509,151}, {510,58}, {510,58}, {510,58},
+    {510,58}, {510,58}, {510,58}, {510,58}, {510,58}, {510,58}, {510,58}, {510,58},
+    {510,58}, {510,58}, {510,58}, {510,58}, {510,58}, {510,58}, {510,58}, {510,58},
+    {510,58}, {396,275}, {396,275}, {510,58}, {510,58}, {510,58}, {510,58}, {510,58},
+    {510,58}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {510,58}, {510,58},
+    {510,58}, {396,275}, {510,58}, {396,275}, {396,275}, {396,275}, {396,275}, {396,275},
+    {396,275}, {396,275}, {396,275}, {396,275}, {396,275}, {396,275}, {396,275}, {396,275},
+    {396,275}, {396,275}, {396,275}, {396,275}, {396,275}, {396,275}, {396,275}, {396,275},
+    {396,275}, {396,275}, {396,275}, {396,275}, {396,275}, {510,58}, {510,58}, {510,58},
+    {510,58}, {532,67}, {532,67}, {532,67}, {532,67}, {532,67}, {532,67}, {532,67},
+    {532,67}, {532,67}, {532,67}, {532,67}, {532,67}, {532,67}, {532,67}, {532,67},
+    {532,67}, {532,67}, {532,67}, {532,67}, {532,67}, {398,275}, {398,275}, {532,67},
+    {532,67}, {532,67}, {532,67}, {532,67}, {532,67}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {532,67}, {532,67}, {532,67}, {398,275}, {532,67}, {398,275},
+    {398,275}, {398,275}, {398,275}, {398,275}, {398,275}, {398,275}, {398,275}, {398,275},
+    {398,275}, {398,275}, {398,275}, {398,275}, {398,275}, {398,275}, {398,275}, {398,275},
+    {398,275}, {398,275}, {398,275}, {398,275}, {398,275}, {398,275}, {398,275}, {398,275},
+    {398,275}, {532,67}, {532,67}, {532,67}, {532,67}, {534,65}, {534,65}, {534,65},
+    {534,65}, {534,65}, {534,65}, {534,65}, {534,65}, {534,65}, {534,65}, {534,65},
+    {534,65}, {534,65}, {534,65}, {534,65}, {534,65}, {534,65}, {534,65}, {534,65},
+    {534,65}, {401,275}, {401,275}, {534,65}, {534,65}, {534,65}, {534,65}, {534,65},
+    {534,65}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {534,65}, {534,65},
+    {534,65}, {401,275}, {534,65}, {401,275}, {401,275}, {401,275}, {401,275}, {401,275},
+    {401,275}, {401,275}, {401,275}, {401,275}, {401,275}, {401,275}, {401,275}, {401,275},
+    {401,275}, {401,275}, {401,275}, {401,275}, {401,275}, {401,275}, {401,275}, {401,275},
+    {401,275}, {401,275}, {401,275}, {401,275}, {401,275}, {534,65}, {534,65}, {534,65},
+    {534,65}, {537,64}, {537,64}, {537,64}, {537,64}, {537,64}, {537,64}, {537,64},
+    {537,64}, {537,64}, {537,64}, {537,64}, {537,64}, {537,64}, {537,64}, {537,64},
+    {537,64}, {537,64}, {537,64}, {537,64}, {537,64}, {405,275}, {405,275}, {537,64},
+    {537,64}, {537,64}, {537,64}, {537,64}, {537,64}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {537,64}, {537,64}, {537,64}, {405,275}, {537,64}, {405,275},
+    {405,275}, {405,275}, {405,275}, {405,275}, {405,275}, {405,275}, {405,275}, {405,275},
+    {405,275}, {405,275}, {405,275}, {405,275}, {405,275}, {405,275}, {405,275}, {405,275},
+    {405,275}, {405,275}, {405,275}, {405,275}, {405,275}, {405,275}, {405,275}, {405,275},
+    {405,275}, {537,64}, {537,64}, {537,64}, {537,64}, {541,66}, {541,66}, {541,66},
+    {541,66}, {541,66}, {541,66}, {541,66}, {541,66}, {541,66}, {541,66}, {541,66},
+    {541,66}, {541,66}, {541,66}, {541,66}, {541,66}, {541,66}, {541,66}, {541,66},
+    {541,66}, {407,275}, {407,275}, {541,66}, {541,66}, {541,66}, {541,66}, {541,66},
+    {541,66}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {541,66}, {541,66},
+    {541,66}, {407,275}, {541,66}, {407,275}, {407,275}, {407,275}, {407,275}, {407,275},
+    {407,275}, {407,275}, {407,275}, {407,275}, {407,275}, {407,275}, {407,275}, {407,275},
+    {407,275}, {407,275}, {407,275}, {407,275}, {407,275}, {407,275}, {407,275}, {407,275},
+    {407,275}, {407,275}, {407,275}, {407,275}, {407,275}, {541,66}, {541,66}, {541,66},
+    {541,66}, {545,165}, {545,165}, {545,165}, {545,165}, {545,165}, {545,165}, {545,165},
+    {545,165}, {545,165}, {545,165}, {545,165}, {545,165}, {545,165}, {545,165}, {545,165},
+    {545,165}, {545,165}, {545,165}, {545,165}, {545,165}, {409,275}, {409,275}, {545,165},
+    {545,165}, {545,165}, {545,165}, {545,165}, {545,165}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {545,165}, {545,165}, {545,165}, {409,275}, {545,165}, {409,275},
+    {409,275}, {409,275}, {409,275}, {409,275}, {409,275}, {409,275}, {409,275}, {409,275},
+    {409,275}, {409,275}, {409,275}, {409,275}, {409,275}, {409,275}, {409,275}, {409,275},
+    {409,275}, {409,275}, {409,275}, {409,275}, {409,275}, {409,275}, {409,275}, {409,275},
+    {409,275}, {545,165}, {545,165}, {545,165}, {545,165}, {547,164}, {547,164}, {547,164},
+    {547,164}, {547,164}, {547,164}, {547,164}, {547,164}, {547,164}, {547,164}, {547,164},
+    {547,164}, {547,164}, {547,164}, {547,164}, {547,164}, {547,164}, {547,164}, {547,164},
+    {547,164}, {412,275}, {412,275}, {547,164}, {547,164}, {547,164}, {547,164}, {547,164},
+    {547,164}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {547,164}, {547,164},
+    {547,164}, {412,275}, {547,164}, {412,275}, {412,275}, {412,275}, {412,275}, {412,275},
+    {412,275}, {412,275}, {412,275}, {412,275}, {412,275}, {412,275}, {412,275}, {412,275},
+    {412,275}, {412,275}, {412,275}, {412,275}, {412,275}, {412,275}, {412,275}, {412,275},
+    {412,275}, {412,275}, {412,275}, {412,275}, {412,275}, {547,164}, {547,164}, {547,164},
+    {547,164}, {549,163}, {549,163}, {549,163}, {549,163}, {549,163}, {549,163}, {549,163},
+    {549,163}, {549,163}, {549,163}, {549,163}, {549,163}, {549,163}, {549,163}, {549,163},
+    {549,163}, {549,163}, {549,163}, {549,163}, {549,163}, {415,275}, {415,275}, {549,163},
+    {549,163}, {549,163}, {549,163}, {549,163}, {549,163}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {549,163}, {549,163}, {549,163}, {415,275}, {549,163}, {415,275},
+    {415,275}, {415,275}, {415,275}, {415,275}, {415,275}, {415,275}, {415,275}, {415,275},
+    {415,275}, {415,275}, {415,275}, {415,275}, {415,275}, {415,275}, {415,275}, {415,275},
+    {415,275}, {415,275}, {415,275}, {415,275}, {415,275}, {415,275}, {415,275}, {415,275},
+    {415,275}, {549,163}, {549,163}, {549,163}, {549,163}, {552,175}, {552,175}, {552,175},
+    {552,175}, {552,175}, {552,175}, {552,175}, {552,175}, {552,175}, {552,175}, {552,175},
+    {552,175}, {552,175}, {552,175}, {552,175}, {552,175}, {552,175}, {552,175}, {552,175},
+    {552,175}, {422,275}, {422,275}, {552,175}, {552,175}, {552,175}, {552,175}, {552,175},
+    {552,175}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {552,175}, {552,175},
+    {552,175}, {422,275}, {552,175}, {422,275}, {422,275}, {422,275}, {422,275}, {422,275},
+    {422,275}, {422,275}, {422,275}, {422,275}, {422,275}, {422,275}, {422,275}, {422,275},
+    {422,275}, {422,275}, {422,275}, {422,275}, {422,275}, {422,275}, {422,275}, {422,275},
+    {422,275}, {422,275}, {422,275}, {422,275}, {422,275}, {552,175}, {552,175}, {552,175},
+    {552,175}, {554,169}, {554,169}, {554,169}, {554,169}, {554,169}, {554,169}, {554,169},
+    {554,169}, {554,169}, {554,169}, {554,169}, {554,169}, {554,169}, {554,169}, {554,169},
+    {554,169}, {554,169}, {554,169}, {554,169}, {554,169}, {424,275}, {424,275}, {554,169},
+    {554,169}, {554,169}, {554,169}, {554,169}, {554,169}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {554,169}, {554,169}, {554,169}, {424,275}, {554,169}, {424,275},
+    {424,275}, {424,275}, {424,275}, {424,275}, {424,275}, {424,275}, {424,275}, {424,275},
+    {424,275}, {424,275}, {424,275}, {424,275}, {424,275}, {424,275}, {424,275}, {424,275},
+    {424,275}, {424,275}, {424,275}, {424,275}, {424,275}, {424,275}, {424,275}, {424,275},
+    {424,275}, {554,169}, {554,169}, {554,169}, {554,169}, {565,57}, {565,57}, {565,57},
+    {565,57}, {565,57}, {565,57}, {565,57}, {565,57}, {565,57}, {565,57}, {565,57},
+    {565,57}, {565,57}, {565,57}, {565,57}, {565,57}, {565,57}, {565,57}, {565,57},
+    {565,57}, {427,275}, {427,275}, {565,57}, {565,57}, {565,57}, {565,57}, {565,57},
+    {565,57}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {565,57}, {565,57},
+    {565,57}, {427,275}, {565,57}, {427,275}, {427,275}, {427,275}, {427,275}, {427,275},
+    {427,275}, {427,275}, {427,275}, {427,275}, {427,275}, {427,275}, {427,275}, {427,275},
+    {427,275}, {427,275}, {427,275}, {427,275}, {427,275}, {427,275}, {427,275}, {427,275},
+    {427,275}, {427,275}, {427,275}, {427,275}, {427,275}, {565,57}, {565,57}, {565,57},
+    {565,57}, {570,59}, {570,59}, {570,59}, {570,59}, {570,59}, {570,59}, {570,59},
+    {570,59}, {570,59}, {570,59}, {570,59}, {570,59}, {570,59}, {570,59}, {570,59},
+    {570,59}, {570,59}, {570,59}, {570,59}, {570,59}, {432,275}, {432,275}, {570,59},
+    {570,59}, {570,59}, {570,59}, {570,59}, {570,59}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {570,59}, {570,59}, {570,59}, {432,275}, {570,59}, {432,275},
+    {432,275}, {432,275}, {432,275}, {432,275}, {432,275}, {432,275}, {432,275}, {432,275},
+    {432,275}, {432,275}, {432,275}, {432,275}, {432,275}, {432,275}, {432,275}, {432,275},
+    {432,275}, {432,275}, {432,275}, {432,275}, {432,275}, {432,275}, {432,275}, {432,275},
+    {432,275}, {570,59}, {570,59}, {570,59}, {570,59}, {573,174}, {573,174}, {573,174},
+    {573,174}, {573,174}, {573,174}, {573,174}, {573,174}, {573,174}, {573,174}, {573,174},
+    {573,174}, {573,174}, {573,174}, {573,174}, {573,174}, {573,174}, {573,174}, {573,174},
+    {573,174}, {434,275}, {434,275}, {573,174}, {573,174}, {573,174}, {573,174}, {573,174},
+    {573,174}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {573,174}, {573,174},
+    {573,174}, {434,275}, {573,174}, {434,275}, {434,275}, {434,275}, {434,275}, {434,275},
+    {434,275}, {434,275}, {434,275}, {434,275}, {434,275}, {434,275}, {434,275}, {434,275},
+    {434,275}, {434,275}, {434,275}, {434,275}, {434,275}, {434,275}, {434,275}, {434,275},
+    {434,275}, {434,275}, {434,275}, {434,275}, {434,275}, {573,174}, {573,174}, {573,174},
+    {573,174}, {575,138}, {575,138}, {575,138}, {575,138}, {575,138}, {575,138}, {575,138},
+    {575,138}, {575,138}, {575,138}, {575,138}, {575,138}, {575,138}, {575,138}, {575,138},
+    {575,138}, {575,138}, {575,138}, {575,138}, {575,138}, {438,275}, {438,275}, {575,138},
+    {575,138}, {575,138}, {575,138}, {575,138}, {575,138}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {575,138}, {575,138}, {575,138}, {438,275}, {575,138}, {438,275},
+    {438,275}, {438,275}, {438,275}, {438,275}, {438,275}, {438,275}, {438,275}, {438,275},
+    {438,275}, {438,275}, {438,275}, {438,275}, {438,275}, {438,275}, {438,275}, {438,275},
+    {438,275}, {438,275}, {438,275}, {438,275}, {438,275}, {438,275}, {438,275}, {438,275},
+    {438,275}, {575,138}, {575,138}, {575,138}, {575,138}, {576,141}, {576,141}, {576,141},
+    {576,141}, {576,141}, {576,141}, {576,141}, {576,141}, {576,141}, {576,141}, {576,141},
+    {576,141}, {576,141}, {576,141}, {576,141}, {576,141}, {576,141}, {576,141}, {576,141},
+    {576,141}, {444,275}, {444,275}, {576,141}, {576,141}, {576,141}, {576,141}, {576,141},
+    {576,141}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {576,141}, {576,141},
+    {576,141}, {444,275}, {576,141}, {444,275}, {444,275}, {444,275}, {444,275}, {444,275},
+    {444,275}, {444,275}, {444,275}, {444,275}, {444,275}, {444,275}, {444,275}, {444,275},
+    {444,275}, {444,275}, {444,275}, {444,275}, {444,275}, {444,275}, {444,275}, {444,275},
+    {444,275}, {444,275}, {444,275}, {444,275}, {444,275}, {576,141}, {576,141}, {576,141},
+    {576,141}, {578,171}, {578,171}, {578,171}, {578,171}, {578,171}, {578,171}, {578,171},
+    {578,171}, {578,171}, {578,171}, {578,171}, {578,171}, {578,171}, {578,171}, {578,171},
+    {578,171}, {578,171}, {578,171}, {578,171}, {578,171}, {449,275}, {449,275}, {578,171},
+    {578,171}, {578,171}, {578,171}, {578,171}, {578,171}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {578,171}, {578,171}, {578,171}, {449,275}, {578,171}, {449,275},
+    {449,275}, {449,275}, {449,275}, {449,275}, {449,275}, {449,275}, {449,275}, {449,275},
+    {449,275}, {449,275}, {449,275}, {449,275}, {449,275}, {449,275}, {449,275}, {449,275},
+    {449,275}, {449,275}, {449,275}, {449,275}, {449,275}, {449,275}, {449,275}, {449,275},
+    {449,275}, {578,171}, {578,171}, {578,171}, {578,171}, {581,176}, {581,176}, {581,176},
+    {581,176}, {581,176}, {581,176}, {581,176}, {581,176}, {581,176}, {581,176}, {581,176},
+    {581,176}, {581,176}, {581,176}, {581,176}, {581,176}, {581,176}, {581,176}, {581,176},
+    {581,176}, {453,275}, {453,275}, {581,176}, {581,176}, {581,176}, {581,176}, {581,176},
+    {581,176}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {581,176}, {581,176},
+    {581,176}, {453,275}, {581,176}, {453,275}, {453,275}, {453,275}, {453,275}, {453,275},
+    {453,275}, {453,275}, {453,275}, {453,275}, {453,275}, {453,275}, {453,275}, {453,275},
+    {453,275}, {453,275}, {453,275}, {453,275}, {453,275}, {453,275}, {453,275}, {453,275},
+    {453,275}, {453,275}, {453,275}, {453,275}, {453,275}, {581,176}, {581,176}, {581,176},
+    {581,176}, {583,167}, {583,167}, {583,167}, {583,167}, {583,167}, {583,167}, {583,167},
+    {583,167}, {583,167}, {583,167}, {583,167}, {583,167}, {583,167}, {583,167}, {583,167},
+    {583,167}, {583,167}, {583,167}, {583,167}, {583,167}, {455,275}, {455,275}, {583,167},
+    {583,167}, {583,167}, {583,167}, {583,167}, {583,167}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {583,167}, {583,167}, {583,167}, {455,275}, {583,167}, {455,275},
+    {455,275}, {455,275}, {455,275}, {455,275}, {455,275}, {455,275}, {455,275}, {455,275},
+    {455,275}, {455,275}, {455,275}, {455,275}, {455,275}, {455,275}, {455,275}, {455,275},
+    {455,275}, {455,275}, {455,275}, {455,275}, {455,275}, {455,275}, {455,275}, {455,275},
+    {455,275}, {583,167}, {583,167}, {583,167}, {583,167}, {592,55}, {592,55}, {592,55},
+    {592,55}, {592,55}, {592,55}, {592,55}, {592,55}, {592,55}, {592,55}, {592,55},
+    {592,55}, {592,55}, {592,55}, {592,55}, {592,55}, {592,55}, {592,55}, {592,55},
+    {592,55}, {459,275}, {459,275}, {592,55}, {592,55}, {592,55}, {592,55}, {592,55},
+    {592,55}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {592,55}, {592,55},
+    {592,55}, {459,275}, {592,55}, {459,275}, {459,275}, {459,275}, {459,275}, {459,275},
+    {459,275}, {459,275}, {459,275}, {459,275}, {459,275}, {459,275}, {459,275}, {459,275},
+    {459,275}, {459,275}, {459,275}, {459,275}, {459,275}, {459,275}, {459,275}, {459,275},
+    {459,275}, {459,275}, {459,275}, {459,275}, {459,275}, {592,55}, {592,55}, {592,55},
+    {592,55}, {594,60}, {594,60}, {594,60}, {594,60}, {594,60}, {594,60}, {594,60},
+    {594,60}, {594,60}, {594,60}, {594,60}, {594,60}, {594,60}, {594,60}, {594,60},
+    {594,60}, {594,60}, {594,60}, {594,60}, {594,60}, {465,275}, {465,275}, {594,60},
+    {594,60}, {594,60}, {594,60}, {594,60}, {594,60}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {594,60}, {594,60}, {594,60}, {465,275}, {594,60}, {465,275},
+    {465,275}, {465,275}, {465,275}, {465,275}, {465,275}, {465,275}, {465,275}, {465,275},
+    {465,275}, {465,275}, {465,275}, {465,275}, {465,275}, {465,275}, {465,275}, {465,275},
+    {465,275}, {465,275}, {465,275}, {465,275}, {465,275}, {465,275}, {465,275}, {465,275},
+    {465,275}, {594,60}, {594,60}, {594,60}, {594,60}, {598,56}, {598,56}, {598,56},
+    {598,56}, {598,56}, {598,56}, {598,56}, {598,56}, {598,56}, {598,56}, {598,56},
+    {598,56}, {598,56}, {598,56}, {598,56}, {598,56}, {598,56}, {598,56}, {598,56},
+    {598,56}, {466,275}, {466,275}, {598,56}, {598,56}, {598,56}, {598,56}, {598,56},
+    {598,56}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {598,56}, {598,56},
+    {598,56}, {466,275}, {598,56}, {466,275}, {466,275}, {466,275}, {466,275}, {466,275},
+    {466,275}, {466,275}, {466,275}, {466,275}, {466,275}, {466,275}, {466,275}, {466,275},
+    {466,275}, {466,275}, {466,275}, {466,275}, {466,275}, {466,275}, {466,275}, {466,275},
+    {466,275}, {466,275}, {466,275}, {466,275}, {466,275}, {598,56}, {598,56}, {598,56},
+    {598,56}, {613,61}, {613,61}, {613,61}, {613,61}, {613,61}, {613,61}, {613,61},
+    {613,61}, {613,61}, {613,61}, {613,61}, {613,61}, {613,61}, {613,61}, {613,61},
+    {613,61}, {613,61}, {613,61}, {613,61}, {613,61}, {467,275}, {467,275}, {613,61},
+    {613,61}, {613,61}, {613,61}, {613,61}, {613,61}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {613,61}, {613,61}, {613,61}, {467,275}, {613,61}, {467,275},
+    {467,275}, {467,275}, {467,275}, {467,275}, {467,275}, {467,275}, {467,275}, {467,275},
+    {467,275}, {467,275}, {467,275}, {467,275}, {467,275}, {467,275}, {467,275}, {467,275},
+    {467,275}, {467,275}, {467,275}, {467,275}, {467,275}, {467,275}, {467,275}, {467,275},
+    {467,275}, {613,61}, {613,61}, {613,61}, {613,61}, {617,173}, {617,173}, {617,173},
+    {617,173}, {617,173}, {617,173}, {617,173}, {617,173}, {617,173}, {617,173}, {617,173},
+    {617,173}, {617,173}, {617,173}, {617,173}, {617,173}, {617,173}, {617,173}, {617,173},
+    {617,173}, {0,0}, {0,0}, {617,173}, {617,173}, {617,173}, {617,173}, {617,173},
+    {617,173}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {617,173}, {617,173},
+    {617,173}, {0,0}, {617,173}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {617,173}, {617,173}, {617,173},
+    {617,173},
 };
 } // namespace lex
@@ -1,5 +1,6 @@
 #include <cstdint>
 #include <string_view>
+#include "lex_scan.hpp"
 namespace lex
 {
 using token_type_t = std::uint16_t;
@@ -104,120 +105,122 @@ constexpr token_type_t TOK_increment = 97;
 constexpr token_type_t TOK_decrement = 98;
 constexpr token_type_t TOK_asterisk = 99;
 constexpr token_type_t TOK_fslash = 100;
-constexpr token_type_t TOK_plus = 101;
-constexpr token_type_t TOK_minus = 102;
-constexpr token_type_t TOK_rol = 103;
-constexpr token_type_t TOK_ror = 104;
-constexpr token_type_t TOK_ror_flip = 105;
-constexpr token_type_t TOK_lshift = 106;
-constexpr token_type_t TOK_rshift = 107;
-constexpr token_type_t TOK_bitwise_and = 108;
-constexpr token_type_t TOK_bitwise_xor = 109;
-constexpr token_type_t TOK_bitwise_or = 110;
-constexpr token_type_t TOK_lt = 111;
-constexpr token_type_t TOK_lte = 112;
-constexpr token_type_t TOK_gt = 113;
-constexpr token_type_t TOK_gte = 114;
-constexpr token_type_t TOK_eq = 115;
-constexpr token_type_t TOK_not_eq = 116;
-constexpr token_type_t TOK_logical_and = 117;
-constexpr token_type_t TOK_end_logical_and = 118;
-constexpr token_type_t TOK_logical_or = 119;
-constexpr token_type_t TOK_end_logical_or = 120;
-constexpr token_type_t TOK_rol_assign = 121;
-constexpr token_type_t TOK_ror_assign = 122;
-constexpr token_type_t TOK_ror_assign_flip = 123;
-constexpr token_type_t TOK_assign = 124;
-constexpr token_type_t TOK_plus_assign = 125;
-constexpr token_type_t TOK_minus_assign = 126;
-constexpr token_type_t TOK_times_assign = 127;
-constexpr token_type_t TOK_div_assign = 128;
-constexpr token_type_t TOK_bitwise_and_assign = 129;
-constexpr token_type_t TOK_bitwise_or_assign = 130;
-constexpr token_type_t TOK_bitwise_xor_assign = 131;
-constexpr token_type_t TOK_lshift_assign = 132;
-constexpr token_type_t TOK_rshift_assign = 133;
-constexpr token_type_t TOK_rparen = 134;
-constexpr token_type_t TOK_Void = 135;
-constexpr token_type_t TOK_Fn = 136;
-constexpr token_type_t TOK_F = 137;
-constexpr token_type_t TOK_FF = 138;
-constexpr token_type_t TOK_FFF = 139;
-constexpr token_type_t TOK_U = 140;
-constexpr token_type_t TOK_UU = 141;
-constexpr token_type_t TOK_UUU = 142;
-constexpr token_type_t TOK_UF = 143;
-constexpr token_type_t TOK_UUF = 144;
-constexpr token_type_t TOK_UUUF = 145;
-constexpr token_type_t TOK_UFF = 146;
-constexpr token_type_t TOK_UUFF = 147;
-constexpr token_type_t TOK_UUUFF = 148;
-constexpr token_type_t TOK_UFFF = 149;
-constexpr token_type_t TOK_UUFFF = 150;
-constexpr token_type_t TOK_UUUFFF = 151;
-constexpr token_type_t TOK_S = 152;
-constexpr token_type_t TOK_SS = 153;
-constexpr token_type_t TOK_SSS = 154;
-constexpr token_type_t TOK_SF = 155;
-constexpr token_type_t TOK_SSF = 156;
-constexpr token_type_t TOK_SSSF = 157;
-constexpr token_type_t TOK_SFF = 158;
-constexpr token_type_t TOK_SSFF = 159;
-constexpr token_type_t TOK_SSSFF = 160;
-constexpr token_type_t TOK_SFFF = 161;
-constexpr token_type_t TOK_SSFFF = 162;
-constexpr token_type_t TOK_SSSFFF = 163;
-constexpr token_type_t TOK_AA = 164;
-constexpr token_type_t TOK_AAA = 165;
-constexpr token_type_t TOK_PP = 166;
-constexpr token_type_t TOK_PPP = 167;
-constexpr token_type_t TOK_CC = 168;
-constexpr token_type_t TOK_CCC = 169;
-constexpr token_type_t TOK_MM = 170;
-constexpr token_type_t TOK_MMM = 171;
-constexpr token_type_t TOK_Int = 172;
-constexpr token_type_t TOK_Real = 173;
-constexpr token_type_t TOK_Bool = 174;
-constexpr token_type_t TOK_ident = 175;
-constexpr token_type_t TOK_type_ident = 176;
-constexpr token_type_t TOK_decimal = 177;
-constexpr token_type_t TOK_hex = 178;
-constexpr token_type_t TOK_binary = 179;
-constexpr token_type_t TOK_int = 180;
-constexpr token_type_t TOK_real = 181;
-constexpr token_type_t TOK_global_ident = 182;
-constexpr token_type_t TOK_weak_ident = 183;
-constexpr token_type_t TOK_hw_addr = 184;
-constexpr token_type_t TOK_read_hw = 185;
-constexpr token_type_t TOK_write_hw = 186;
-constexpr token_type_t TOK_group_set = 187;
-constexpr token_type_t TOK_rpair = 188;
-constexpr token_type_t TOK_ssa = 189;
-constexpr token_type_t TOK_implicit_cast = 190;
-constexpr token_type_t TOK_shift_atom = 191;
-constexpr token_type_t TOK_replace_atom = 192;
-constexpr token_type_t TOK_write_state = 193;
-constexpr token_type_t TOK_byte_vec = 194;
-constexpr token_type_t TOK_locator_vec = 195;
-constexpr token_type_t TOK_character = 196;
-constexpr token_type_t TOK_string_uncompressed = 197;
-constexpr token_type_t TOK_string_compressed = 198;
-constexpr token_type_t TOK_byte_block_proc = 199;
-constexpr token_type_t TOK_byte_block_data = 200;
-constexpr token_type_t TOK_byte_block_asm_op = 201;
-constexpr token_type_t TOK_byte_block_label = 202;
-constexpr token_type_t TOK_byte_block_call = 203;
-constexpr token_type_t TOK_byte_block_goto = 204;
-constexpr token_type_t TOK_byte_block_goto_mode = 205;
-constexpr token_type_t TOK_byte_block_wait_nmi = 206;
-constexpr token_type_t TOK_byte_block_bank_switch_x = 207;
-constexpr token_type_t TOK_byte_block_bank_switch_y = 208;
-constexpr token_type_t TOK_byte_block_bank_switch_ax = 209;
-constexpr token_type_t TOK_byte_block_bank_switch_ay = 210;
-constexpr token_type_t TOK_byte_block_byte_array = 211;
-constexpr token_type_t TOK_byte_block_locator_array = 212;
-constexpr token_type_t TOK_byte_block_sub_proc = 213;
-constexpr token_type_t TOK_END = 214;
+constexpr token_type_t TOK_percent = 101;
+constexpr token_type_t TOK_plus = 102;
+constexpr token_type_t TOK_minus = 103;
+constexpr token_type_t TOK_rol = 104;
+constexpr token_type_t TOK_ror = 105;
+constexpr token_type_t TOK_ror_flip = 106;
+constexpr token_type_t TOK_lshift = 107;
+constexpr token_type_t TOK_rshift = 108;
+constexpr token_type_t TOK_bitwise_and = 109;
+constexpr token_type_t TOK_bitwise_xor = 110;
+constexpr token_type_t TOK_bitwise_or = 111;
+constexpr token_type_t TOK_lt = 112;
+constexpr token_type_t TOK_lte = 113;
+constexpr token_type_t TOK_gt = 114;
+constexpr token_type_t TOK_gte = 115;
+constexpr token_type_t TOK_eq = 116;
+constexpr token_type_t TOK_not_eq = 117;
+constexpr token_type_t TOK_logical_and = 118;
+constexpr token_type_t TOK_end_logical_and = 119;
+constexpr token_type_t TOK_logical_or = 120;
+constexpr token_type_t TOK_end_logical_or = 121;
+constexpr token_type_t TOK_rol_assign = 122;
+constexpr token_type_t TOK_ror_assign = 123;
+constexpr token_type_t TOK_ror_assign_flip = 124;
+constexpr token_type_t TOK_assign = 125;
+constexpr token_type_t TOK_plus_assign = 126;
+constexpr token_type_t TOK_minus_assign = 127;
+constexpr token_type_t TOK_times_assign = 128;
+constexpr token_type_t TOK_div_assign = 129;
+constexpr token_type_t TOK_mod_assign = 130;
+constexpr token_type_t TOK_bitwise_and_assign = 131;
+constexpr token_type_t TOK_bitwise_or_assign = 132;
+constexpr token_type_t TOK_bitwise_xor_assign = 133;
+constexpr token_type_t TOK_lshift_assign = 134;
+constexpr token_type_t TOK_rshift_assign = 135;
+constexpr token_type_t TOK_rparen = 136;
+constexpr token_type_t TOK_Void = 137;
+constexpr token_type_t TOK_Fn = 138;
+constexpr token_type_t TOK_F = 139;
+constexpr token_type_t TOK_FF = 140;
+constexpr token_type_t TOK_FFF = 141;
+constexpr token_type_t TOK_U = 142;
+constexpr token_type_t TOK_UU = 143;
+constexpr token_type_t TOK_UUU = 144;
+constexpr token_type_t TOK_UF = 145;
+constexpr token_type_t TOK_UUF = 146;
+constexpr token_type_t TOK_UUUF = 147;
+constexpr token_type_t TOK_UFF = 148;
+constexpr token_type_t TOK_UUFF = 149;
+constexpr token_type_t TOK_UUUFF = 150;
+constexpr token_type_t TOK_UFFF = 151;
+constexpr token_type_t TOK_UUFFF = 152;
+constexpr token_type_t TOK_UUUFFF = 153;
+constexpr token_type_t TOK_S = 154;
+constexpr token_type_t TOK_SS = 155;
+constexpr token_type_t TOK_SSS = 156;
+constexpr token_type_t TOK_SF = 157;
+constexpr token_type_t TOK_SSF = 158;
+constexpr token_type_t TOK_SSSF = 159;
+constexpr token_type_t TOK_SFF = 160;
+constexpr token_type_t TOK_SSFF = 161;
+constexpr token_type_t TOK_SSSFF = 162;
+constexpr token_type_t TOK_SFFF = 163;
+constexpr token_type_t TOK_SSFFF = 164;
+constexpr token_type_t TOK_SSSFFF = 165;
+constexpr token_type_t TOK_AA = 166;
+constexpr token_type_t TOK_AAA = 167;
+constexpr token_type_t TOK_PP = 168;
+constexpr token_type_t TOK_PPP = 169;
+constexpr token_type_t TOK_CC = 170;
+constexpr token_type_t TOK_CCC = 171;
+constexpr token_type_t TOK_MM = 172;
+constexpr token_type_t TOK_MMM = 173;
+constexpr token_type_t TOK_Int = 174;
+constexpr token_type_t TOK_Real = 175;
+constexpr token_type_t TOK_Bool = 176;
+constexpr token_type_t TOK_ident = 177;
+constexpr token_type_t TOK_type_ident = 178;
+constexpr token_type_t TOK_decimal = 179;
+constexpr token_type_t TOK_hex = 180;
+constexpr token_type_t TOK_binary = 181;
+constexpr token_type_t TOK_int = 182;
+constexpr token_type_t TOK_real = 183;
+constexpr token_type_t TOK_global_ident = 184;
+constexpr token_type_t TOK_weak_ident = 185;
+constexpr token_type_t TOK_hw_addr = 186;
+constexpr token_type_t TOK_read_hw = 187;
+constexpr token_type_t TOK_write_hw = 188;
+constexpr token_type_t TOK_group_set = 189;
+constexpr token_type_t TOK_rpair = 190;
+constexpr token_type_t TOK_ssa = 191;
+constexpr token_type_t TOK_implicit_cast = 192;
+constexpr token_type_t TOK_shift_atom = 193;
+constexpr token_type_t TOK_replace_atom = 194;
+constexpr token_type_t TOK_write_state = 195;
+constexpr token_type_t TOK_byte_vec = 196;
+constexpr token_type_t TOK_locator_vec = 197;
+constexpr token_type_t TOK_character = 198;
+constexpr token_type_t TOK_string_uncompressed = 199;
+constexpr token_type_t TOK_string_compressed = 200;
+constexpr token_type_t TOK_byte_block_proc = 201;
+constexpr token_type_t TOK_byte_block_data = 202;
+constexpr token_type_t TOK_byte_block_asm_op = 203;
+constexpr token_type_t TOK_byte_block_label = 204;
+constexpr token_type_t TOK_byte_block_call = 205;
+constexpr token_type_t TOK_byte_block_goto = 206;
+constexpr token_type_t TOK_byte_block_goto_mode = 207;
+constexpr token_type_t TOK_byte_block_wait_nmi = 208;
+constexpr token_type_t TOK_byte_block_bank_switch_x = 209;
+constexpr token_type_t TOK_byte_block_bank_switch_y = 210;
+constexpr token_type_t TOK_byte_block_bank_switch_ax = 211;
+constexpr token_type_t TOK_byte_block_bank_switch_ay = 212;
+constexpr token_type_t TOK_byte_block_byte_array = 213;
+constexpr token_type_t TOK_byte_block_locator_array = 214;
+constexpr token_type_t TOK_byte_block_sub_proc = 215;
+constexpr token_type_t TOK_END = 216;
 inline std::string_view token_name(token_type_t type)
 {
     using namespace std::literals;
@@ -324,6 +327,7 @@ inline std::string_view token_name(token_type_t type)
     case TOK_decrement: return "decrement"sv;
     case TOK_asterisk: return "asterisk"sv;
     case TOK_fslash: return "fslash"sv;
+    case TOK_percent: return "percent"sv;
     case TOK_plus: return "plus"sv;
     case TOK_minus: return "minus"sv;
     case TOK_rol: return "rol"sv;
@@ -352,6 +356,7 @@ inline std::string_view token_name(token_type_t type)
     case TOK_minus_assign: return "minus_assign"sv;
     case TOK_times_assign: return "times_assign"sv;
     case TOK_div_assign: return "div_assign"sv;
+    case TOK_mod_assign: return "mod_assign"sv;
     case TOK_bitwise_and_assign: return "bitwise_and_assign"sv;
     case TOK_bitwise_or_assign: return "bitwise_or_assign"sv;
     case TOK_bitwise_xor_assign: return "bitwise_xor_assign"sv;
@@ -545,6 +550,7 @@ inline std::string_view token_string(token_type_t type)
     case TOK_decrement: return "--"sv;
     case TOK_asterisk: return "*"sv;
     case TOK_fslash: return "/"sv;
+    case TOK_percent: return "%"sv;
     case TOK_plus: return "+"sv;
     case TOK_minus: return "-"sv;
     case TOK_rol: return "<-<"sv;
@@ -573,6 +579,7 @@ inline std::string_view token_string(token_type_t type)
     case TOK_minus_assign: return "-="sv;
     case TOK_times_assign: return "*="sv;
     case TOK_div_assign: return "/="sv;
+    case TOK_mod_assign: return "%="sv;
     case TOK_bitwise_and_assign: return "&="sv;
     case TOK_bitwise_or_assign: return "|="sv;
     case TOK_bitwise_xor_assign: return "^="sv;
@@ -763,6 +770,7 @@ constexpr unsigned char token_precedence_table[] =
     8,
     10,
     10,
+    10,
     11,
     11,
     12,
@@ -796,6 +804,7 @@ constexpr unsigned char token_precedence_table[] =
     158,
     158,
     158,
+    158,
     1,
     0,
     0,
@@ -983,6 +992,7 @@ constexpr bool token_right_assoc_table[] =
     0,
     0,
     0,
+    0,
     1,
     0,
     0,
@@ -1013,6 +1023,7 @@ constexpr bool token_right_assoc_table[] =
     1,
     1,
     1,
+    1,
     0,
     0,
     0,
@@ -1188,6 +1199,7 @@ constexpr bool token_right_assoc_table[] =
     case TOK_decrement:\
     case TOK_asterisk:\
     case TOK_fslash:\
+    case TOK_percent:\
     case TOK_plus:\
     case TOK_minus:\
     case TOK_rol:\
@@ -1216,6 +1228,7 @@ constexpr bool token_right_assoc_table[] =
     case TOK_minus_assign:\
     case TOK_times_assign:\
     case TOK_div_assign:\
+    case TOK_mod_assign:\
     case TOK_bitwise_and_assign:\
     case TOK_bitwise_or_assign:\
     case TOK_bitwise_xor_assign:\
@@ -1223,8 +1236,26 @@ constexpr bool token_right_assoc_table[] =
     case TOK_rshift_assign:\
     case TOK_rparen:\
 
-constexpr token_type_t TOK_LAST_STATE = 213;
-constexpr token_type_t TOK_START = 215;
-extern unsigned const lexer_ec_table[256];
-extern token_type_t const lexer_transition_table[52752];
+constexpr token_type_t TOK_LAST_STATE = 215;
+constexpr token_type_t TOK_START = 217;
+struct lexer_row_t { std::uint16_t base; token_type_t fallback; token_type_t parent; std::uint8_t loop; };
+struct lexer_comb_t { token_type_t check; token_type_t next; };
+extern std::uint8_t const lexer_ec_table[256];
+extern lexer_row_t const lexer_row_table[631];
+extern lexer_comb_t const lexer_comb_table[4809];
+inline token_type_t lexer_transition(token_type_t state, unsigned char c)
+{
+    unsigned const ec = lexer_ec_table[c];
+    lexer_row_t const* row = &lexer_row_table[state];
+    lexer_comb_t comb = lexer_comb_table[row->base + ec];
+    if(comb.check != state && row->parent)
+    {
+        state = row->parent;
+        row = &lexer_row_table[state];
+        comb = lexer_comb_table[row->base + ec];
+    }
+    // Written as a select, as the branch is unpredictable:
+    return comb.check == state ? comb.next : row->fallback;
+}
+inline lex_loop_t lexer_loop(token_type_t state) { return lex_loop_t(lexer_row_table[state].loop); }
 } // namespace lex
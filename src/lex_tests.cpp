@@ -0,0 +1,137 @@
+#include "catch/catch.hpp"
+#include "lex_tables.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace lex;
+namespace fs = ::std::filesystem;
+
+namespace
+{
+    // Reads the '.fab' sources the compiler ships with.
+    // The tests run from the repository's root directory.
+    std::vector<std::string> read_sources()
+    {
+        std::vector<std::string> sources;
+        for(char const* dir : { "lib", "examples" })
+        {
+            if(!fs::is_directory(dir))
+                continue;
+
+            for(auto const& entry : fs::recursive_directory_iterator(dir))
+            {
+                if(!entry.is_regular_file() || entry.path().extension() != ".fab")
+                    continue;
+
+                std::ifstream stream(entry.path(), std::ios::binary);
+                sources.emplace_back(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+            }
+        }
+        return sources;
+    }
+
+    // Lexes every token of 'source', the way 'parser_t::parse_token' does.
+    // Characters that fail to lex are skipped.
+    template<bool Scan>
+    void lex_all(char const* source, std::vector<token_type_t>& tokens)
+    {
+        char const* next_char = source;
+        while(true)
+        {
+            char const* const token_source = next_char;
+            token_type_t lexed = TOK_START;
+            while(lexed > TOK_LAST_STATE)
+            {
+                lexed = lexer_transition(lexed, *next_char);
+                ++next_char;
+
+                if constexpr(Scan)
+                    if(lex_loop_t const loop = lexer_loop(lexed))
+                        next_char = lex_scan(next_char, loop);
+            }
+            --next_char;
+
+            if(lexed == TOK_eof)
+                return;
+
+            if(next_char == token_source)
+                ++next_char;
+
+            tokens.push_back(lexed);
+            tokens.push_back(next_char - token_source);
+        }
+    }
+}
+
+TEST_CASE("lex_scan", "[lex]")
+{
+    // Compare against the scalar definition:
+    for(unsigned iter = 0; iter < 1000; ++iter)
+    {
+        std::string str(rand() % 64, ' ');
+        for(char& c : str)
+            c = "aZ_09 \n\r/*\x80"[rand() % 12];
+
+        for(unsigned loop = LEX_LOOP_NONE + 1; loop < NUM_LEX_LOOPS; ++loop)
+        for(unsigned i = 0; i <= str.size(); ++i)
+        {
+            char const* expected = str.c_str() + i;
+            while(lex_loop_contains(lex_loop_t(loop), *expected))
+                ++expected;
+            REQUIRE(lex_scan(str.c_str() + i, lex_loop_t(loop)) == expected);
+        }
+    }
+}
+
+TEST_CASE("lex_scan_tokens", "[lex]")
+{
+    // Skipping runs must not change the tokens:
+    std::vector<token_type_t> plain, scanned;
+    for(std::string const& source : read_sources())
+    {
+        plain.clear();
+        scanned.clear();
+        lex_all<false>(source.c_str(), plain);
+        lex_all<true>(source.c_str(), scanned);
+        REQUIRE(plain == scanned);
+    }
+}
+
+TEST_CASE("lex_benchmark", "[.][benchmark]")
+{
+    std::vector<std::string> const sources = read_sources();
+
+    std::size_t bytes = 0;
+    for(std::string const& source : sources)
+        bytes += source.size();
+    REQUIRE(bytes > 0);
+
+    constexpr unsigned ITER = 20;
+    std::vector<token_type_t> tokens;
+
+    auto const run = [&](char const* name, auto const& lex)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        for(unsigned i = 0; i < ITER; ++i)
+        {
+            for(std::string const& source : sources)
+            {
+                tokens.clear();
+                lex(source.c_str());
+            }
+        }
+        std::chrono::duration<double> const seconds = std::chrono::steady_clock::now() - start;
+        std::cout << name << ": " << (bytes * ITER / seconds.count() / 1e6) << " MB/s" << std::endl;
+    };
+
+    std::cout << sources.size() << " files, " << bytes << " bytes" << std::endl;
+    run("table only", [&](char const* source) { lex_all<false>(source, tokens); });
+    run("table and scan", [&](char const* source) { lex_all<true>(source, tokens); });
+}
@@ -13,6 +13,8 @@
 #include <unordered_set>
 #include <vector>
 
+#include "lex_scan.hpp"
+
 #include "flat/flat_map.hpp"
 #include "flat/flat_multimap.hpp"
 #include "flat/flat_set.hpp"
@@ -384,6 +386,7 @@ void print_output(dfa_t const& dfa, fc::vector_set<dfa_set_t> const& mini, char
     std::vector<dfa_set_t const*> node_vector;
     std::fprintf(hpp, "#include <cstdint>\n");
     std::fprintf(hpp, "#include <string_view>\n");
+    std::fprintf(hpp, "#include \"lex_scan.hpp\"\n");
     std::fprintf(hpp, "namespace %s\n{\n", name_space);
     std::fprintf(hpp, "using token_type_t = std::uint16_t;\n");
     std::fprintf(hpp, "constexpr token_type_t TOK_ERROR = 0;\n");
@@ -458,12 +461,13 @@ void print_output(dfa_t const& dfa, fc::vector_set<dfa_set_t> const& mini, char
         if(nodes.emplace(&s, nodes.size()).second)
             node_vector.push_back(&s);
 
+    unsigned start = 0;
     for(dfa_set_t const& s : mini)
     for(dfa_node_t const* np : s)
     {
         if(np == dfa.first)
         {
-            std::fprintf(hpp, "constexpr token_type_t TOK_START = %u;\n", nodes[&s]);
+            start = nodes[&s];
             goto exit_loop;
         }
     }
@@ -522,20 +526,17 @@ exit_loop:
     {
         if(char_ec.container[j].count(i))
         {
-            ec_table[i] = j * node_vector.size();
+            ec_table[i] = j;
             break;
         }
     }
 
-    std::fprintf(cpp, "#include \"%s_tables.hpp\"\n", name_space);
-    std::fprintf(cpp, "namespace %s\n{\n", name_space);
-    std::fprintf(cpp, "extern unsigned const lexer_ec_table[256] = {");
-    for(unsigned i = 0 ; i != 256; ++i)
-        std::fprintf(cpp, "%s%i,", i % 16 == 0 ? "\n    " : " ", ec_table[i]);
-    std::fprintf(cpp, "\n};\n");
+    unsigned const num_ec = char_ec.size();
+    assert(num_ec <= 256);
 
-    std::vector<unsigned> ttable(char_ec.size() * node_vector.size(), 0);
-    for(unsigned i = 0; i < char_ec.size(); ++i)
+    // The dense transition table, indexed by [ec * node_vector.size() + state].
+    std::vector<unsigned> ttable(num_ec * node_vector.size(), 0);
+    for(unsigned i = 0; i < num_ec; ++i)
     {
         for(unsigned j = 0; j < node_vector.size(); ++j)
         {
@@ -563,15 +564,233 @@ exit_loop:
         assigned:;
         }
     }
-    assert(ttable.size() < 65536);
 
-    std::fprintf(cpp, "extern token_type_t const lexer_transition_table[%u] = {\n", (unsigned)ttable.size());
-    for(unsigned i = 0; i < ttable.size(); ++i)
-        std::fprintf(cpp, "%s%i,", i % 16 == 0 ? "\n    " : " ", ttable[i]);
+    // Minimize the final table with Moore's algorithm.
+    // Token states stay distinct, while every other state starts in one partition.
+    unsigned const last_state = names.size();
+    unsigned const num_states = node_vector.size();
+    std::vector<unsigned> partition(num_states);
+    for(unsigned j = 0; j < num_states; ++j)
+        partition[j] = std::min(j, last_state + 1);
+
+    while(true)
+    {
+        std::map<std::vector<unsigned>, unsigned> signatures;
+        std::vector<unsigned> next_partition(num_states);
+        for(unsigned j = 0; j < num_states; ++j)
+        {
+            if(j <= last_state)
+            {
+                next_partition[j] = j;
+                continue;
+            }
+
+            std::vector<unsigned> signature = { partition[j] };
+            for(unsigned i = 0; i < num_ec; ++i)
+                signature.push_back(partition[ttable[i*num_states+j]]);
+
+            auto result = signatures.emplace(std::move(signature), last_state + 1 + signatures.size());
+            next_partition[j] = result.first->second;
+        }
+
+        bool const done = next_partition == partition;
+        partition = std::move(next_partition);
+        if(done)
+            break;
+    }
+
+    // Renumber the states, keeping the first of each partition:
+    std::vector<unsigned> renumber(num_states, -1u);
+    std::vector<unsigned> kept;
+    std::map<unsigned, unsigned> partition_state;
+    for(unsigned j = 0; j < num_states; ++j)
+    {
+        auto result = partition_state.emplace(partition[j], kept.size());
+        if(result.second)
+            kept.push_back(j);
+        renumber[j] = result.first->second;
+    }
+
+    for(unsigned j = 0; j <= last_state; ++j)
+        assert(renumber[j] == j);
+
+    std::fprintf(hpp, "constexpr token_type_t TOK_START = %u;\n", renumber[start]);
+
+    unsigned const num_kept = kept.size();
+    std::vector<unsigned> mtable(num_ec * num_kept, 0);
+    for(unsigned i = 0; i < num_ec; ++i)
+    for(unsigned j = 0; j < num_kept; ++j)
+        mtable[i*num_kept+j] = renumber[ttable[i*num_states+kept[j]]];
+
+    // Find which states loop over a set 'lex_scan' can skip:
+    std::vector<lex_loop_t> loops(num_kept, LEX_LOOP_NONE);
+    for(unsigned j = last_state + 1; j < num_kept; ++j)
+    {
+        for(unsigned loop = LEX_LOOP_NONE + 1; loop < NUM_LEX_LOOPS; ++loop)
+        {
+            bool match = true;
+            for(unsigned c = 0; c < 256; ++c)
+                match &= (mtable[ec_table[c]*num_kept+j] == j) == lex_loop_contains(lex_loop_t(loop), c);
+
+            if(match)
+            {
+                loops[j] = lex_loop_t(loop);
+                break;
+            }
+        }
+    }
+
+    // Compress the table into a comb (row displacement) layout.
+    // Each row stores only the entries that differ from its most common entry,
+    // and rows are overlapped wherever their entries don't collide.
+    // Lookups check that the entry belongs to the row, or else use the fallback.
+    // Token states never transition, so they get no rows.
+    std::vector<unsigned> fallbacks(num_kept, 0);
+    std::vector<unsigned> bases(num_kept, 0);
+    std::vector<std::vector<unsigned>> row_entries(num_kept);
+    for(unsigned j = last_state + 1; j < num_kept; ++j)
+    {
+        std::map<unsigned, unsigned> counts;
+        for(unsigned i = 0; i < num_ec; ++i)
+            counts[mtable[i*num_kept+j]] += 1;
+        fallbacks[j] = std::max_element(counts.begin(), counts.end(), 
+            [](auto const& a, auto const& b) { return a.second < b.second; })->first;
+
+        for(unsigned i = 0; i < num_ec; ++i)
+            if(mtable[i*num_kept+j] != fallbacks[j])
+                row_entries[j].push_back(i);
+    }
+
+    // Rows that mostly match another row (like keyword prefixes matching identifiers)
+    // can instead store their differences from it, and fall back to that row.
+    // Rows used this way can't fall back to a row themselves, so lookups probe at most twice.
+    std::vector<unsigned> parents(num_kept, 0);
+    std::vector<bool> is_parent(num_kept, false);
+    for(unsigned j = last_state + 1; j < num_kept; ++j)
+    {
+        if(is_parent[j])
+            continue;
+
+        unsigned best_parent = 0;
+        unsigned best_size = row_entries[j].size();
+        for(unsigned t = last_state + 1; t < num_kept; ++t)
+        {
+            if(t == j || parents[t])
+                continue;
+
+            unsigned size = 0;
+            for(unsigned i = 0; i < num_ec; ++i)
+                size += mtable[i*num_kept+j] != mtable[i*num_kept+t];
+
+            if(size < best_size)
+            {
+                best_parent = t;
+                best_size = size;
+            }
+        }
+
+        if(best_parent)
+        {
+            parents[j] = best_parent;
+            is_parent[best_parent] = true;
+            fallbacks[j] = fallbacks[best_parent];
+
+            row_entries[j].clear();
+            for(unsigned i = 0; i < num_ec; ++i)
+                if(mtable[i*num_kept+j] != mtable[i*num_kept+best_parent])
+                    row_entries[j].push_back(i);
+        }
+    }
+
+    std::vector<unsigned> row_order;
+    for(unsigned j = last_state + 1; j < num_kept; ++j)
+        row_order.push_back(j);
+    std::stable_sort(row_order.begin(), row_order.end(), [&](unsigned a, unsigned b)
+        { return row_entries[a].size() > row_entries[b].size(); });
+
+    // State 0 is TOK_ERROR, which has no row, so it marks unused entries.
+    std::vector<unsigned> comb_check;
+    std::vector<unsigned> comb_next;
+    for(unsigned j : row_order)
+    {
+        unsigned base = 0;
+        for(;; ++base)
+        {
+            for(unsigned i : row_entries[j])
+                if(base + i < comb_check.size() && comb_check[base + i] != 0)
+                    goto next_base;
+            break;
+        next_base:;
+        }
+
+        bases[j] = base;
+        comb_check.resize(std::max<std::size_t>(comb_check.size(), base + num_ec), 0);
+        comb_next.resize(comb_check.size(), 0);
+        for(unsigned i : row_entries[j])
+        {
+            comb_check[base + i] = j;
+            comb_next[base + i] = mtable[i*num_kept+j];
+        }
+    }
+
+    assert(comb_check.size() < 65536);
+    assert(num_kept < 65536);
+
+    // Verify the comb against the dense table:
+    for(unsigned j = last_state + 1; j < num_kept; ++j)
+    for(unsigned i = 0; i < num_ec; ++i)
+    {
+        unsigned state = j;
+        unsigned index = bases[state] + i;
+        if(comb_check[index] != state && parents[state])
+        {
+            state = parents[state];
+            index = bases[state] + i;
+        }
+        unsigned const next = comb_check[index] == state ? comb_next[index] : fallbacks[state];
+        assert(next == mtable[i*num_kept+j]);
+    }
+
+    std::fprintf(cpp, "#include \"%s_tables.hpp\"\n", name_space);
+    std::fprintf(cpp, "namespace %s\n{\n", name_space);
+    std::fprintf(cpp, "// %u states, %u character classes, %u comb entries (%u dense)\n", 
+                 num_kept, num_ec, (unsigned)comb_check.size(), num_ec * num_kept);
+
+    std::fprintf(cpp, "extern std::uint8_t const lexer_ec_table[256] = {");
+    for(unsigned i = 0 ; i != 256; ++i)
+        std::fprintf(cpp, "%s%i,", i % 16 == 0 ? "\n    " : " ", ec_table[i]);
+    std::fprintf(cpp, "\n};\n");
+
+    std::fprintf(cpp, "extern lexer_row_t const lexer_row_table[%u] = {", num_kept);
+    for(unsigned j = 0; j < num_kept; ++j)
+        std::fprintf(cpp, "%s{%u,%u,%u,%u},", j % 8 == 0 ? "\n    " : " ", bases[j], fallbacks[j], parents[j], unsigned(loops[j]));
+    std::fprintf(cpp, "\n};\n");
+
+    std::fprintf(cpp, "extern lexer_comb_t const lexer_comb_table[%u] = {", (unsigned)comb_check.size());
+    for(unsigned i = 0; i < comb_check.size(); ++i)
+        std::fprintf(cpp, "%s{%u,%u},", i % 8 == 0 ? "\n    " : " ", comb_check[i], comb_next[i]);
     std::fprintf(cpp, "\n};\n");
 
-    std::fprintf(hpp, "extern unsigned const lexer_ec_table[256];\n");
-    std::fprintf(hpp, "extern token_type_t const lexer_transition_table[%u];\n", (unsigned)ttable.size());
+    std::fprintf(hpp, "struct lexer_row_t { std::uint16_t base; token_type_t fallback; token_type_t parent; std::uint8_t loop; };\n");
+    std::fprintf(hpp, "struct lexer_comb_t { token_type_t check; token_type_t next; };\n");
+    std::fprintf(hpp, "extern std::uint8_t const lexer_ec_table[256];\n");
+    std::fprintf(hpp, "extern lexer_row_t const lexer_row_table[%u];\n", num_kept);
+    std::fprintf(hpp, "extern lexer_comb_t const lexer_comb_table[%u];\n", (unsigned)comb_check.size());
+
+    std::fprintf(hpp, "inline token_type_t lexer_transition(token_type_t state, unsigned char c)\n{\n");
+    std::fprintf(hpp, "    unsigned const ec = lexer_ec_table[c];\n");
+    std::fprintf(hpp, "    lexer_row_t const* row = &lexer_row_table[state];\n");
+    std::fprintf(hpp, "    lexer_comb_t comb = lexer_comb_table[row->base + ec];\n");
+    std::fprintf(hpp, "    if(comb.check != state && row->parent)\n");
+    std::fprintf(hpp, "    {\n");
+    std::fprintf(hpp, "        state = row->parent;\n");
+    std::fprintf(hpp, "        row = &lexer_row_table[state];\n");
+    std::fprintf(hpp, "        comb = lexer_comb_table[row->base + ec];\n");
+    std::fprintf(hpp, "    }\n");
+    std::fprintf(hpp, "    // Written as a select, as the branch is unpredictable:\n");
+    std::fprintf(hpp, "    return comb.check == state ? comb.next : row->fallback;\n");
+    std::fprintf(hpp, "}\n");
+    std::fprintf(hpp, "inline lex_loop_t lexer_loop(token_type_t state) { return lex_loop_t(lexer_row_table[state].loop); }\n");
 
     std::fprintf(hpp, "} // namespace %s\n", name_space);
     std::fprintf(cpp, "} // namespace %s\n", name_space);
@@ -746,6 +965,7 @@ int main()
 
         op(10, "asterisk", "*"),
         op(10, "fslash", "/"),
+        op(10, "percent", "%"),
 
         op(11, "plus", "+"),
         op(11, "minus", "-"),
@@ -782,6 +1002,7 @@ int main()
         op(30 | RIGHT_ASSOC, "minus_assign", "-="),
         op(30 | RIGHT_ASSOC, "times_assign", "*="),
         op(30 | RIGHT_ASSOC, "div_assign", "/="),
+        op(30 | RIGHT_ASSOC, "mod_assign", "%="),
         op(30 | RIGHT_ASSOC, "bitwise_and_assign", "&="),
         //op(30 | RIGHT_ASSOC, "logical_and_assign", "&&="),
         op(30 | RIGHT_ASSOC, "bitwise_or_assign", "|="),
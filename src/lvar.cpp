@@ -102,6 +102,10 @@ lvars_manager_t::lvars_manager_t(fn_ht fn, asm_graph_t const& graph)
     // Also add every argument / return that has been referenced:
     fn->for_each_referenced_locator([&](locator_t loc){ insert_this_lvar(loc); });
 
+    // Arguments / returns passed in registers keep their memory,
+    // as callers fall back to it when they can't forward a register:
+    fn->reg_conv().for_each_locator([&](locator_t loc){ insert_this_lvar(loc); });
+
     m_num_this_lvars = m_map.size();
     assert(m_this_lvar_info.size() == m_map.size());
 
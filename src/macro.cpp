@@ -18,9 +18,12 @@ static token_type_t do_lex(char const*& str)
     for(; lexed > TOK_LAST_STATE; ++str)
     {
         unsigned char const c = *str;
-        lexed = lexer_transition_table[lexed + lexer_ec_table[c]];
+        lexed = lexer_transition(lexed, c);
         if(!c)
             break;
+
+        if(lex_loop_t const loop = lexer_loop(lexed))
+            str = lex_scan(str + 1, loop) - 1;
     }
     --str;
     if(lexed == TOK_ERROR)
@@ -1,86 +1,47 @@
 #include "macro_lex_tables.hpp"
 namespace macro_lex
 {
-extern unsigned const lexer_ec_table[256] = {
-    0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 122, 61, 61, 183, 61, 61,
-    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-    61, 61, 244, 305, 61, 61, 61, 366, 61, 61, 427, 61, 61, 488, 61, 549,
-    610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 671, 61, 61, 732, 61, 61,
-    61, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793,
-    793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 61, 61, 61, 61, 610,
-    854, 915, 915, 915, 915, 915, 915, 915, 915, 915, 915, 915, 915, 915, 915, 915,
-    915, 915, 915, 915, 915, 915, 915, 915, 915, 915, 915, 61, 61, 61, 61, 61,
-    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+// 61 states, 16 character classes, 94 comb entries (976 dense)
+extern std::uint8_t const lexer_ec_table[256] = {
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 3, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 4, 5, 1, 1, 1, 6, 1, 1, 7, 1, 1, 8, 1, 9,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 1, 1, 12, 1, 1,
+    1, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 1, 1, 1, 1, 10,
+    14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
 };
-extern token_type_t const lexer_transition_table[976] = {
-
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 7, 0, 49, 22, 0, 0, 33, 0, 0, 0, 0, 0, 5,
-    5, 1, 3, 0, 4, 0, 2, 0, 0, 0, 11, 0, 0, 0, 12, 13,
-    0, 5, 22, 6, 0, 0, 8, 0, 0, 9, 0, 0, 10, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    7, 0, 21, 22, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 1, 3,
-    0, 4, 0, 2, 0, 0, 0, 11, 0, 0, 0, 12, 13, 0, 5, 22,
-    6, 0, 0, 8, 0, 0, 9, 0, 0, 10, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 31,
-    22, 0, 0, 0, 0, 0, 0, 0, 0, 5, 49, 1, 3, 0, 4, 0,
-    2, 0, 0, 0, 11, 0, 0, 0, 12, 13, 0, 5, 22, 6, 0, 0,
-    8, 0, 0, 9, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 32, 22, 0, 0,
-    0, 0, 0, 0, 0, 0, 49, 5, 1, 3, 0, 4, 0, 2, 0, 0,
-    0, 11, 0, 0, 0, 12, 13, 0, 5, 22, 6, 0, 0, 8, 0, 0,
-    9, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 7, 0, 21, 22, 0, 0, 34, 0, 53,
-    53, 0, 0, 5, 5, 1, 3, 20, 4, 0, 2, 0, 0, 0, 11, 0,
-    0, 0, 12, 13, 0, 5, 22, 6, 0, 0, 8, 0, 0, 9, 0, 0,
-    10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    19, 0, 19, 0, 7, 0, 21, 22, 47, 0, 35, 0, 0, 0, 0, 0,
-    5, 5, 1, 3, 0, 4, 0, 2, 0, 0, 42, 11, 0, 0, 46, 12,
-    13, 0, 5, 22, 6, 0, 54, 8, 0, 57, 9, 0, 60, 10, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 7, 0, 21, 22, 0, 0, 36, 0, 0, 0, 0, 0, 5, 5, 1,
-    3, 18, 4, 0, 2, 0, 0, 0, 11, 0, 0, 0, 12, 13, 0, 5,
-    22, 6, 56, 0, 8, 56, 0, 9, 0, 0, 10, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0,
-    21, 50, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 1, 3, 0, 4,
-    22, 2, 0, 0, 0, 11, 0, 0, 0, 12, 13, 0, 5, 22, 6, 0,
-    0, 8, 0, 0, 9, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 21, 22, 0,
-    0, 0, 0, 0, 0, 0, 0, 5, 5, 1, 3, 29, 4, 0, 2, 41,
-    41, 0, 11, 0, 0, 0, 12, 13, 0, 5, 22, 6, 0, 0, 8, 0,
-    0, 9, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 21, 22, 0, 0, 37, 0,
-    0, 0, 0, 0, 5, 5, 1, 3, 0, 4, 21, 2, 0, 0, 0, 11,
-    0, 0, 0, 12, 13, 0, 5, 51, 6, 0, 0, 8, 0, 0, 9, 0,
-    0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    14, 15, 0, 17, 0, 7, 0, 21, 22, 0, 24, 0, 0, 27, 28, 0,
-    0, 5, 5, 1, 3, 0, 4, 0, 2, 39, 40, 0, 11, 43, 44, 0,
-    12, 13, 48, 5, 22, 6, 52, 0, 8, 55, 0, 9, 58, 0, 10, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0,
-    0, 0, 7, 0, 21, 22, 0, 23, 0, 0, 0, 0, 0, 0, 5, 5,
-    1, 3, 30, 4, 0, 2, 0, 0, 0, 11, 0, 0, 0, 12, 13, 0,
-    5, 22, 6, 0, 0, 8, 0, 0, 9, 0, 0, 10, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
-    0, 21, 22, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 1, 3, 26,
-    4, 0, 2, 0, 0, 0, 11, 45, 45, 0, 12, 13, 0, 5, 22, 6,
-    0, 0, 8, 0, 0, 9, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 14, 15, 48, 0, 52, 7, 27, 21, 22,
-    0, 0, 0, 43, 27, 0, 39, 14, 5, 5, 1, 3, 15, 4, 0, 2,
-    39, 0, 0, 11, 43, 0, 0, 12, 13, 48, 5, 22, 6, 52, 0, 8,
-    0, 0, 9, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 21, 22, 0, 0, 38,
-    0, 0, 0, 0, 0, 5, 5, 1, 3, 16, 4, 0, 2, 0, 0, 0,
-    11, 0, 0, 0, 12, 13, 59, 5, 22, 6, 0, 0, 8, 0, 0, 9,
-    59, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 58, 17, 55, 7, 28, 21, 22, 0, 24, 0, 44, 0, 28,
-    40, 24, 5, 5, 1, 3, 17, 4, 0, 2, 0, 40, 0, 11, 0, 44,
-    0, 12, 13, 0, 5, 22, 6, 0, 0, 8, 55, 0, 9, 58, 0, 10,
+extern lexer_row_t const lexer_row_table[61] = {
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0},
+    {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,0,0,0}, {0,14,0,2}, {13,0,0,5},
+    {18,0,0,4}, {22,0,0,4}, {0,5,0,0}, {2,5,0,0}, {8,5,0,0}, {0,4,0,0}, {38,22,0,0}, {4,0,0,0},
+    {24,0,0,4}, {0,1,0,0}, {26,0,0,4}, {0,0,0,0}, {0,3,0,0}, {51,22,0,0}, {30,0,0,5}, {16,0,0,0},
+    {36,0,0,4}, {0,0,0,0}, {0,2,0,0}, {0,6,0,0}, {16,0,0,0}, {54,0,0,0}, {60,0,0,0}, {61,0,0,0},
+    {64,0,0,0}, {0,7,0,0}, {61,0,0,0}, {0,12,0,0}, {37,0,0,5}, {73,0,0,0}, {0,13,0,0}, {44,0,0,5},
+    {75,0,0,0}, {0,11,0,0}, {43,0,0,5}, {76,0,0,0}, {0,9,0,0}, {51,0,0,5}, {55,0,0,4}, {77,0,0,0},
+    {0,8,0,0}, {48,0,0,4}, {58,0,0,5}, {78,0,0,0}, {0,10,0,0},
+};
+extern lexer_comb_t const lexer_comb_table[94] = {
+    {14,18}, {0,0}, {14,19}, {14,20}, {27,36}, {19,18}, {27,37}, {33,22},
+    {27,38}, {33,14}, {20,18}, {27,39}, {27,40}, {27,15}, {27,23}, {27,17},
+    {31,25}, {23,58}, {15,41}, {23,57}, {31,28}, {31,27}, {31,21}, {15,15},
+    {16,51}, {31,33}, {15,15}, {17,41}, {16,16}, {36,53}, {31,34}, {36,54},
+    {17,17}, {16,16}, {24,24}, {24,45}, {26,26}, {17,17}, {26,42}, {24,24},
+    {30,30}, {26,26}, {30,42}, {30,30}, {32,48}, {22,29}, {32,32}, {44,44},
+    {44,45}, {50,51}, {44,44}, {32,32}, {47,48}, {50,50}, {47,47}, {53,55},
+    {50,50}, {47,47}, {57,57}, {54,55}, {29,35}, {53,53}, {57,59}, {57,57},
+    {53,53}, {54,54}, {42,43}, {37,50}, {58,58}, {37,16}, {54,54}, {58,58},
+    {58,59}, {38,47}, {39,44}, {38,32}, {39,24}, {40,30}, {45,46}, {40,26},
+    {48,49}, {51,52}, {55,56}, {59,60}, {0,0}, {0,0}, {0,0}, {0,0},
+    {0,0}, {0,0}, {0,0}, {0,0}, {0,0}, {0,0},
 };
 } // namespace macro_lex
@@ -21,6 +21,10 @@
 #include "rom_link.hpp"
 #include "ram_init.hpp"
 #include "cg_isel.hpp"
+#include "cg_cset.hpp"
+#include "cg_ptr.hpp"
+#include "pbqp.hpp"
+#include "ir.hpp"
 #include "text.hpp"
 #include "compiler_error.hpp"
 #include "string.hpp"
@@ -28,6 +32,7 @@
 #include "macro.hpp"
 #include "guard.hpp"
 #include "ctags.hpp"
+#include "tier.hpp"
 
 extern char __GIT_COMMIT;
 
@@ -202,6 +207,9 @@ void handle_options(fs::path dir, po::options_description const& cfg_desc, po::v
         }
     }
 
+    if(vm.count("data-window"))
+        _options.raw_data_window = true;
+
     if(vm.count("prg-size"))
         _options.raw_mp = vm["prg-size"].as<unsigned>();
 
@@ -229,6 +237,18 @@ void handle_options(fs::path dir, po::options_description const& cfg_desc, po::v
     if(vm.count("sloppy"))
         _options.sloppy = true;
 
+    if(vm.count("tiered"))
+        _options.tiered = true;
+
+    if(vm.count("fast-mul"))
+        _options.fast_mul = true;
+
+    if(vm.count("isel-exact"))
+        _options.isel_exact = true;
+
+    if(vm.count("isel-budget-ms"))
+        _options.isel_budget_ms = std::max(vm["isel-budget-ms"].as<int>(), 0);
+
     if(vm.count("unsafe-bank-switch"))
         _options.unsafe_bank_switch = true;
 
@@ -285,6 +305,9 @@ int main(int argc, char** argv)
                 ("error-on-warning,W", "turn warnings into errors")
                 ("pause", "await input on stdin before exiting")
                 ("sloppy", "faster compile times, but worse optimization")
+                ("tiered", "sloppy compile, except for functions found hot by the previous build")
+                ("isel-exact", "solve small instruction selection graphs exactly, instead of heuristically")
+                ("isel-budget-ms", po::value<int>(), "instruction selection time per function, before narrowing the search (in ms, 0 is off)")
             ;
 
             po::options_description mapper_opt("Mapper options");
@@ -295,6 +318,7 @@ int main(int argc, char** argv)
                 ("chr-size,c", po::value<unsigned>(), "size of mapper CHR in KiB")
                 ("bus-conflicts", po::value<std::string>(), "enable / disable mapper bus conflicts")
                 ("sram", po::value<std::string>(), "configure 8KiB SRAM")
+                ("data-window", "switch banked data through a separate 8KiB window (MMC3)")
                 ("multicart", po::value<std::string>(), "make ROM compatible with the specified multicart")
             ;
 
@@ -302,6 +326,7 @@ int main(int argc, char** argv)
             code_opt.add_options()
                 ("system,S", po::value<std::string>(), "target NES system")
                 ("unsafe-bank-switch", "faster but less safe bank switches")
+                ("fast-mul", "faster multiplication, using 1KiB of lookup tables")
                 ("mlb", po::value<std::string>(), "generate Mesen label file")
                 ("ctags", po::value<std::string>(), "generate Ctags file")
             ;
@@ -405,6 +430,7 @@ int main(int argc, char** argv)
                 .chr_size = _options.raw_mc,
                 .bus_conflicts = _options.raw_bus_conflicts,
                 .sram = _options.raw_sram,
+                .data_window = _options.raw_data_window,
             };
 
             auto const to_lower = [](std::string str)
@@ -503,6 +529,9 @@ int main(int argc, char** argv)
                 throw std::runtime_error(fmt("Unable to write Ctags file %", compiler_options().raw_ctags));
         }
 
+        if(compiler_options().tiered)
+            load_tiers();
+
         output_time("init:     ");
 
         set_compiler_phase(PHASE_PARSE_MACROS);
@@ -588,6 +617,59 @@ int main(int argc, char** argv)
         global_t::compile_all();
         output_time("compile:  ");
 
+        if(compiler_options().tiered)
+            save_tiers();
+
+        if(compiler_options().build_time)
+        {
+            unsigned num_calls = 0;
+            unsigned num_reg_conv_calls = 0;
+            for(fn_t const& fn : fn_ht::values())
+            {
+                num_calls += fn.num_calls();
+                num_reg_conv_calls += fn.num_reg_conv_calls();
+            }
+            std::printf("reg conv: %u of %u calls pass registers\n", num_reg_conv_calls, num_calls);
+
+            std::size_t summary_bytes = 0;
+            std::size_t dense_summary_bytes = 0;
+            for(fn_t const& fn : fn_ht::values())
+            {
+                summary_bytes += fn.summary_bytes();
+                dense_summary_bytes += fn.dense_summary_bytes();
+            }
+            for(fn_set_t const& fn_set : fn_set_ht::values())
+            {
+                summary_bytes += fn_set.summary_bytes();
+                dense_summary_bytes += fn_set.dense_summary_bytes();
+            }
+            std::printf("fn summaries: %.1f KB compressed, %.1f KB dense\n", 
+                        summary_bytes / 1024.0, dense_summary_bytes / 1024.0);
+
+            ir_arena_stats_t const arena = ir_arena_stats();
+            std::printf("ir buffers: %llu overflow buffers from %llu heap allocations\n",
+                        (unsigned long long)arena.allocs, (unsigned long long)arena.heap_allocs);
+
+            coalesce_stats_t const coalesce = coalesce_stats();
+            std::printf("coalesce: %llu checks, %.2f ms building live sets, %.2f ms checking\n",
+                        (unsigned long long)coalesce.checks,
+                        coalesce.build_ns / 1000000.0, coalesce.check_ns / 1000000.0);
+
+            if(mapper().bankswitches())
+            {
+                bank_switch_stats_t const bank = bank_switch_stats();
+                std::printf("bank switches: %u emitted%s, %u already loaded (%u after calls)\n", bank.switches,
+                            mapper().data_window ? " (data window only)" : "", bank.preloaded, bank.after_call);
+            }
+
+            if(compiler_options().isel_exact)
+            {
+                pbqp_exact_stats_t const exact = pbqp_exact_stats();
+                std::printf("isel exact: improved %u of %u graphs, saving %llu cost (%u hit the search limit)\n",
+                            exact.improved, exact.runs, (unsigned long long)exact.cost_saved, exact.exhausted);
+            }
+        }
+
         auto write_info = make_scope_guard([&]() {
             for(fn_t const& fn : fn_ht::values())
             {
@@ -604,15 +686,6 @@ int main(int argc, char** argv)
 
         set_compiler_phase(PHASE_ALLOC_RAM);
         alloc_ram(nullptr, ~static_used_ram);
-
-        if(compiler_options().ram_info)
-        {
-            std::filesystem::create_directory("info/");
-
-            std::ofstream of(fmt("info/RAM_info.txt"));
-            if(of.is_open())
-                print_ram(of);
-        }
         output_time("alloc ram:");
 
         set_compiler_phase(PHASE_RESET_PROC);
@@ -626,12 +699,36 @@ int main(int argc, char** argv)
 
         set_compiler_phase(PHASE_INITIAL_VALUES);
         gen_group_var_inits();
+        if(compiler_options().ram_info)
+        {
+            std::filesystem::create_directory("info/");
+
+            std::ofstream of(fmt("info/RAM_info.txt"));
+            if(of.is_open())
+            {
+                print_ram(of);
+                print_ram_init(of);
+            }
+        }
         output_time("init vals:");
 
         set_compiler_phase(PHASE_PREPARE_ALLOC_ROM);
         prune_rom_data();
         link_variables_optimize();
         alloc_rom(nullptr, rom_allocator);
+        if(compiler_options().build_time)
+        {
+            page_layout_stats_t const& stats = page_layout_stats();
+            std::printf("page layout: moved %u of %u hot, %.0f -> %.0f weighted cycles\n", 
+                        unsigned(stats.moves.size()), stats.num_hot, stats.cycles_before, stats.cycles_after);
+
+            if(mapper().data_window)
+            {
+                data_window_stats_t const& window = data_window_stats();
+                std::printf("data window: %u arrays (%u bytes), %u procs not duplicated (%u bytes)\n",
+                            window.arrays, window.array_bytes, window.procs, window.proc_bytes);
+            }
+        }
         if(compiler_options().ram_info)
         {
             std::filesystem::create_directory("info/");
@@ -678,6 +775,10 @@ int main(int argc, char** argv)
 
     if(compiler_options().build_time)
     {
+        file_cache_stats_t const stats = file_cache_stats();
+        std::printf("file cache: %llu bytes mapped, %llu bytes copied\n", 
+                    (unsigned long long)stats.bytes_mapped, (unsigned long long)stats.bytes_copied);
+
         auto now = std::chrono::system_clock::now();
         unsigned long long const ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - entry_time).count();
         std::printf("time total:     %8lli ms\n", ms);
@@ -111,6 +111,13 @@ bool mapper_params_t::no_sram(mapper_type_t) const
     return false;
 }
 
+bool mapper_params_t::no_data_window(mapper_type_t mt) const
+{
+    if(data_window)
+        throw std::runtime_error(fmt("Invalid %: Mapper does not support data-window.", mapper_name(mt)));
+    return false;
+}
+
 bool mapper_params_t::sram_persistent(mapper_type_t mt, bool default_) const
 {
     switch(sram)
@@ -137,6 +144,7 @@ mapper_t mapper_t::nrom(mapper_params_t const& params)
         .bus_conflicts = params.no_conflicts(mt),
         .sram = params.has_sram(mt, false),
         .sram_persistent = params.sram_persistent(mt, false),
+        .data_window = params.no_data_window(mt),
     };
 }
 
@@ -152,6 +160,7 @@ mapper_t mapper_t::anrom(mapper_params_t const& params)
         .bus_conflicts = params.conflicts(mt, false),
         .sram = params.has_sram(mt, false),
         .sram_persistent = params.sram_persistent(mt, false),
+        .data_window = params.no_data_window(mt),
     };
 }
 
@@ -167,6 +176,7 @@ mapper_t mapper_t::bnrom(mapper_params_t const& params)
         .bus_conflicts = params.conflicts(mt, true),
         .sram = params.has_sram(mt, false),
         .sram_persistent = params.sram_persistent(mt, false),
+        .data_window = params.no_data_window(mt),
     };
 }
 
@@ -182,6 +192,7 @@ mapper_t mapper_t::cnrom(mapper_params_t const& params)
         .bus_conflicts = params.no_conflicts(mt),
         .sram = params.has_sram(mt, false),
         .sram_persistent = params.sram_persistent(mt, false),
+        .data_window = params.no_data_window(mt),
     };
 }
 
@@ -197,6 +208,7 @@ mapper_t mapper_t::gnrom(mapper_params_t const& params)
         .bus_conflicts = params.conflicts(mt, true),
         .sram = params.has_sram(mt, false),
         .sram_persistent = params.sram_persistent(mt, false),
+        .data_window = params.no_data_window(mt),
     };
 }
 
@@ -212,6 +224,7 @@ mapper_t mapper_t::colordreams(mapper_params_t const& params)
         .bus_conflicts = params.conflicts(mt, true),
         .sram = params.has_sram(mt, false),
         .sram_persistent = params.sram_persistent(mt, false),
+        .data_window = params.no_data_window(mt),
     };
 }
 
@@ -227,6 +240,7 @@ mapper_t mapper_t::gtrom(mapper_params_t const& params)
         .bus_conflicts = params.no_conflicts(mt),
         .sram = params.has_sram(mt, false),
         .sram_persistent = params.sram_persistent(mt, false),
+        .data_window = params.no_data_window(mt),
     };
 }
 
@@ -242,6 +256,7 @@ mapper_t mapper_t::ines_189(mapper_params_t const& params)
         .bus_conflicts = params.no_conflicts(mt),
         .sram = params.no_sram(mt),
         .sram_persistent = false,
+        .data_window = params.no_data_window(mt),
     };
 }
 
@@ -257,6 +272,7 @@ mapper_t mapper_t::mmc1(mapper_params_t const& params)
         .bus_conflicts = params.no_conflicts(mt),
         .sram = params.has_sram(mt, false),
         .sram_persistent = params.sram_persistent(mt, false),
+        .data_window = params.no_data_window(mt),
     };
 }
 
@@ -273,6 +289,7 @@ mapper_t mapper_t::unrom(mapper_params_t const& params)
         .bus_conflicts = params.conflicts(mt, true),
         .sram = params.has_sram(mt, false),
         .sram_persistent = params.sram_persistent(mt, false),
+        .data_window = params.no_data_window(mt),
     };
 }
 
@@ -289,6 +306,7 @@ mapper_t mapper_t::mmc3(mapper_params_t const& params)
         .bus_conflicts = params.no_conflicts(mt),
         .sram = params.has_sram(mt, false),
         .sram_persistent = params.sram_persistent(mt, false),
+        .data_window = params.data_window,
     };
 }
 
@@ -307,6 +325,7 @@ mapper_t mapper_t::ines_30(mapper_params_t const& params)
         .sram = params.has_sram(mt, false),
         .sram_persistent = params.sram_persistent(mt, false),
         .force_battery = !bus_conflicts,
+        .data_window = params.no_data_window(mt),
     };
 }
 
@@ -67,6 +67,7 @@ struct mapper_params_t
     unsigned chr_size; // in KiB
     mapper_bus_conflicts_t bus_conflicts;
     mapper_sram_t sram;
+    bool data_window;
 
     mapper_mirroring_t mirroring_none(mapper_type_t mt) const;
     mapper_mirroring_t mirroring_HV(mapper_type_t mt) const;
@@ -79,6 +80,7 @@ struct mapper_params_t
     bool has_sram(mapper_type_t mt, bool default_) const;
     bool sram_persistent(mapper_type_t mt, bool default_) const;
     bool no_sram(mapper_type_t) const;
+    bool no_data_window(mapper_type_t) const;
 
     unsigned num_32k_banks(mapper_type_t mt, unsigned min, unsigned max, unsigned default_) const;
     unsigned num_16k_banks(mapper_type_t mt, unsigned min, unsigned max, unsigned default_) const;
@@ -97,6 +99,7 @@ struct mapper_t
     bool sram;
     bool sram_persistent;
     bool force_battery;
+    bool data_window; // Banked data is switched through an 8KiB window at $A000.
 
     unsigned num_16k_banks() const { return fixed_16k ? num_banks : num_banks * 2; }
     unsigned bank_size() const { return fixed_16k ? 0x4000 : 0x8000; }
@@ -120,7 +123,14 @@ struct mapper_t
     span_t rom_span() const { return { 0x8000, 0x8000 }; }
     span_t fixed_rom_span() const { return fixed_16k ? span_t{ 0xC000, 0x4000 } : span_t{ 0x8000, 0x8000 }; }
     span_t switched_rom_span() const { return fixed_16k ? span_t{ 0x8000, 0x4000 } : span_t{ 0x8000, 0x8000 }; }
-    std::uint16_t this_bank_addr() const { return fixed_16k ? 0xBFFF : 0; }
+    std::uint16_t this_bank_addr() const { return data_window ? 0x9FFF : (fixed_16k ? 0xBFFF : 0); }
+
+    // With 'data_window', switched banks hold code in their first 8KiB and group data in their second.
+    // The second half can be switched on its own, leaving the code of the first half mapped.
+    span_t code_window_span() const { return data_window ? span_t{ 0x8000, 0x2000 } : switched_rom_span(); }
+    span_t data_window_span() const { return data_window ? span_t{ 0xA000, 0x2000 } : span_t{}; }
+    std::uint16_t data_bank_addr() const { return data_window ? 0xBFFF : 0; }
+
     span_t bank_span(unsigned bank) const 
     { 
         if(fixed_16k)
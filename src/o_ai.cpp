@@ -88,6 +88,9 @@ struct ssa_ai_d
     // This is used to determine when to widen.
     unsigned visited_count = 0;
 
+    // Like above, but for the narrowing phase.
+    unsigned narrowed_count = 0;
+
     // If any of the value's inputs were modified by the jump threading pass.
     bool touched = false;
 
@@ -97,6 +100,23 @@ struct ssa_ai_d
 cfg_ai_d& ai_data(cfg_ht h) { return h.data<cfg_ai_d>(); }
 ssa_ai_d& ai_data(ssa_ht h) { return h.data<ssa_ai_d>(); }
 
+// Range propagation visits nodes in weak topological order (see 'build_wto'),
+// which stabilizes inner loops before moving past them.
+TLS priority_worklist_t<cfg_ht> cfg_prop_worklist;
+TLS priority_worklist_t<ssa_ht> ssa_prop_worklist;
+
+std::uint64_t prop_priority(cfg_ht cfg) 
+{ 
+    assert(algo(cfg).wto_i != UNVISITED);
+    return std::uint64_t(algo(cfg).wto_i) << 2; 
+}
+
+std::uint64_t prop_priority(ssa_ht ssa) 
+{ 
+    // Within a CFG node, phis go first.
+    return prop_priority(ssa->cfg_node()) | (ssa->op() == SSA_phi ? 1 : 2);
+}
+
 static void init_constraint(ssa_ht ssa);
 
 void new_cfg(cfg_ht cfg)
@@ -212,11 +232,19 @@ public:
     ai_t(log_t* log, ir_t& ir_, bool byteified);
 
 private:
-    // Threshold points where widening occurs.
+    // Phis at the heads of WTO components get widened once they've
+    // changed this many times.
+    static constexpr unsigned WIDEN_HEAD = 3;
+
+    // Threshold points where widening occurs for every node.
+    // These exist as a fallback, guaranteeing termination.
     // Keep these in ascending order!!
     static constexpr unsigned WIDEN_OP_BOUNDS = 16;
     static constexpr unsigned WIDEN_OP        = 24;
 
+    // Limits how many times a node can be refined by narrowing.
+    static constexpr unsigned NARROW_OP = 4;
+
     void mark_skippable();
     void remove_skippable();
 
@@ -235,6 +263,7 @@ private:
     void compute_trace_constraints(executable_index_t exec_i, ssa_ht trace_h);
     void compute_constraints(executable_index_t exec_i, ssa_ht ssa_h);
     void visit(ssa_ht ssa_h);
+    void narrow_visit(ssa_ht ssa_h);
     void range_propagate();
     void prune_unreachable_code();
     void fold_consts();
@@ -258,6 +287,7 @@ private:
 
 public:
     int updated = false;
+    ai_stats_t stats = {};
 };
 
 ai_t::ai_t(log_t* log, ir_t& ir_, bool byteified) 
@@ -322,14 +352,18 @@ void ai_t::queue_edge(cfg_ht h, unsigned out_i)
         return;
 
     d.output_executable[EXEC_PROPAGATE].set(out_i);
-    cfg_worklist.push(h->output(out_i));
+    cfg_ht const output = h->output(out_i);
+    cfg_prop_worklist.push(output, prop_priority(output));
 }
 
 void ai_t::queue_node(executable_index_t exec_i, ssa_ht h)
 {
     if(ai_data(h->cfg_node()).executable[exec_i])
     {
-        ssa_worklist.push(h);
+        if(exec_i == EXEC_PROPAGATE)
+            ssa_prop_worklist.push(h, prop_priority(h));
+        else
+            ssa_worklist.push(h);
 
         // Also queue any traces:
         unsigned const output_size = h->output_size();
@@ -754,7 +788,10 @@ void ai_t::compute_trace_constraints(executable_index_t exec_i, ssa_ht trace)
     // For each parent, we'll perform a narrowing operation.
 
     // Our results will be stored here.
-    constraints_vec_t narrowed = get_constraints(trace->input(0)).vec;
+    static TLS constraints_soa_t narrowed;
+    static TLS constraints_soa_t narrow_soa;
+    constraints_vec_t narrowed_vec = get_constraints(trace->input(0)).vec;
+    narrowed.load(narrowed_vec);
 
     for(unsigned i = 1; i < input_size; i += 2)
     {
@@ -800,19 +837,17 @@ void ai_t::compute_trace_constraints(executable_index_t exec_i, ssa_ht trace)
             dprint(log, "--TRACE_X", c[1][0]);
 
         // Update narrowed:
-        for(unsigned j = 0; j < narrowed.size(); ++j)
-        {
-            dprint(log, "--NARROW_RESULT", narrowed[j]);
-            dprint(log, "--C_RESULT", c[arg_i][j]);
-            narrowed[j] = intersect(narrowed[j], c[arg_i][j]);
-        }
+        narrow_soa.load(c[arg_i].vec, narrowed.size());
+        batch_intersect(narrowed, narrow_soa);
     }
 
-    passert((is_subset(narrowed[0], get_constraints(trace->input(0))[0], trace_d.constraints().cm)),
-            narrowed[0], '\n', get_constraints(trace->input(0))[0]);
+    narrowed.store(narrowed_vec);
+
+    passert((is_subset(narrowed_vec[0], get_constraints(trace->input(0))[0], trace_d.constraints().cm)),
+            narrowed_vec[0], '\n', get_constraints(trace->input(0))[0]);
 
     trace_d.executable_index = exec_i;
-    trace_d.constraints().vec = std::move(narrowed);
+    trace_d.constraints().vec = std::move(narrowed_vec);
 }
 
 ////////////////////////////////////////
@@ -844,32 +879,53 @@ void ai_t::compute_constraints(executable_index_t exec_i, ssa_ht ssa_node)
             return;
         }
 
-        // Build an array holding all the argument's constraints.
         unsigned const input_size = ssa_node->input_size();
-        bc::small_vector<constraints_def_t, 16> c;
-        c.resize(input_size);
+
         if(ssa_node->op() == SSA_phi)
         {
-            // For phi nodes, if an input CFG edge hasn't been marked
-            // executable, treat the argument's constraint as TOP.
+            // For phi nodes, union the constraints of every argument 
+            // whose input CFG edge has been marked executable.
+            // The rest are TOP, which is the identity of union.
             cfg_ht cfg_node = ssa_node->cfg_node();
-
             assert(input_size == cfg_node->input_size());
+
+            std::size_t const size = d.constraints().vec.size();
+            static TLS constraints_soa_t phi_soa;
+            static TLS constraints_soa_t input_soa;
+            static TLS constraints_def_t input_def;
+            phi_soa.assign(size, constraints_t::top());
+
             for(unsigned i = 0; i < input_size; ++i)
             {
                 auto edge = cfg_node->input_edge(i);
                 auto& edge_d = ai_data(edge.handle);
 
-                if(edge_d.output_executable[exec_i].test(edge.index))
+                if(!edge_d.output_executable[exec_i].test(edge.index))
+                    continue;
+
+                ssa_value_t const input = ssa_node->input(i);
+                dprint(log, "-COMPUTE_CONSTRAINTS_PHI", ssa_node, i, input);
+
+                if(input.is_handle())
+                    input_soa.load(ai_data(input.handle()).constraints().vec, size);
+                else
                 {
-                    copy_constraints(ssa_node->input(i), c[i]);
-                    dprint(log, "-COMPUTE_CONSTRAINTS_PHI", ssa_node, i, ssa_node->input(i), c[i].vec.size());
+                    copy_constraints(input, input_def);
+                    input_soa.load(input_def.vec, size);
                 }
-                else
-                    c[i].vec.assign(d.constraints().vec.size(), constraints_t::top());
+
+                batch_union(phi_soa, input_soa);
             }
+
+            d.executable_index = exec_i;
+            phi_soa.store(d.constraints().vec);
+            return;
         }
-        else for(unsigned i = 0; i < input_size; ++i)
+
+        // Build an array holding all the argument's constraints.
+        bc::small_vector<constraints_def_t, 16> c;
+        c.resize(input_size);
+        for(unsigned i = 0; i < input_size; ++i)
         {
             dprint(log, "-COMPUTE_CONSTRAINTS_INPUT", ssa_node, ssa_node->input(i));
             copy_constraints(ssa_node->input(i), c[i]);
@@ -959,6 +1015,8 @@ void ai_t::visit(ssa_ht ssa_node)
     old_constraints = d.constraints();
     assert(all_normalized(old_constraints));
 
+    ++stats.visits;
+
     if(d.visited_count >= WIDEN_OP)
     {
         dprint(log, "--WIDEN", ssa_node);
@@ -973,8 +1031,20 @@ void ai_t::visit(ssa_ht ssa_node)
         passert(old_constraints.vec.size() == d.constraints().vec.size(), ssa_node->op());
 
         if(d.visited_count > WIDEN_OP_BOUNDS)
+        {
             for(constraints_t& c : d.constraints().vec)
                 c.bounds = bounds_t::bottom(d.constraints().cm);
+        }
+        else if(d.visited_count >= WIDEN_HEAD 
+                && ssa_node->op() == SSA_phi 
+                && algo(ssa_node->cfg_node()).is_wto_head)
+        {
+            dprint(log, "--WIDEN_HEAD", ssa_node);
+            ++stats.widenings;
+            for(unsigned i = 0; i < old_constraints.vec.size(); ++i)
+                d.constraints()[i] = widen(old_constraints[i], d.constraints()[i], d.constraints().cm);
+        }
+
         for(constraints_t& c : d.constraints().vec)
             c.normalize(d.constraints().cm);
     }
@@ -1003,10 +1073,62 @@ void ai_t::visit(ssa_ht ssa_node)
     }
 }
 
+// Refines the constraints of 'ssa_node' after widening was applied.
+// The result is always a subset of the prior constraints.
+void ai_t::narrow_visit(ssa_ht ssa_node)
+{
+    dprint(log, "-SSA_NARROW_VISIT ", ssa_node->op(), ssa_node);
+
+    if(ssa_node->op() == SSA_if || is_switch(ssa_node->op()) || !has_constraints(ssa_node))
+        return;
+
+    auto& d = ai_data(ssa_node);
+
+    if(d.narrowed_count >= NARROW_OP)
+        return;
+
+    static TLS constraints_def_t old_constraints;
+    old_constraints = d.constraints();
+    assert(all_normalized(old_constraints));
+
+    ++stats.narrow_visits;
+
+    compute_constraints(EXEC_PROPAGATE, ssa_node);
+    passert(old_constraints.vec.size() == d.constraints().vec.size(), ssa_node->op());
+
+    for(unsigned i = 0; i < old_constraints.vec.size(); ++i)
+    {
+        constraints_mask_t const cm = d.constraints().cm;
+        constraints_t c = normalize(d.constraints()[i], cm);
+        c = normalize(narrow(old_constraints[i], c, cm), cm);
+
+        // Narrowing should never produce an empty set from a non-empty one,
+        // but be conservative if it does:
+        if(c.is_top(cm) && !old_constraints[i].is_top(cm))
+            c = old_constraints[i];
+
+        d.constraints()[i] = c;
+    }
+
+    assert(all_normalized(d.constraints()));
+    if(!bit_eq(d.constraints().vec, old_constraints.vec))
+    {
+        ++d.narrowed_count;
+
+        unsigned const output_size = ssa_node->output_size();
+        for(unsigned i = 0; i < output_size; ++i)
+            queue_node(EXEC_PROPAGATE, ssa_node->output(i));
+    }
+}
+
 void ai_t::range_propagate()
 {
     assert(ssa_worklist.empty());
     assert(cfg_worklist.empty());
+    assert(ssa_prop_worklist.empty());
+    assert(cfg_prop_worklist.empty());
+
+    build_wto(ir);
 
     // Reset the flags.
     for(cfg_ht cfg_it = ir.cfg_begin(); cfg_it; ++cfg_it)
@@ -1039,17 +1161,20 @@ void ai_t::range_propagate()
 #endif
 
     assert(ir.root);
-    cfg_worklist.push(ir.root);
+    cfg_prop_worklist.push(ir.root, prop_priority(ir.root));
 
     ir.assert_valid();
-    while(!ssa_worklist.empty() || !cfg_worklist.empty())
+    while(!ssa_prop_worklist.empty() || !cfg_prop_worklist.empty())
     {
-        while(!ssa_worklist.empty())
-            visit(ssa_worklist.pop());
-
-        while(!cfg_worklist.empty())
+        if(!ssa_prop_worklist.empty() 
+           && (cfg_prop_worklist.empty() 
+               || ssa_prop_worklist.top_priority() < cfg_prop_worklist.top_priority()))
         {
-            cfg_ht const cfg_node = cfg_worklist.pop();
+            visit(ssa_prop_worklist.pop());
+        }
+        else
+        {
+            cfg_ht const cfg_node = cfg_prop_worklist.pop();
             dprint(log, "-CFG_VISIT", cfg_node);
 
             auto& d = ai_data(cfg_node);
@@ -1074,6 +1199,19 @@ void ai_t::range_propagate()
                 queue_edge(cfg_node, 0);
         }
     }
+
+    // Now narrow, recovering precision lost to widening.
+    // This starts from a post-fixpoint, so every step stays sound.
+    if(stats.widenings)
+    {
+        for(cfg_ht cfg_node : wto)
+            for(ssa_ht ssa_it = cfg_node->ssa_begin(); ssa_it; ++ssa_it)
+                queue_node(EXEC_PROPAGATE, ssa_it);
+
+        while(!ssa_prop_worklist.empty())
+            narrow_visit(ssa_prop_worklist.pop());
+    }
+
     ir.assert_valid();
 }
 
@@ -2202,6 +2340,15 @@ cfg_ht ai_t::try_rewrite_loop(cfg_ht header_cfg, std::uint64_t back_edge_inputs,
             new_cfg(new_header_cfg);
             new_cfg(new_exit_cfg);
 
+            cfg_algo_pool.resize(cfg_pool::array_size());
+            algo(new_header_cfg) = {};
+            algo(new_exit_cfg) = {};
+
+            dom_split_edge(ir, header_cfg, new_header_cfg, new_header_cfg->output(0));
+            dom_split_edge(ir, header_cfg, new_exit_cfg, new_exit_cfg->output(0));
+            loop_split_edge(header_cfg, new_header_cfg, new_header_cfg->output(0));
+            loop_split_edge(header_cfg, new_exit_cfg, new_exit_cfg->output(0));
+
             fc::small_map<ssa_ht, ssa_ht, 16> header_to_new_header;
             fc::small_map<ssa_ht, ssa_ht, 16> header_to_new_exit;
             fc::small_map<ssa_ht, ssa_ht, 16> new_exit_to_new_header;
@@ -2225,11 +2372,13 @@ cfg_ht ai_t::try_rewrite_loop(cfg_ht header_cfg, std::uint64_t back_edge_inputs,
                     assert(phi->input(0)->cfg_node() == header_cfg);
                     return phi->input(0)->input(input);
                 });
+                dom_insert_edge(ir, ie.handle, new_header_cfg);
             });
             bitset_for_each_reverse(back_edge_inputs, [&](unsigned input)
             {
                 auto ie = header_cfg->input_edge(input);
                 ie.handle->link_remove_output(ie.index);
+                dom_delete_edge(ir, ie.handle, header_cfg);
             });
 
             // Create a new branch:
@@ -2247,33 +2396,13 @@ cfg_ht ai_t::try_rewrite_loop(cfg_ht header_cfg, std::uint64_t back_edge_inputs,
             {
                 return *new_exit_to_new_header.has(phi);
             });
+            dom_insert_edge(ir, new_header_cfg, new_exit_cfg);
             if(!exit_output)
                 new_header_cfg->link_swap_outputs(0, 1);
 
             // Update the data:
-            cfg_algo_pool.resize(cfg_pool::array_size());
-
-            auto& ha = algo(header_cfg);
-            ha.is_loop_header = false;
-
-            auto& nha = algo(new_header_cfg);
-            nha = {};
-            nha.is_loop_header = true;
-            nha.iloop_header = ha.iloop_header;
-
-            auto& nea = algo(new_exit_cfg);
-            nea = {};
-            nea.iloop_header = ha.iloop_header;
-
-            for(cfg_ht cfg = ir.cfg_begin(); cfg; ++cfg)
-            {
-                auto& a = algo(cfg);
-                if(a.iloop_header == header_cfg)
-                    a.iloop_header = new_header_cfg;
-            }
-
-            ::build_order(ir);
-            ::build_dominators_from_order(ir);
+            loop_move_header(ir, header_cfg, new_header_cfg);
+            assert_dominators_valid(ir);
 
             assert(algo(new_header_cfg).is_loop_header);
 
@@ -2406,6 +2535,9 @@ cfg_ht ai_t::try_rewrite_loop(cfg_ht header_cfg, std::uint64_t back_edge_inputs,
     cfg_ht const new_branch_cfg = ir.emplace_cfg(header_cfg->prop_flags());
     new_cfg(new_branch_cfg);
 
+    cfg_algo_pool.resize(cfg_pool::array_size());
+    algo(new_branch_cfg) = {};
+
     // The new node may have phis created:
     bool const realloc_phis = builtin::popcount(back_edge_inputs) > 1;
     unsigned const first_back_edge_input = builtin::ctz(back_edge_inputs);
@@ -2430,26 +2562,27 @@ cfg_ht ai_t::try_rewrite_loop(cfg_ht header_cfg, std::uint64_t back_edge_inputs,
             assert(phi->output(0)->input(input) != phi);
             return phi->output(0)->input(input);
         });
+        dom_insert_edge(ir, ie.handle, new_branch_cfg);
     });
 
     bitset_for_each_reverse(back_edge_inputs, [&](unsigned input)
     {
         auto ie = header_cfg->input_edge(input);
         ie.handle->link_remove_output(ie.index);
+        dom_delete_edge(ir, ie.handle, header_cfg);
     });
 
-    cfg_algo_pool.resize(cfg_pool::array_size());
-    algo(new_branch_cfg) = {};
-
     // Steal the SSA branch:
     new_branch_cfg->steal_ssa(branch_ssa, true);
     _recursive_steal(header_cfg, new_branch_cfg, branch_ssa);
 
     // Make 'new_branch_cfg' a branch:
-    new_branch_cfg->link_append_output(header_cfg->output(exit_output), [&](ssa_ht phi) -> ssa_value_t
+    cfg_ht const exit_cfg = header_cfg->output(exit_output);
+    new_branch_cfg->link_append_output(exit_cfg, [&](ssa_ht phi) -> ssa_value_t
     {
         return phi->input(header_cfg->output_edge(exit_output).index);
     });
+    dom_insert_edge(ir, new_branch_cfg, exit_cfg);
     if(!exit_output)
         new_branch_cfg->link_swap_outputs(0, 1);
 
@@ -2460,9 +2593,8 @@ cfg_ht ai_t::try_rewrite_loop(cfg_ht header_cfg, std::uint64_t back_edge_inputs,
 
     // Remove the old branch:
     header_cfg->link_remove_output(exit_output);
-
-    ::build_order(ir);
-    ::build_dominators_from_order(ir);
+    dom_delete_edge(ir, header_cfg, exit_cfg);
+    assert_dominators_valid(ir);
 
     assert(dominates(header_cfg, new_branch_cfg));
 
@@ -2599,7 +2731,7 @@ void ai_t::rewrite_loops()
 
 } // End anonymous namespace
 
-bool o_abstract_interpret(log_t* log, ir_t& ir, bool byteified)
+bool o_abstract_interpret(log_t* log, ir_t& ir, bool byteified, ai_stats_t* stats)
 {
     bool updated = false;
     resize_ai_prep();
@@ -2609,6 +2741,15 @@ bool o_abstract_interpret(log_t* log, ir_t& ir, bool byteified)
         ssa_data_pool::scope_guard_t<ssa_ai_d> sg(ssa_pool::array_size());
         ai_t ai(log, ir, byteified);
         updated = ai.updated;
+
+        if(stats)
+        {
+            stats->runs += 1;
+            stats->visits += ai.stats.visits;
+            stats->max_visits = std::max(stats->max_visits, ai.stats.visits);
+            stats->widenings += ai.stats.widenings;
+            stats->narrow_visits += ai.stats.narrow_visits;
+        }
     }
 
 #ifndef NDEBUG
@@ -33,6 +33,16 @@ inline ai_prep_t& ai_prep(ssa_ht ssa) { assert(ssa.id < ai_prep_vec.size()); ret
 inline void reset_ai_prep() { ai_prep_vec.clear(); }
 inline void resize_ai_prep() { ai_prep_vec.resize(ssa_pool::array_size()); }
 
-bool o_abstract_interpret(log_t* os, ir_t& ir, bool byteified);
+// Counters describing how much work the pass did.
+struct ai_stats_t
+{
+    unsigned runs = 0;
+    unsigned visits = 0;
+    unsigned max_visits = 0; // Most visits in a single run.
+    unsigned widenings = 0;
+    unsigned narrow_visits = 0;
+};
+
+bool o_abstract_interpret(log_t* os, ir_t& ir, bool byteified, ai_stats_t* stats = nullptr);
 
 #endif
@@ -64,8 +64,9 @@ public:
         for(cfg_node_t const& cfg_node : ir)
         for(ssa_ht ssa_it = cfg_node.ssa_begin(); ssa_it; ++ssa_it)
         {
-            if(ssa_it->in_daisy() 
-               || (ssa_flags(ssa_it->op()) & (SSAF_NO_GVN | SSAF_WRITE_ARRAY | SSAF_IO_IMPURE)) 
+            ssa_hot_t const& hot = ssa_it.hot();
+            if((hot.flags & FLAG_DAISY)
+               || (ssa_flags(hot.op) & (SSAF_NO_GVN | SSAF_WRITE_ARRAY | SSAF_IO_IMPURE)) 
                || !pure(*ssa_it))
             {
                 data(ssa_it).gvn = m_next_gvn++;
@@ -144,11 +145,16 @@ public:
         updated = true;
     }
 
+    void run_pre(ir_t& ir, motion_stats_t* stats);
+
     static ssa_gvn_d& data(ssa_ht h) { return h.data<ssa_gvn_d>(); }
 
     bool updated = false;
 
 private:
+    bool pre_candidate(ssa_ht ssa) const;
+    ssa_ht available(gvn_key_t const& key, cfg_ht cfg) const;
+
     array_pool_t<gvn_t> m_pool;
     rh::robin_map<gvn_key_t, gvn_t> m_key_map;
     rh::batman_map<gvn_t, std::vector<ssa_ht>> m_gvn_sets;
@@ -157,6 +163,217 @@ private:
     log_t* log = nullptr;
 };
 
+////////////////////////////////////
+// PARTIAL REDUNDANCY ELIMINATION //
+////////////////////////////////////
+
+// After GVN has merged full redundancies, this removes partial ones:
+// expressions computed at a join point that were already computed
+// along some of the incoming paths.
+//
+// For each incoming edge, the expression is translated through the join's phis,
+// and its GVN key is looked up to find a dominating computation.
+// Along edges where no such computation exists, a copy is inserted at the
+// end of the predecessor (splitting critical edges as needed),
+// and the original is replaced by a phi.
+// Thus, no path ever evaluates the expression more than it used to.
+// Nothing is inserted along back edges.
+//
+// This covers both loop-carried redundancies (at loop headers), 
+// and values recomputed after an if/else.
+
+bool run_gvn_t::pre_candidate(ssa_ht ssa) const
+{
+    if(ssa->op() == SSA_phi
+       || ssa->in_daisy() 
+       || (ssa_flags(ssa->op()) & (SSAF_NO_GVN | SSAF_WRITE_ARRAY | SSAF_IO_IMPURE)) 
+       || (ssa_input0_class(ssa->op()) == INPUT_LINK)
+       || !pure(*ssa)
+       || estimate_cost(*ssa) == 0)
+    {
+        return false;
+    }
+
+    // Links (like carry outputs) can't be replaced by a phi.
+    unsigned const output_size = ssa->output_size();
+    for(unsigned i = 0; i < output_size; ++i)
+        if(ssa->output_edge(i).input_class() == INPUT_LINK)
+            return false;
+
+    // At least one input must be a phi in the same CFG node,
+    // and the rest must be defined elsewhere.
+    bool has_phi = false;
+    unsigned const input_size = ssa->input_size();
+    for(unsigned i = 0; i < input_size; ++i)
+    {
+        ssa_value_t const input = ssa->input(i);
+        if(!input.holds_ref() || input->cfg_node() != ssa->cfg_node())
+            continue;
+        if(input->op() != SSA_phi)
+            return false;
+        has_phi = true;
+    }
+
+    return has_phi;
+}
+
+// Returns an existing node matching 'key' whose value is available at the end of 'cfg'.
+ssa_ht run_gvn_t::available(gvn_key_t const& key, cfg_ht cfg) const
+{
+    auto const* key_pair = m_key_map.lookup(key);
+    if(!key_pair)
+        return {};
+
+    auto const* set_pair = m_gvn_sets.lookup(key_pair->second);
+    if(!set_pair || set_pair->second.empty())
+        return {};
+
+    // After merging, the first node of each set is the only one remaining.
+    ssa_ht const leader = set_pair->second.front();
+    if(!dominates(leader->cfg_node(), cfg))
+        return {};
+
+    return leader;
+}
+
+// Splits a critical edge so that code can be inserted along it.
+// Dominator info is patched in place so that 'dominates' remains usable.
+static cfg_ht split_pre_edge(ir_t& ir, cfg_ht cfg, unsigned input_i)
+{
+    cfg_ht const pred = cfg->input(input_i);
+    cfg_ht const split = ir.split_edge(cfg->input_edge(input_i).output());
+
+    cfg_algo_pool.resize(cfg_pool::array_size());
+    algo(split) = {};
+    dom_split_edge(ir, pred, split, cfg);
+    // Keeps the back edge test in 'run_pre' correct for later candidates.
+    assert(algo(pred).postorder_i > algo(cfg).postorder_i);
+    algo(split).postorder_i = algo(pred).postorder_i - 1;
+
+    return split;
+}
+
+void run_gvn_t::run_pre(ir_t& ir, motion_stats_t* stats)
+{
+    std::vector<ssa_ht> candidates;
+    std::vector<ssa_ht> available_nodes;
+    std::vector<gvn_t> args;
+
+    // Iterate using handles, as splitting edges can invalidate references.
+    for(cfg_ht cfg_it = ir.cfg_begin(); cfg_it; ++cfg_it)
+    {
+        unsigned const pred_size = cfg_it->input_size();
+        if(pred_size < 2)
+            continue;
+
+        candidates.clear();
+        for(ssa_ht ssa_it = cfg_it->ssa_begin(); ssa_it; ++ssa_it)
+            if(pre_candidate(ssa_it))
+                candidates.push_back(ssa_it);
+
+        for(ssa_ht ssa : candidates)
+        {
+            // An earlier replacement may have disqualified this node.
+            if(!pre_candidate(ssa))
+                continue;
+
+            unsigned const input_size = ssa->input_size();
+            unsigned num_available = 0;
+            available_nodes.resize(pred_size);
+
+            for(unsigned i = 0; i < pred_size; ++i)
+            {
+                cfg_ht const pred = cfg_it->input(i);
+
+                // Translate the expression through the phis:
+                args.resize(input_size);
+                for(unsigned j = 0; j < input_size; ++j)
+                {
+                    ssa_value_t input = ssa->input(j);
+                    if(input.holds_ref() && input->cfg_node() == cfg_it)
+                        input = input->input(i);
+                    args[j] = to_gvn(input);
+                }
+
+                if(ssa_flags(ssa->op()) & SSAF_COMMUTATIVE)
+                    if(args[0] > args[1])
+                        std::swap(args[0], args[1]);
+
+                gvn_key_t const key = { ssa->op(), input_size, args.data(), ssa->type() };
+                ssa_ht const leader = available(key, pred);
+
+                if(leader && leader != ssa)
+                {
+                    available_nodes[i] = leader;
+                    ++num_available;
+                }
+                else if(algo(pred).postorder_i <= algo(cfg_it).postorder_i)
+                    goto next_candidate; // Don't insert along back edges.
+                else
+                    available_nodes[i] = {};
+            }
+
+            // The phi may need a copy along each edge, so only replace
+            // expressions that are more expensive than that.
+            if(estimate_cost(*ssa) * num_available <= ssa->type().size_of() * pred_size)
+                continue;
+
+            {
+                // Insert copies where the value wasn't available:
+                for(unsigned i = 0; i < pred_size; ++i)
+                {
+                    if(available_nodes[i])
+                        continue;
+
+                    cfg_ht pred = cfg_it->input(i);
+                    if(pred->output_size() != 1)
+                        pred = split_pre_edge(ir, cfg_it, i);
+
+                    ssa_ht const copy = pred->emplace_ssa(ssa->op(), ssa->type());
+                    copy->alloc_input(input_size);
+                    for(unsigned j = 0; j < input_size; ++j)
+                    {
+                        ssa_value_t input = ssa->input(j);
+                        if(input.holds_ref() && input->cfg_node() == cfg_it)
+                            input = input->input(i);
+                        copy->build_set_input(j, input);
+                    }
+
+                    ssa_data_pool::resize<ssa_gvn_d>(ssa_pool::array_size());
+                    m_gvn_sets[to_gvn(copy)].push_back(copy);
+                    available_nodes[i] = copy;
+                    dprint(log, "PRE_INSERT", copy, pred);
+
+                    if(stats)
+                        ++stats->pre_inserted;
+                }
+
+                // Replace the original with a phi:
+                ssa_ht const phi = cfg_it->emplace_ssa(SSA_phi, ssa->type());
+                phi->alloc_input(pred_size);
+                for(unsigned i = 0; i < pred_size; ++i)
+                    phi->build_set_input(i, available_nodes[i]);
+
+                ssa_data_pool::resize<ssa_gvn_d>(ssa_pool::array_size());
+                data(phi).gvn = m_next_gvn++;
+
+                dprint(log, "PRE_REPLACE", ssa, "with", phi);
+
+                if(stats)
+                {
+                    ++stats->pre_eliminated;
+                    stats->pre_cost_saved += estimate_cost(*ssa) * num_available;
+                }
+
+                ssa->replace_with(phi);
+                ssa->prune();
+                updated = true;
+            }
+        next_candidate:;
+        }
+    }
+}
+
 ///////////////////
 // LOOP HOISTING //
 ///////////////////
@@ -256,7 +473,7 @@ static bool o_hoist(log_t* log, ir_t& ir)
 // MOTION //
 ////////////
 
-bool o_motion(log_t* log, ir_t& ir)
+bool o_motion(log_t* log, ir_t& ir, motion_stats_t* stats)
 {
     build_loops_and_order(ir);
     build_dominators_from_order(ir);
@@ -266,9 +483,17 @@ bool o_motion(log_t* log, ir_t& ir)
     {
         ssa_data_pool::scope_guard_t<ssa_gvn_d> sg(ssa_pool::array_size());
         run_gvn_t runner(log, ir);
+        runner.run_pre(ir, stats);
         updated |= runner.updated;
     }
 
+    // PRE may have split edges, invalidating loop info.
+    if(updated)
+    {
+        build_loops_and_order(ir);
+        build_dominators_from_order(ir);
+    }
+
     updated |= o_hoist(log, ir);
 
     return updated;
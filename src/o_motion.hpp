@@ -4,6 +4,14 @@
 #include "debug_print.hpp"
 #include "ir_decl.hpp"
 
-bool o_motion(log_t* log, ir_t& ir);
+// Counters describing how much partial redundancy elimination did.
+struct motion_stats_t
+{
+    unsigned pre_eliminated = 0; // Expressions replaced by phis.
+    unsigned pre_inserted = 0;   // Copies inserted along edges.
+    unsigned pre_cost_saved = 0; // Sum of 'estimate_cost' over removed evaluations.
+};
+
+bool o_motion(log_t* log, ir_t& ir, motion_stats_t* stats = nullptr);
 
 #endif
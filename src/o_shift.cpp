@@ -2,6 +2,8 @@
 
 #include "ir.hpp"
 #include "runtime.hpp"
+#include "builtin.hpp"
+#include "div.hpp"
 
 bool o_shl_tables(log_t* log, ir_t& ir)
 {
@@ -58,3 +60,127 @@ bool o_shl_tables(log_t* log, ir_t& ir)
     return modified;
 }
 
+
+// Divides a byte by a constant, using the high byte of a multiplication.
+static ssa_value_t _div_byte(cfg_node_t& cfg, ssa_value_t value, unsigned divisor)
+{
+    assert(divisor > 1 && divisor <= 0xFF);
+
+    div_magic_t magic = div_magic(divisor);
+
+    if(!magic)
+    {
+        // Shifting out the even part first shrinks the range of the dividend,
+        // which makes it easier to find an exact multiplier.
+        unsigned const shifts = builtin::ctz(divisor);
+        assert(shifts);
+        value = cfg.emplace_ssa(SSA_shr, TYPE_U, value, ssa_value_t(shifts, TYPE_U));
+        divisor >>= shifts;
+        magic = div_magic(divisor, 0xFF >> shifts);
+    }
+
+    assert(magic);
+
+    ssa_ht const lo = cfg.emplace_ssa(SSA_mul8_lo, TYPE_U, value, ssa_value_t(magic.mul & 0xFF, TYPE_U));
+    ssa_value_t result = cfg.emplace_ssa(SSA_mul8_hi, TYPE_U, lo);
+
+    unsigned shift = magic.shift;
+
+    if(magic.add)
+    {
+        ssa_ht const sub = cfg.emplace_ssa(SSA_sub, TYPE_U, value, result, ssa_value_t(1u, TYPE_BOOL));
+        ssa_ht const half = cfg.emplace_ssa(SSA_shr, TYPE_U, sub, ssa_value_t(1u, TYPE_U));
+        result = cfg.emplace_ssa(SSA_add, TYPE_U, half, result, ssa_value_t(0u, TYPE_BOOL));
+        shift -= 1;
+    }
+
+    if(shift)
+        result = cfg.emplace_ssa(SSA_shr, TYPE_U, result, ssa_value_t(shift, TYPE_U));
+
+    return result;
+}
+
+bool o_div_consts(log_t* log, ir_t& ir)
+{
+    bool modified = false;
+
+    for(cfg_node_t& cfg : ir)
+    for(ssa_ht ssa_it = cfg.ssa_begin(); ssa_it;)
+    {
+        if((ssa_it->op() != SSA_div && ssa_it->op() != SSA_mod) || !ssa_it->input(1).is_num())
+        {
+            ++ssa_it;
+            continue;
+        }
+
+        type_t const type = ssa_it->type();
+        ssa_value_t const value = ssa_it->input(0);
+        bool const mod = ssa_it->op() == SSA_mod;
+        std::uint32_t const divisor = ssa_it->input(1).whole();
+
+        assert(is_arithmetic(type.name()) && !is_signed(type.name()) && !frac_bytes(type.name()));
+
+        // Division by zero is left to the run-time routine.
+        if(!divisor)
+        {
+            ++ssa_it;
+            continue;
+        }
+
+        unsigned const shifts = builtin::ctz(divisor);
+        std::uint32_t const odd = divisor >> shifts;
+        std::uint32_t const low_mask = (1ull << shifts) - 1;
+
+        ssa_value_t result;
+
+        if(odd == 1)
+        {
+            if(mod)
+                result = cfg.emplace_ssa(SSA_and, type, value, ssa_value_t(low_mask, type.name()));
+            else if(shifts)
+                result = cfg.emplace_ssa(SSA_shr, type, value, ssa_value_t(shifts, TYPE_U));
+            else
+                result = value;
+        }
+        else if(type == TYPE_U)
+        {
+            ssa_value_t const quotient = _div_byte(cfg, value, divisor);
+
+            if(mod)
+            {
+                // The multiply will turn into shifts, courtesy of 'o_identities'.
+                ssa_ht const product = cfg.emplace_ssa(SSA_mul, type, quotient, ssa_value_t(divisor, type.name()));
+                result = cfg.emplace_ssa(SSA_sub, type, value, product, ssa_value_t(1u, TYPE_BOOL));
+            }
+            else
+                result = quotient;
+        }
+        else if(shifts)
+        {
+            // Wider types use the run-time routine, but only with the odd part.
+            ssa_ht const shifted = cfg.emplace_ssa(SSA_shr, type, value, ssa_value_t(shifts, TYPE_U));
+            ssa_ht const divided = cfg.emplace_ssa(ssa_it->op(), type, shifted, ssa_value_t(odd, type.name()));
+
+            if(mod)
+            {
+                ssa_ht const high = cfg.emplace_ssa(SSA_shl, type, divided, ssa_value_t(shifts, TYPE_U));
+                ssa_ht const low = cfg.emplace_ssa(SSA_and, type, value, ssa_value_t(low_mask, type.name()));
+                result = cfg.emplace_ssa(SSA_or, type, high, low);
+            }
+            else
+                result = divided;
+        }
+        else
+        {
+            ++ssa_it;
+            continue;
+        }
+
+        dprint(log, "DIV_CONSTS", ssa_it, divisor);
+        ssa_it->replace_with(result);
+        ssa_it = ssa_it->prune();
+        modified = true;
+    }
+
+    return modified;
+}
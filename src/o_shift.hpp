@@ -7,4 +7,8 @@
 // Replaces certain shifts with table lookups.
 bool o_shl_tables(log_t* log, ir_t& ir);
 
+// Strength-reduces division and modulo by constants into shifts and multiplies.
+// Must run before byteify.
+bool o_div_consts(log_t* log, ir_t& ir);
+
 #endif
@@ -112,25 +112,17 @@ bool o_remove_no_effect(log_t* log, ir_t& ir)
     ssa_worklist.clear();
 
     // Assume every node will be pruned, then prove which nodes shouldn't be.
-    for(cfg_node_t& cfg_node : ir)
-    for(ssa_ht ssa_it = cfg_node.ssa_begin(); ssa_it; ++ssa_it)
-    {
-        assert(!ssa_it->test_flags(FLAG_IN_WORKLIST));
-        ssa_it->set_flags(FLAG_TO_PRUNE);
-    }
-
     // Certain nodes will never be pruned by this. 
-    for(cfg_node_t& cfg_node : ir)
-    for(ssa_ht ssa_it = cfg_node.ssa_begin(); ssa_it; ++ssa_it)
+    ir.for_each_ssa([](ssa_ht ssa_it)
     {
-        if((ssa_flags(ssa_it->op()) & SSAF_CONDITIONAL)
-           || (ssa_flags(ssa_it->op()) & SSAF_WRITE_GLOBALS)
-           || (ssa_flags(ssa_it->op()) & SSAF_IO_IMPURE))
-        {
-            ssa_it->clear_flags(FLAG_TO_PRUNE);
+        ssa_hot_t& hot = ssa_it.hot();
+        assert(!(hot.flags & FLAG_IN_WORKLIST));
+
+        if(ssa_flags(hot.op) & (SSAF_CONDITIONAL | SSAF_WRITE_GLOBALS | SSAF_IO_IMPURE))
             ssa_worklist.push(ssa_it);
-        }
-    }
+        else
+            hot.flags |= FLAG_TO_PRUNE;
+    });
 
     while(!ssa_worklist.empty())
     {
@@ -24,6 +24,8 @@ struct options_t
 {
     int num_threads = 1;
     int time_limit = 1000;
+    unsigned isel_budget_ms = 0; // 0 is off
+    bool isel_exact = false;
     bool graphviz = false;
     bool ir_info = false;
     bool ram_info = false;
@@ -34,6 +36,8 @@ struct options_t
     bool unsafe_bank_switch = false;
     bool assert_valid = true;
     bool sloppy = false;
+    bool tiered = false;
+    bool fast_mul = false;
     bool action53 = false;
 
     bool ram_init = false;
@@ -55,6 +59,7 @@ struct options_t
     unsigned raw_mp = 0;
     mapper_bus_conflicts_t raw_bus_conflicts = {};
     mapper_sram_t raw_sram = {};
+    bool raw_data_window = false;
 
     mapper_t mapper;
     std::string output_file = "a.nes";
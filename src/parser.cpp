@@ -348,8 +348,12 @@ restart:
         assert(next_char >= source());
 #endif
         unsigned char const c = *next_char;
-        lexed = lexer_transition_table[lexed + lexer_ec_table[c]];
+        lexed = lexer_transition(lexed, c);
         ++next_char;
+
+        // Skip ahead in runs of whitespace, comments, and identifiers:
+        if(lex_loop_t const loop = lexer_loop(lexed))
+            next_char = lex_scan(next_char, loop);
     }
     --next_char;
 
@@ -404,7 +408,7 @@ asm_lex::token_type_t parser_t<P>::parse_asm_token(pstring_t from)
         if(size_left-- == -1)
             ::compiler_error(from, "Invalid assembly token.");
         unsigned char const c = *ptr;
-        lexed = asm_lex::lexer_transition_table[lexed + asm_lex::lexer_ec_table[c]];
+        lexed = asm_lex::lexer_transition(lexed, c);
     }
     if(lexed == asm_lex::TOK_ERROR)
         ::compiler_error(from, "Invalid assembly token.");
@@ -1,7 +1,23 @@
 #include "pbqp.hpp"
 
+#include <atomic>
+#include <numeric>
+
 #include "debug_print.hpp"
 
+namespace
+{
+    std::atomic<unsigned> exact_runs = 0;
+    std::atomic<unsigned> exact_improved = 0;
+    std::atomic<unsigned> exact_exhausted = 0;
+    std::atomic<pbqp_cost_t> exact_cost_saved = 0;
+}
+
+pbqp_exact_stats_t pbqp_exact_stats()
+{
+    return { exact_runs.load(), exact_improved.load(), exact_exhausted.load(), exact_cost_saved.load() };
+}
+
 template<typename Fn> [[gnu::flatten]]
 void handle_cases(bool node_a, Fn const& fn)
 {
@@ -43,6 +59,11 @@ void pbqp_t::solve(std::vector<pbqp_node_t*> order)
     std::vector<pbqp_node_t*> next_order;
     next_order.reserve(order.size());
 
+    // The exact solver runs after the heuristic, on a copy of the first irreducible graph.
+    exact_problem_t problem;
+    std::size_t exact_bp_size = 0;
+    bool tried_exact = !exact;
+
     // Continuously reduce nodes until no remain.
     while(true)
     {
@@ -70,6 +91,16 @@ void pbqp_t::solve(std::vector<pbqp_node_t*> order)
         // If nothing was reduced optimally, reduce 1 node suboptimally.
         if(optimal_reductions == 0)
         {
+            if(!tried_exact)
+            {
+                tried_exact = true;
+                if(order.size() <= EXACT_MAX_NODES)
+                {
+                    problem = make_exact_problem(order);
+                    exact_bp_size = bp_stack.size();
+                }
+            }
+
             unsigned best_i = 0;
 
             // We'll reduce the node with the highest degree.
@@ -86,37 +117,68 @@ void pbqp_t::solve(std::vector<pbqp_node_t*> order)
     }
 
     // Back-propagate
-    while(!bp_stack.empty())
+    for(auto it = bp_stack.rbegin(); it != bp_stack.rend(); ++it)
+        back_propagate(**it);
+
+    if(!problem.nodes.empty())
     {
-        pbqp_node_t& node = *bp_stack.back();
-        bp_stack.pop_back();
+        std::vector<unsigned> sels;
+        sels.reserve(problem.nodes.size());
+        for(pbqp_node_t const* node : problem.nodes)
+        {
+            assert(node->sel >= 0);
+            sels.push_back(node->sel);
+        }
 
-        if(node.degree == 1)
+        pbqp_cost_t const heuristic_cost = problem.cost(sels);
+        pbqp_cost_t cost = heuristic_cost;
+
+        exact_runs += 1;
+        if(solve_exact(problem, sels, cost))
         {
-            pbqp_edge_t* edge = node.edges[0];
-            pbqp_node_t& other = *edge->nodes[!edge->index(node)];
+            dprint(log, "-PBQP EXACT IMPROVED", heuristic_cost, cost);
+            exact_improved += 1;
+            exact_cost_saved += heuristic_cost - cost;
 
-            assert(other.sel >= 0);
-            assert(other.sel < int(node.bp_proof.size()));
+            for(unsigned i = 0; i < sels.size(); ++i)
+                problem.nodes[i]->sel = sels[i];
 
-            node.sel = node.bp_proof[other.sel];
+            // Nodes reduced before the copy was made depend on the new selections:
+            for(std::size_t i = exact_bp_size; i--;)
+                back_propagate(*bp_stack[i]);
         }
-        else
-        {
-            passert(node.degree == 2, node.degree);
+    }
 
-            pbqp_edge_t* edge_a = node.edges[0];
-            pbqp_edge_t* edge_b = node.edges[1];
-            pbqp_node_t& other_a = *edge_a->nodes[!edge_a->index(node)];
-            pbqp_node_t& other_b = *edge_b->nodes[!edge_b->index(node)];
+    bp_stack.clear();
+}
 
-            passert(other_a.sel >= 0, other_a.sel, other_b.sel, other_a.degree, other_b.degree);
-            passert(other_b.sel >= 0, other_b.sel, other_a.sel, other_b.degree, other_a.degree);
+void pbqp_t::back_propagate(pbqp_node_t& node)
+{
+    if(node.degree == 1)
+    {
+        pbqp_edge_t* edge = node.edges[0];
+        pbqp_node_t& other = *edge->nodes[!edge->index(node)];
 
-            unsigned const index = other_a.sel + (other_b.sel * other_a.num_sels());
-            passert(index < node.bp_proof.size(), index, node.bp_proof.size());
-            node.sel = node.bp_proof[index];
-        }
+        assert(other.sel >= 0);
+        assert(other.sel < int(node.bp_proof.size()));
+
+        node.sel = node.bp_proof[other.sel];
+    }
+    else
+    {
+        passert(node.degree == 2, node.degree);
+
+        pbqp_edge_t* edge_a = node.edges[0];
+        pbqp_edge_t* edge_b = node.edges[1];
+        pbqp_node_t& other_a = *edge_a->nodes[!edge_a->index(node)];
+        pbqp_node_t& other_b = *edge_b->nodes[!edge_b->index(node)];
+
+        passert(other_a.sel >= 0, other_a.sel, other_b.sel, other_a.degree, other_b.degree);
+        passert(other_b.sel >= 0, other_b.sel, other_a.sel, other_b.degree, other_a.degree);
+
+        unsigned const index = other_a.sel + (other_b.sel * other_a.num_sels());
+        passert(index < node.bp_proof.size(), index, node.bp_proof.size());
+        node.sel = node.bp_proof[index];
     }
 }
 
@@ -325,3 +387,178 @@ void pbqp_t::heuristic_reduction(pbqp_node_t& node)
     assert(node.sel >= 0);
 }
 
+
+auto pbqp_t::make_exact_problem(std::vector<pbqp_node_t*> const& order) const -> exact_problem_t
+{
+    exact_problem_t problem;
+    problem.nodes = order;
+
+    auto const index_of = [&](pbqp_node_t const* node) -> unsigned
+    {
+        auto it = std::find(order.begin(), order.end(), node);
+        assert(it != order.end());
+        return it - order.begin();
+    };
+
+    for(unsigned i = 0; i < order.size(); ++i)
+    {
+        pbqp_node_t const& node = *order[i];
+        problem.cost_vectors.push_back(node.cost_vector);
+
+        // Only edges that haven't been reduced remain, and they all connect nodes in 'order'.
+        for(unsigned n = 0; n < node.degree; ++n)
+        {
+            pbqp_edge_t const* edge = node.edges[n];
+            if(edge->nodes[pbqp_edge_t::FROM] == &node)
+                problem.edges.push_back({ i, index_of(edge->nodes[pbqp_edge_t::TO]), edge->cost_matrix });
+        }
+    }
+
+    return problem;
+}
+
+pbqp_cost_t pbqp_t::exact_problem_t::cost(std::vector<unsigned> const& sels) const
+{
+    pbqp_cost_t cost = 0;
+    for(unsigned i = 0; i < cost_vectors.size(); ++i)
+        cost += cost_vectors[i][sels[i]];
+    for(edge_t const& edge : edges)
+        cost += edge.cost_matrix[sels[edge.from] + sels[edge.to] * cost_vectors[edge.from].size()];
+    return cost;
+}
+
+// Branch and bound search over every selection of 'problem'.
+// 'sels' and 'best_cost' are updated if a strictly cheaper solution is found.
+bool pbqp_t::solve_exact(exact_problem_t const& problem, std::vector<unsigned>& sels, pbqp_cost_t& best_cost)
+{
+    unsigned const n = problem.nodes.size();
+    auto const& cost_vectors = problem.cost_vectors;
+
+    // Search the most connected nodes first:
+    std::vector<unsigned> degree(n, 0);
+    for(auto const& edge : problem.edges)
+        degree[edge.from] += 1, degree[edge.to] += 1;
+
+    std::vector<unsigned> search_order(n);
+    std::iota(search_order.begin(), search_order.end(), 0);
+    std::stable_sort(search_order.begin(), search_order.end(), [&](unsigned a, unsigned b)
+        { return degree[a] > degree[b]; });
+
+    std::vector<unsigned> rank(n);
+    for(unsigned i = 0; i < n; ++i)
+        rank[search_order[i]] = i;
+
+    // Each edge belongs to the node searched first, and is applied to the other node once selected.
+    struct adjacent_t
+    {
+        unsigned other;
+        std::vector<pbqp_cost_t> const* cost_matrix;
+        bool flipped; // If the node is the 'to' side of the edge.
+    };
+    std::vector<std::vector<adjacent_t>> later(n);
+
+    // 'bound' starts as the cost vector plus the row minima of edges to later nodes.
+    // As every later node is still unselected, the row minima never change,
+    // and are memoized in 'row_minima'.
+    std::vector<std::vector<pbqp_cost_t>> bound(cost_vectors);
+    std::vector<std::vector<pbqp_cost_t>> row_minima(n);
+    for(unsigned i = 0; i < n; ++i)
+        row_minima[i].resize(cost_vectors[i].size(), 0);
+
+    for(auto const& edge : problem.edges)
+    {
+        bool const flipped = rank[edge.to] < rank[edge.from];
+        unsigned const first = flipped ? edge.to : edge.from;
+        unsigned const second = flipped ? edge.from : edge.to;
+        unsigned const from_size = cost_vectors[edge.from].size();
+
+        later[first].push_back({ second, &edge.cost_matrix, flipped });
+
+        for(unsigned i = 0; i < cost_vectors[first].size(); ++i)
+        {
+            pbqp_cost_t min_cost = ~0ull;
+            for(unsigned j = 0; j < cost_vectors[second].size(); ++j)
+            {
+                unsigned const index = flipped ? (j + i * from_size) : (i + j * from_size);
+                min_cost = std::min(min_cost, edge.cost_matrix[index]);
+            }
+            row_minima[first][i] += min_cost;
+            bound[first][i] += min_cost;
+        }
+    }
+
+    std::vector<unsigned> current(n);
+    unsigned visits = 0;
+    bool improved = false;
+    bool exhausted = false;
+
+    auto const search = [&](auto const& self, unsigned depth, pbqp_cost_t cost) -> void
+    {
+        // 'bound' holds each unselected node's cost given the selected ones,
+        // so summing its minima gives a lower bound.
+        pbqp_cost_t lower_bound = cost;
+        for(unsigned i = depth; i < n; ++i)
+        {
+            auto const& b = bound[search_order[i]];
+            lower_bound += *std::min_element(b.begin(), b.end());
+        }
+
+        if(lower_bound >= best_cost)
+            return;
+
+        if(depth == n)
+        {
+            best_cost = cost;
+            sels = current;
+            improved = true;
+            return;
+        }
+
+        if(++visits > EXACT_MAX_VISITS)
+        {
+            exhausted = true;
+            return;
+        }
+
+        unsigned const node = search_order[depth];
+        auto const& b = bound[node];
+
+        // Try the cheapest selections first:
+        std::vector<unsigned> candidates(b.size());
+        std::iota(candidates.begin(), candidates.end(), 0);
+        std::sort(candidates.begin(), candidates.end(), [&](unsigned x, unsigned y) { return b[x] < b[y]; });
+
+        for(unsigned sel : candidates)
+        {
+            if(exhausted)
+                break;
+
+            current[node] = sel;
+
+            for(adjacent_t const& adj : later[node])
+            {
+                unsigned const from_size = adj.flipped ? cost_vectors[adj.other].size() : cost_vectors[node].size();
+                auto& other_bound = bound[adj.other];
+                for(unsigned j = 0; j < other_bound.size(); ++j)
+                    other_bound[j] += (*adj.cost_matrix)[adj.flipped ? (j + sel * from_size) : (sel + j * from_size)];
+            }
+
+            self(self, depth + 1, cost + b[sel] - row_minima[node][sel]);
+
+            for(adjacent_t const& adj : later[node])
+            {
+                unsigned const from_size = adj.flipped ? cost_vectors[adj.other].size() : cost_vectors[node].size();
+                auto& other_bound = bound[adj.other];
+                for(unsigned j = 0; j < other_bound.size(); ++j)
+                    other_bound[j] -= (*adj.cost_matrix)[adj.flipped ? (j + sel * from_size) : (sel + j * from_size)];
+            }
+        }
+    };
+
+    search(search, 0, 0);
+
+    if(exhausted)
+        exact_exhausted += 1;
+
+    return improved;
+}
@@ -93,22 +93,60 @@ struct pbqp_edge_t
     std::vector<pbqp_cost_t> cost_matrix;
 };
 
+// How often the exact solver ran, and how often it beat the heuristic.
+struct pbqp_exact_stats_t
+{
+    unsigned runs = 0;
+    unsigned improved = 0;
+    unsigned exhausted = 0; // Searches that hit the visit limit.
+    pbqp_cost_t cost_saved = 0;
+};
+
+pbqp_exact_stats_t pbqp_exact_stats();
+
 class pbqp_t
 {
 public:
-    explicit pbqp_t(log_t* log) : log(log) {}
+    // If 'exact' is set, small irreducible graphs are also solved by branch and bound.
+    explicit pbqp_t(log_t* log, bool exact = false) : log(log), exact(exact) {}
 
     void add_edge(pbqp_node_t& from, pbqp_node_t& to, std::vector<pbqp_cost_t> cost_matrix);
     void solve(std::vector<pbqp_node_t*> order);
 
+    // Limits of the exact solver:
+    static constexpr unsigned EXACT_MAX_NODES = 24;
+    static constexpr unsigned EXACT_MAX_VISITS = 1 << 16;
+
 private:
+    // The irreducible part of the graph, copied before any heuristic reductions.
+    struct exact_problem_t
+    {
+        struct edge_t
+        {
+            unsigned from;
+            unsigned to;
+            std::vector<pbqp_cost_t> cost_matrix;
+        };
+
+        std::vector<pbqp_node_t*> nodes;
+        std::vector<std::vector<pbqp_cost_t>> cost_vectors;
+        std::vector<edge_t> edges;
+
+        pbqp_cost_t cost(std::vector<unsigned> const& sels) const;
+    };
+
     void reduce(pbqp_node_t& node);
     bool optimal_reduction(pbqp_node_t& node);
     void heuristic_reduction(pbqp_node_t& node);
+    void back_propagate(pbqp_node_t& node);
+
+    exact_problem_t make_exact_problem(std::vector<pbqp_node_t*> const& order) const;
+    bool solve_exact(exact_problem_t const& problem, std::vector<unsigned>& sels, pbqp_cost_t& cost);
 
     std::deque<pbqp_edge_t> edge_pool;
     std::vector<pbqp_node_t*> bp_stack; // back propagation stack
     log_t* log;
+    bool exact;
 };
 
 #endif
@@ -0,0 +1,119 @@
+#include "catch/catch.hpp"
+#include "pbqp.hpp"
+
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+    struct test_edge_t
+    {
+        unsigned from;
+        unsigned to;
+        std::vector<pbqp_cost_t> cost_matrix;
+    };
+
+    struct test_graph_t
+    {
+        std::vector<std::vector<pbqp_cost_t>> cost_vectors;
+        std::vector<test_edge_t> edges;
+
+        pbqp_cost_t cost(std::vector<unsigned> const& sels) const
+        {
+            pbqp_cost_t cost = 0;
+            for(unsigned i = 0; i < cost_vectors.size(); ++i)
+                cost += cost_vectors[i][sels[i]];
+            for(test_edge_t const& edge : edges)
+                cost += edge.cost_matrix[sels[edge.from] + sels[edge.to] * cost_vectors[edge.from].size()];
+            return cost;
+        }
+
+        // Tries every combination of selections.
+        pbqp_cost_t brute_force() const
+        {
+            std::vector<unsigned> sels(cost_vectors.size(), 0);
+            pbqp_cost_t best = ~0ull;
+            while(true)
+            {
+                best = std::min(best, cost(sels));
+
+                unsigned i = 0;
+                for(; i < sels.size(); ++i)
+                {
+                    if(++sels[i] < cost_vectors[i].size())
+                        break;
+                    sels[i] = 0;
+                }
+
+                if(i == sels.size())
+                    return best;
+            }
+        }
+
+        pbqp_cost_t solve(bool exact) const
+        {
+            std::vector<pbqp_node_t> nodes(cost_vectors.size());
+            for(unsigned i = 0; i < nodes.size(); ++i)
+                nodes[i].cost_vector = cost_vectors[i];
+
+            pbqp_t pbqp(nullptr, exact);
+            for(test_edge_t const& edge : edges)
+                pbqp.add_edge(nodes[edge.from], nodes[edge.to], edge.cost_matrix);
+
+            std::vector<pbqp_node_t*> order;
+            for(pbqp_node_t& node : nodes)
+                order.push_back(&node);
+            pbqp.solve(std::move(order));
+
+            std::vector<unsigned> sels;
+            for(pbqp_node_t const& node : nodes)
+            {
+                REQUIRE(node.sel >= 0);
+                REQUIRE(unsigned(node.sel) < node.num_sels());
+                sels.push_back(node.sel);
+            }
+            return cost(sels);
+        }
+    };
+
+    // Makes dense graphs, so that degree 3 nodes remain after the optimal reductions.
+    test_graph_t random_graph(unsigned num_nodes, unsigned max_sels)
+    {
+        test_graph_t graph;
+        for(unsigned i = 0; i < num_nodes; ++i)
+        {
+            auto& cost_vector = graph.cost_vectors.emplace_back(1 + rand() % max_sels);
+            for(pbqp_cost_t& cost : cost_vector)
+                cost = rand() % 64;
+        }
+
+        for(unsigned from = 0; from < num_nodes; ++from)
+        for(unsigned to = from + 1; to < num_nodes; ++to)
+        {
+            if(rand() % 4 == 0)
+                continue;
+
+            std::vector<pbqp_cost_t> cost_matrix(graph.cost_vectors[from].size() * graph.cost_vectors[to].size());
+            for(pbqp_cost_t& cost : cost_matrix)
+                cost = rand() % 64;
+            graph.edges.push_back({ from, to, std::move(cost_matrix) });
+        }
+
+        return graph;
+    }
+}
+
+TEST_CASE("pbqp_exact", "[pbqp]")
+{
+    for(unsigned iter = 0; iter < 200; ++iter)
+    {
+        test_graph_t const graph = random_graph(3 + iter % 6, 4);
+
+        pbqp_cost_t const best = graph.brute_force();
+        pbqp_cost_t const heuristic = graph.solve(false);
+        pbqp_cost_t const exact = graph.solve(true);
+
+        REQUIRE(heuristic >= best);
+        REQUIRE(exact == best);
+    }
+}
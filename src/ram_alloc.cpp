@@ -4,6 +4,8 @@
 #include <iostream>
 #endif
 
+#include <numeric>
+
 #include "flat/small_set.hpp"
 
 #include "decl.hpp"
@@ -14,6 +16,7 @@
 #include "ram.hpp"
 #include "rom.hpp"
 #include "debug_print.hpp"
+#include "thread.hpp"
 
 namespace  // anonymous namespace
 {
@@ -210,6 +213,13 @@ private:
     template<step_t Step>
     void alloc_locals(romv_t romv, fn_ht h);
 
+    // Finds groups of fns whose lvar allocations can't affect each other.
+    void build_partitions();
+
+    // Calls 'alloc_locals' on 'fn_order', running each partition on its own thread.
+    template<step_t Step>
+    void alloc_partitioned(romv_t romv, std::vector<fn_ht> const& fn_order);
+
     struct group_vars_d
     {
         // Addresses that can be used to allocate globals.
@@ -262,6 +272,9 @@ private:
     // Handles static allocations:
     ram_sets_t static_usable_ram;
 
+    // Maps each fn to the lowest fn id in its partition.
+    std::vector<unsigned> fn_partition;
+
     log_t* log = nullptr;
 };
 
@@ -379,7 +392,7 @@ ram_allocator_t::ram_allocator_t(log_t* log, ram_bitset_t const& initial_usable_
             if(fn->fclass == FN_CT)
                 continue;
 
-            fn_data[fn.id].maximal_group_vars = fn->ir_group_vars();
+            fn_data[fn.id].maximal_group_vars = fn->ir_group_vars().dense();
             assert(fn_data[fn.id].maximal_group_vars);
         }
 
@@ -447,7 +460,7 @@ ram_allocator_t::ram_allocator_t(log_t* log, ram_bitset_t const& initial_usable_
             xbitset_t<group_vars_ht> group_vars;
             for(fn_t const* mode : global_t::modes())
             {
-                group_vars = mode->ir_group_vars();
+                group_vars = mode->ir_group_vars().dense();
                 if(fn_ht nmi = mode->mode_nmi())
                     group_vars |= nmi->ir_group_vars();
                 if(fn_ht irq = mode->mode_irq())
@@ -859,13 +872,13 @@ ram_allocator_t::ram_allocator_t(log_t* log, ram_bitset_t const& initial_usable_
             for(fn_ht fn : fn_orders[i])
                 dprint(log, "-RAM_ALLOC_BUILD_ORDER", i, fn->global.name);
 
+        build_partitions();
+
         for(int romv = NUM_ROMV - 1; romv >= 0; --romv)
-            for(fn_ht fn : fn_orders[romv])
-                alloc_locals<ZP_ONLY_ALLOC>(romv_t(romv), fn);
+            alloc_partitioned<ZP_ONLY_ALLOC>(romv_t(romv), fn_orders[romv]);
 
         for(int romv = NUM_ROMV - 1; romv >= 0; --romv)
-            for(fn_ht fn : fn_orders[romv])
-                alloc_locals<FULL_ALLOC>(romv_t(romv), fn);
+            alloc_partitioned<FULL_ALLOC>(romv_t(romv), fn_orders[romv]);
     }
 }
 
@@ -903,6 +916,90 @@ void ram_allocator_t::build_order(romv_t romv, std::vector<fn_ht>& fn_order, fn_
     d.step[romv] = BUILD_ORDER;
 }
 
+void ram_allocator_t::build_partitions()
+{
+    // 'alloc_locals' only touches the data of fns it can reach through calls, 
+    // interferences, and fn sets.
+    // Fns that can't reach each other form separate partitions.
+    // (Typically, these are modes, nmis, and irqs that share no fns.)
+
+    fn_partition.resize(fn_ht::pool().size());
+    std::iota(fn_partition.begin(), fn_partition.end(), 0);
+
+    auto const find = [&](unsigned i) -> unsigned
+    {
+        while(fn_partition[i] != i)
+            i = fn_partition[i] = fn_partition[fn_partition[i]];
+        return i;
+    };
+
+    auto const join = [&](fn_ht a, fn_ht b)
+    {
+        unsigned const x = find(a.id);
+        unsigned const y = find(b.id);
+        fn_partition[std::max(x, y)] = std::min(x, y);
+    };
+
+    for(fn_ht fn : fn_ht::handles())
+    {
+        if(fn->fclass == FN_CT)
+            continue;
+
+        fn->ir_calls().for_each([&](fn_ht call){ join(fn, call); });
+
+        lvars_manager_t const& lvars = fn->lvars();
+
+        for(unsigned i = 0; i < lvars.num_this_lvars(); ++i)
+            for(fn_ht interfering_fn : lvars.fn_interferences(i))
+                join(fn, interfering_fn);
+
+        for(unsigned i = lvars.num_this_lvars(); i < lvars.num_all_lvars(); ++i)
+            if(has_fn(lvars.locator(i).lclass()))
+                join(fn, lvars.locator(i).fn());
+    }
+
+    for(fn_set_t const& set : fn_set_ht::values())
+        for(fn_ht fn : set)
+            join(*set.begin(), fn);
+
+    for(unsigned i = 0; i < fn_partition.size(); ++i)
+        fn_partition[i] = find(i);
+}
+
+template<ram_allocator_t::step_t Step>
+void ram_allocator_t::alloc_partitioned(romv_t romv, std::vector<fn_ht> const& fn_order)
+{
+    // Logs would interleave, so only run serially when logging.
+    if(log || compiler_options().num_threads <= 1)
+    {
+        for(fn_ht fn : fn_order)
+            alloc_locals<Step>(romv, fn);
+        return;
+    }
+
+    // Split 'fn_order' by partition, keeping the order within each.
+    // As partitions share no data, the result matches allocating serially.
+    std::vector<std::vector<fn_ht>> partitioned;
+    std::vector<int> partition_index(fn_partition.size(), -1);
+
+    for(fn_ht fn : fn_order)
+    {
+        int& index = partition_index[fn_partition[fn.id]];
+        if(index < 0)
+        {
+            index = partitioned.size();
+            partitioned.emplace_back();
+        }
+        partitioned[index].push_back(fn);
+    }
+
+    parallel_for_each(compiler_options().num_threads, partitioned, [&](std::vector<fn_ht> const& fns)
+    {
+        for(fn_ht fn : fns)
+            alloc_locals<Step>(romv, fn);
+    });
+}
+
 template<ram_allocator_t::step_t Step>
 void ram_allocator_t::alloc_locals(romv_t const romv, fn_ht h)
 {
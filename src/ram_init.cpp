@@ -1,12 +1,17 @@
 #include "ram_init.hpp"
 
 #include <algorithm>
+#include <functional>
+#include <iterator>
+#include <string>
 
 #include "group.hpp"
 #include "globals.hpp"
 #include "span.hpp"
 #include "asm_proc.hpp"
 #include "rom.hpp"
+#include "runtime.hpp"
+#include "format.hpp"
 
 namespace  // anonymous
 {
@@ -69,10 +74,269 @@ std::vector<merged_span_t> reduce_spans(std::vector<init_span_t>& vec)
     return merged;
 }
 
+struct value_data_t
+{
+    span_t span = {};
+    loc_vec_t data;
+};
+
+// Value inits can be stored as a compressed stream, decoded at runtime.
+// The stream is a sequence of commands, each starting with a control byte 'c':
+//   c == 0x00: End of stream.
+//   c <  0x80: Copy 'c' bytes to an address.  Format: c, addr lo, addr hi, bytes (in reverse)
+//   c >  0x80: Fill 'c & 0x7F' bytes at an address. Format: c, addr lo, addr hi, byte
+// Streams are indexed using X, so each is limited to 256 bytes.
+
+constexpr unsigned max_rle_count = 0x7F;
+constexpr unsigned rle_header_size = 3;
+
+// How many cycles a byte of ROM is worth, when comparing the two methods.
+// Inits only run on reset and when entering modes, so ROM size matters more.
+constexpr unsigned cycles_per_rom_byte = 16;
+
+struct init_cost_t
+{
+    unsigned bytes = 0;
+    unsigned cycles = 0;
+
+    unsigned weighted() const { return bytes * cycles_per_rom_byte + cycles; }
+};
+
+struct ram_init_report_t
+{
+    std::string name;
+    unsigned value_bytes = 0;
+    init_cost_t direct;
+    init_cost_t compressed;
+    bool compress = false;
+};
+
+std::vector<ram_init_report_t> _reports;
+
+std::vector<loc_vec_t> rle_streams(std::vector<value_data_t> const& value_data)
+{
+    std::vector<loc_vec_t> streams(1);
+
+    auto const push_command = [&](std::uint8_t c, std::uint16_t addr, locator_t const* begin, locator_t const* end)
+    {
+        // Leave room for the terminating zero:
+        if(streams.back().size() + rle_header_size + (end - begin) + 1 > 256)
+        {
+            streams.back().push_back(locator_t::const_byte(0));
+            streams.emplace_back();
+        }
+
+        loc_vec_t& stream = streams.back();
+        stream.push_back(locator_t::const_byte(c));
+        stream.push_back(locator_t::const_byte(addr & 0xFF));
+        stream.push_back(locator_t::const_byte(addr >> 8));
+        stream.insert(stream.end(), std::reverse_iterator(end), std::reverse_iterator(begin));
+    };
+
+    for(value_data_t const& vd : value_data)
+    {
+        locator_t const* const data = vd.data.data();
+        unsigned const size = vd.data.size();
+
+        unsigned literal = 0; // Start of the pending copy
+        auto const flush_literal = [&](unsigned end)
+        {
+            if(literal < end)
+                push_command(end - literal, vd.span.addr + literal, data + literal, data + end);
+            literal = end;
+        };
+
+        for(unsigned i = 0; i < size;)
+        {
+            unsigned run = 1;
+            while(run < max_rle_count && i + run < size && data[i + run] == data[i])
+                ++run;
+
+            // Fills cost a header, and can split a copy into two.
+            // Only use them when they save bytes:
+            unsigned const split_cost = (i > literal) + (i + run < size);
+            if(run > 1 + split_cost * rle_header_size)
+            {
+                flush_literal(i);
+                push_command(0x80 | run, vd.span.addr + i, data + i, data + i + 1);
+                i += run;
+                literal = i;
+            }
+            else
+            {
+                i += 1;
+                if(i - literal == max_rle_count)
+                    flush_literal(i);
+            }
+        }
+
+        flush_literal(size);
+    }
+
+    streams.back().push_back(locator_t::const_byte(0));
+    return streams;
+}
+
+// Returns the next label id.
+unsigned gen_rle_decoder(asm_proc_t& proc, locator_t stream, unsigned next_label)
+{
+    locator_t const ptr = locator_t::runtime_ram(RTRAM_ptr_temp);
+
+    locator_t const next_command = proc.make_label(next_label++);
+    locator_t const copy_loop    = proc.make_label(next_label++);
+    locator_t const fill         = proc.make_label(next_label++);
+    locator_t const fill_loop    = proc.make_label(next_label++);
+    locator_t const done         = proc.make_label(next_label++);
+
+    proc.push_inst(LDX, 0);
+
+    proc.push_inst(ASM_LABEL, next_command);
+    proc.push_inst(LDA_ABSOLUTE_X, stream);
+    proc.push_inst(BEQ_LONG, done);
+    proc.push_inst(TAY);
+    proc.push_inst(LDA_ABSOLUTE_X, stream.with_advance_offset(1));
+    proc.push_inst(STA_ABSOLUTE, ptr);
+    proc.push_inst(LDA_ABSOLUTE_X, stream.with_advance_offset(2));
+    proc.push_inst(STA_ABSOLUTE, ptr.with_advance_offset(1));
+    proc.push_inst(TYA);
+    proc.push_inst(BMI_LONG, fill);
+
+    // Copy, with Y counting down:
+    proc.push_inst(INX);
+    proc.push_inst(INX);
+    proc.push_inst(INX);
+    proc.push_inst(ASM_LABEL, copy_loop);
+    proc.push_inst(LDA_ABSOLUTE_X, stream);
+    proc.push_inst(INX);
+    proc.push_inst(DEY);
+    proc.push_inst(STA_INDIRECT_Y, ptr);
+    proc.push_inst(BNE_LONG, copy_loop);
+    proc.push_inst(BEQ_LONG, next_command);
+
+    // Fill:
+    proc.push_inst(ASM_LABEL, fill);
+    proc.push_inst(AND, 0x7F);
+    proc.push_inst(TAY);
+    proc.push_inst(LDA_ABSOLUTE_X, stream.with_advance_offset(3));
+    proc.push_inst(INX);
+    proc.push_inst(INX);
+    proc.push_inst(INX);
+    proc.push_inst(INX);
+    proc.push_inst(ASM_LABEL, fill_loop);
+    proc.push_inst(DEY);
+    proc.push_inst(STA_INDIRECT_Y, ptr);
+    proc.push_inst(BNE_LONG, fill_loop);
+    proc.push_inst(BEQ_LONG, next_command);
+
+    proc.push_inst(ASM_LABEL, done);
+
+    return next_label;
+}
+
+// Estimates the cost of the loop 'gen_group_var_inits' builds for direct stores.
+template<typename Vec>
+init_cost_t direct_cost(Vec const& vec)
+{
+    std::vector<unsigned> sizes;
+    for(auto const& v : vec)
+        sizes.push_back(v.span.size);
+    std::sort(sizes.begin(), sizes.end(), std::greater<>{});
+
+    constexpr unsigned cutoff = 2;
+    constexpr unsigned byte_size = op_size(LDA_ABSOLUTE_X) + op_size(STA_ABSOLUTE_X);
+    constexpr unsigned byte_cycles = op_cycles(LDA_ABSOLUTE_X) + op_cycles(STA_ABSOLUTE_X);
+    constexpr unsigned gate_size = op_size(CPX_IMMEDIATE) + op_size(BCS_RELATIVE);
+    constexpr unsigned gate_cycles = op_cycles(CPX_IMMEDIATE) + op_cycles(BCS_RELATIVE);
+    constexpr unsigned iter_size = op_size(INX_IMPLIED) + op_size(CPX_IMMEDIATE) + op_size(BNE_RELATIVE);
+    constexpr unsigned iter_cycles = op_cycles(INX_IMPLIED) + op_cycles(CPX_IMMEDIATE) + op_cycles(BNE_RELATIVE);
+
+    init_cost_t cost;
+
+    if(!sizes.empty() && sizes[0] > cutoff)
+    {
+        cost.bytes += op_size(LDX_IMMEDIATE) + iter_size;
+        cost.cycles += op_cycles(LDX_IMMEDIATE) + sizes[0] * iter_cycles;
+    }
+
+    unsigned prev_size = sizes.empty() ? 0 : sizes[0];
+    for(unsigned size : sizes)
+    {
+        cost.bytes += size; // The data itself
+
+        if(size > cutoff)
+        {
+            if(size != prev_size)
+            {
+                cost.bytes += gate_size;
+                cost.cycles += prev_size * gate_cycles;
+                prev_size = size;
+            }
+
+            cost.bytes += byte_size;
+            cost.cycles += size * byte_cycles;
+        }
+        else
+        {
+            cost.bytes += size * (op_size(LDA_ABSOLUTE) + op_size(STA_ABSOLUTE));
+            cost.cycles += size * (op_cycles(LDA_ABSOLUTE) + op_cycles(STA_ABSOLUTE));
+        }
+    }
+
+    return cost;
+}
+
+// Estimates the cost of decoding 'streams' using 'gen_rle_decoder'.
+init_cost_t compressed_cost(std::vector<loc_vec_t> const& streams)
+{
+    // Only the decoder's size matters, so any array handle will do.
+    asm_proc_t decoder;
+    gen_rle_decoder(decoder, locator_t::rom_array(rom_array_ht{ 0 }), 0);
+
+    constexpr unsigned header_cycles 
+        = op_cycles(LDA_ABSOLUTE_X) * 3 + op_cycles(BEQ_RELATIVE) + op_cycles(TAY_IMPLIED) 
+        + op_cycles(STA_ZERO_PAGE) * 2 + op_cycles(TYA_IMPLIED) + op_cycles(BMI_RELATIVE) + op_cycles(BEQ_RELATIVE);
+    constexpr unsigned copy_cycles = op_cycles(INX_IMPLIED) * 3;
+    constexpr unsigned copy_byte_cycles 
+        = op_cycles(LDA_ABSOLUTE_X) + op_cycles(INX_IMPLIED) + op_cycles(DEY_IMPLIED) 
+        + op_cycles(STA_INDIRECT_Y) + op_cycles(BNE_RELATIVE);
+    constexpr unsigned fill_cycles 
+        = op_cycles(AND_IMMEDIATE) + op_cycles(TAY_IMPLIED) + op_cycles(LDA_ABSOLUTE_X) + op_cycles(INX_IMPLIED) * 4;
+    constexpr unsigned fill_byte_cycles = op_cycles(DEY_IMPLIED) + op_cycles(STA_INDIRECT_Y) + op_cycles(BNE_RELATIVE);
+
+    init_cost_t cost;
+
+    for(loc_vec_t const& stream : streams)
+    {
+        cost.bytes += decoder.size() + stream.size();
+        cost.cycles += op_cycles(LDX_IMMEDIATE);
+
+        for(unsigned i = 0; i < stream.size();)
+        {
+            unsigned const c = stream[i].data();
+            if(c == 0)
+                break;
+
+            cost.cycles += header_cycles;
+            if(c & 0x80)
+            {
+                cost.cycles += fill_cycles + (c & 0x7F) * fill_byte_cycles;
+                i += rle_header_size + 1;
+            }
+            else
+            {
+                cost.cycles += copy_cycles + c * copy_byte_cycles;
+                i += rle_header_size + c;
+            }
+        }
+    }
+
+    return cost;
+}
+
 } // end anonymous namespace
 
 
-bool gen_group_var_inits(std::vector<gvar_ht> const& gvars, asm_proc_t& proc)
+bool gen_group_var_inits(std::vector<gvar_ht> const& gvars, asm_proc_t& proc, std::string_view name)
 {
     // Gather lists of gmembers that need inits
 
@@ -137,76 +401,91 @@ bool gen_group_var_inits(std::vector<gvar_ht> const& gvars, asm_proc_t& proc)
         zero_combined.push_back({ span });
     }
 
-    struct combined_value_t
-    {
-        span_t span;
-        rom_array_ht rom_array;
-    };
+    // Gather the data of each merged span.
+    // It will either be stored directly, or compressed.
 
-    std::vector<combined_value_t> value_combined;
-    value_combined.reserve(value_merged.size() * 2);
+    std::vector<value_data_t> value_data;
+    value_data.reserve(value_merged.size());
 
     for(merged_span_t const& ms : value_merged)
     {
         ms.assert_valid();
-        span_t span_left = ms.span;
 
-        loc_vec_t vec;
-
-        auto const reset_vec = [&]()
-        {
-            vec.clear();
-            vec.reserve(std::min<unsigned>(256, span_left.size));
-        };
-
-        reset_vec();
+        loc_vec_t& vec = value_data.emplace_back(value_data_t{ ms.span }).data;
+        vec.reserve(ms.span.size);
 
         for(init_span_t const* is = ms.head; is; is = is->merged_with)
         {
             gmember_t const& gmember = *is->gmember;
             gvar_t const& gvar = gmember.gvar;
 
-            unsigned init_size = gmember.init_size();
+            unsigned const init_size = gmember.init_size();
             assert(init_size > 0);
             unsigned const init_span = gmember.init_span();
             locator_t const* init_data = gmember.init_data(is->atom);
 
             passert(init_size == is->span().size, init_size, is->span().size, gvar.global.name);
-            assert(vec.size() < 256);
 
-            while(vec.size() + init_size >= 256)
-            {
-                assert(span_left.size >= 256);
+            for(unsigned i = 0; i < init_size; ++i)
+                vec.push_back(init_data[i * init_span]);
+        }
 
-                while(vec.size() < 256)
-                {
-                    assert(init_size);
-                    vec.push_back(*init_data);
-                    init_data += init_span;
-                    init_size -= 1;
-                }
+        passert(vec.size() == ms.span.size, vec.size(), ms.span.size);
+    }
 
-                assert(vec.size() == 256);
+    // Split the data back apart so that all spans have size <= 256,
+    // which is what the direct stores can index.
 
-                value_combined.push_back({ span_t{ span_left.addr, 256 }, rom_array_t::make(std::move(vec), false, false, ROMR_NORMAL) });
-                reset_vec();
+    struct combined_value_t
+    {
+        span_t span;
+        loc_vec_t data;
+        rom_array_ht rom_array = {};
+    };
 
-                span_left.addr += 256;
-                span_left.size -= 256;
-            }
+    std::vector<combined_value_t> value_combined;
+    value_combined.reserve(value_data.size() * 2);
 
-            for(unsigned i = 0; i < init_size; ++i)
-                vec.push_back(init_data[i * init_span]);
+    for(value_data_t const& vd : value_data)
+    {
+        for(unsigned i = 0; i < vd.span.size; i += 256)
+        {
+            unsigned const size = std::min<unsigned>(256, vd.span.size - i);
+            value_combined.push_back({ 
+                .span = { .addr = vd.span.addr + i, .size = size },
+                .data = loc_vec_t(vd.data.begin() + i, vd.data.begin() + i + size) });
         }
+    }
 
-        assert(span_left.size <= 256);
-        passert(vec.size() == span_left.size, vec.size(), span_left.size);
+    // Pick between the two by their cost:
 
-        if(vec.size() > 0)
-            value_combined.push_back({ span_left, rom_array_t::make(std::move(vec), false, false, ROMR_NORMAL) });
+    std::vector<loc_vec_t> streams;
+    if(!value_data.empty())
+    {
+        streams = rle_streams(value_data);
+
+        ram_init_report_t& report = _reports.emplace_back();
+        report.name = name;
+        for(value_data_t const& vd : value_data)
+            report.value_bytes += vd.span.size;
+        report.direct = direct_cost(value_combined);
+        report.compressed = compressed_cost(streams);
+        report.compress = report.compressed.weighted() < report.direct.weighted();
+
+        if(report.compress)
+            value_combined.clear();
+        else
+            streams.clear();
     }
 
-    assert(!zero_combined.empty() || !value_combined.empty());
+    for(combined_value_t& v : value_combined)
+        v.rom_array = rom_array_t::make(std::move(v.data), false, false, ROMR_NORMAL);
+
+    std::vector<rom_array_ht> stream_arrays;
+    for(loc_vec_t& stream : streams)
+        stream_arrays.push_back(rom_array_t::make(std::move(stream), false, false, ROMR_NORMAL));
+
+    assert(!zero_combined.empty() || !value_combined.empty() || !stream_arrays.empty());
 
     // Create the proc
 
@@ -295,6 +574,9 @@ bool gen_group_var_inits(std::vector<gvar_ht> const& gvars, asm_proc_t& proc)
         proc.push_inst(STA_ABSOLUTE, locator_t::addr(v.span.addr, offset));
     });
 
+    for(rom_array_ht stream : stream_arrays)
+        next_label = gen_rle_decoder(proc, locator_t::rom_array(stream), next_label);
+
     return true;
 }
 
@@ -306,7 +588,7 @@ void gen_group_var_inits()
             continue;
 
         asm_proc_t proc;
-        if(gen_group_var_inits(g->vars()->gvars(), proc))
+        if(gen_group_var_inits(g->vars()->gvars(), proc, g->name))
         {
             proc.push_inst(RTS);
             proc.initial_optimize();
@@ -317,3 +599,16 @@ void gen_group_var_inits()
     }
 }
 
+
+void print_ram_init(std::ostream& o)
+{
+    o << "Initial values:\n\n";
+
+    for(ram_init_report_t const& report : _reports)
+    {
+        o << fmt("  %: % bytes, %\n", report.name, report.value_bytes, report.compress ? "compressed" : "direct");
+        o << fmt("    direct:     % ROM bytes, % cycles\n", report.direct.bytes, report.direct.cycles);
+        o << fmt("    compressed: % ROM bytes, % cycles\n", report.compressed.bytes, report.compressed.cycles);
+        o << '\n';
+    }
+}
@@ -1,13 +1,19 @@
 #ifndef RAM_INIT_HPP
 #define RAM_INIT_HPP
 
+#include <ostream>
+#include <string_view>
 #include <vector>
 
 class gvar_ht;
 class asm_proc_t;
 
-bool gen_group_var_inits(std::vector<gvar_ht> const& gvars, asm_proc_t& proc);
+// 'name' identifies the vars in 'print_ram_init'.
+bool gen_group_var_inits(std::vector<gvar_ht> const& gvars, asm_proc_t& proc, std::string_view name);
 void gen_group_var_inits();
 
+// Reports how initial values were stored, for the RAM info file.
+void print_ram_init(std::ostream& o);
+
 #endif
 
@@ -175,7 +175,7 @@ void rom_proc_t::assign(asm_proc_t&& asm_proc, romv_t romv)
     m_opt_procs[romv]->cache_size();
 }
 
-xbitset_t<group_ht> const* rom_proc_t::uses_groups() const 
+sparse_xbitset_t<group_ht> const* rom_proc_t::uses_groups() const 
 { 
     assert(compiler_phase() > rom_proc_ht::phase);
     return m_asm_proc.fn ? &m_asm_proc.fn->ir_deref_groups() : nullptr; 
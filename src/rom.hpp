@@ -1,6 +1,7 @@
 #ifndef ROM_HPP
 #define ROM_HPP
 
+#include <optional>
 #include <ranges>
 #include <vector>
 #include <stdexcept>
@@ -167,7 +168,7 @@ public:
 
     unsigned max_size(romv_t romv) const { return asm_proc(romv).cached_size; }
 
-    xbitset_t<group_ht> const* uses_groups() const;
+    sparse_xbitset_t<group_ht> const* uses_groups() const;
     bool for_each_group_test(std::function<bool(group_ht)> const& fn);
 
     void for_each_locator(std::function<void(locator_t)> const& fn) const;
@@ -252,6 +253,9 @@ struct rom_once_t : public rom_alloc_t
     // Which bank we're allocated in
     unsigned bank = ~0;
 
+    // If set, we're allocated in the bank's data window.
+    bool in_window = false;
+
     int only_bank() const { return static_cast<int>(bank); }
 
     template<typename Fn>
@@ -265,9 +269,16 @@ public:
     : allocator(allocator)
     , allocated_manys(many_bs_size)
     , allocated_onces(once_bs_size)
-    {}
+    {
+        if(span_t const window = mapper().data_window_span())
+            window_allocator.emplace(span_t{ window.addr, window.size - 1 }); // Leave 'data_bank_addr' unallocated.
+    }
 
     span_allocator_t allocator;
+    std::optional<span_allocator_t> window_allocator; // Only with 'mapper().data_window'.
+
+    span_allocator_t& allocator_for(rom_once_t const& once) { return once.in_window ? *window_allocator : allocator; }
+    span_allocator_t const& allocator_for(rom_once_t const& once) const { return once.in_window ? *window_allocator : allocator; }
     rh::robin_map<rom_many_ht, span_t> many_spans;
     bitset_t allocated_manys;
     bitset_t allocated_onces;
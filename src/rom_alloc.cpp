@@ -15,6 +15,37 @@
 #include "span_allocator.hpp"
 #include "debug_print.hpp"
 #include "lt.hpp"
+#include "runtime.hpp"
+#include "ir_algo.hpp"
+#include "tier.hpp"
+
+static page_layout_stats_t layout_stats;
+static data_window_stats_t window_stats;
+
+page_layout_stats_t const& page_layout_stats() { return layout_stats; }
+data_window_stats_t const& data_window_stats() { return window_stats; }
+
+// Compiled code only switches the data window to read group data,
+// so it can live in a different bank than that data.
+// Assembly switches whole banks, and runtime code reads its data directly.
+static bool reads_through_window(rom_proc_t const& rom_proc)
+{
+    if(!mapper().data_window)
+        return false;
+    fn_ht const fn = rom_proc.asm_proc().fn;
+    return fn && !fn->iasm;
+}
+
+namespace
+{
+    // A relative branch or an indexed read that may cross a page.
+    struct page_use_t
+    {
+        int from; // Offset after the branch, or the offset read from.
+        int to;   // Offset of the branch target, or -1 for reads.
+        double weight;
+    };
+}
 
 class rom_allocator_t
 {
@@ -79,12 +110,17 @@ private:
 
     // Allocate a DPCM span
     span_t alloc_dpcm(unsigned size);
+
+    // Moves hot ONCEs within their bank to avoid page-crossing penalties.
+    void page_layout();
 };
 
 rom_allocator_t::rom_allocator_t(log_t* log, span_allocator_t& allocator)
-: switched_span(mapper().switched_rom_span())
+: switched_span(mapper().code_window_span())
 , log(log)
 {
+    window_stats = {};
+
     // If we have a this_bank_addr, leave it unallocated.
     if(mapper().this_bank_addr())
     {
@@ -213,6 +249,14 @@ rom_allocator_t::rom_allocator_t(log_t* log, span_allocator_t& allocator)
             rom_once_ht const once = rom_once_ht::pool_make(ROMV_MODE, rom_array_h, alignment);
             rom_array.set_alloc(ROMV_MODE, once, rom_key_t());
             dprint(log, "--PREPPED ONCE", rom_array_h, once);
+
+            // Group data is only read after a bank switch, so it can go in the data window.
+            if(mapper().data_window && !rom_array.used_in_group_data().all_clear())
+            {
+                once.safe().in_window = true;
+                window_stats.arrays += 1;
+                window_stats.array_bytes += rom_array.data().size();
+            }
         }
         else
         {
@@ -263,16 +307,24 @@ rom_allocator_t::rom_allocator_t(log_t* log, span_allocator_t& allocator)
 
         // Check if the proc uses any 'ONCE'.
         // If it does, the proc has to be MANY, otherwise its ONCE.
+        // (ONCEs in the data window don't count, if the proc reads through the window.)
 
         unsigned const alignment = rom_proc.align() ? 256 : 1;
+        bool const windowed = reads_through_window(rom_proc);
         bool once = true;
+        bool window_once = windowed;
 
         for(rom_array_ht use : rom_proc_directly_uses[rom_proc_h.id])
         {
-            if(use->get_alloc(ROMV_MODE).rclass() == ROMA_ONCE)
+            rom_alloc_ht const alloc = use->get_alloc(ROMV_MODE);
+            if(alloc.rclass() == ROMA_ONCE)
             {
                 once = false;
-                goto is_many;
+                if(!rom_once_ht{ alloc.handle() }.safe().in_window)
+                {
+                    window_once = false;
+                    goto is_many;
+                }
             }
         }
 
@@ -289,6 +341,13 @@ rom_allocator_t::rom_allocator_t(log_t* log, span_allocator_t& allocator)
 
     is_many:
 
+        if(window_once && !once)
+        {
+            once = true;
+            window_stats.procs += 1;
+            window_stats.proc_bytes += rom_proc.maxest_size();
+        }
+
         romv_for_each(rom_proc.desired_romv(), [&](romv_t romv)
         {
             if(rom_proc.get_alloc(romv))
@@ -376,6 +435,11 @@ rom_allocator_t::rom_allocator_t(log_t* log, span_allocator_t& allocator)
     bitset_t use_many(many_bs_size);
     bitset_t use_once(once_bs_size);
 
+    bitset_t window_onces(once_bs_size);
+    for(unsigned i = 0; i < num_onces; ++i)
+        if(rom_once_ht{i}->in_window)
+            window_onces.set(i);
+
     for(rom_proc_ht rom_proc_h : rom_proc_ht::handles())
     {
         rom_proc_t& rom_proc = *rom_proc_h;
@@ -418,6 +482,9 @@ rom_allocator_t::rom_allocator_t(log_t* log, span_allocator_t& allocator)
             }
         }
 
+        if(reads_through_window(rom_proc))
+            bitset_difference(once_bs_size, use_once.data(), window_onces.data());
+
         // OK! The bitsets are built.
 
         for(unsigned romv = 0; romv < NUM_ROMV; ++romv)
@@ -485,6 +552,8 @@ rom_allocator_t::rom_allocator_t(log_t* log, span_allocator_t& allocator)
     // Allocate onces (this also allocates their required_manys)
     for(once_rank_t const& rank : ordered_onces)
         alloc(rank.once);
+
+    page_layout();
 }
 
 float rom_allocator_t::once_rank(rom_once_t const& once)
@@ -530,8 +599,9 @@ float rom_allocator_t::bank_rank(rom_bank_t const& bank, rom_once_t const& once)
         unrelated = bitset_popcount(once_bs_size, onces);
     }
 
-    float const r = bank.allocator.initial_bytes_free() * std::sqrt((float)bank.allocator.spans_free());
-    return -unallocated_many_size + related - (unrelated * 0.125f) + (bank.allocator.bytes_free() / r);
+    span_allocator_t const& allocator = bank.allocator_for(once);
+    float const r = allocator.initial_bytes_free() * std::sqrt((float)allocator.spans_free());
+    return -unallocated_many_size + related - (unrelated * 0.125f) + (allocator.bytes_free() / r);
 }
 
 void rom_allocator_t::rank_banks_for(rom_once_t const& once)
@@ -598,7 +668,7 @@ void rom_allocator_t::alloc(rom_once_ht once_h)
         
         // If we succeeded in allocating manys, try to allocate 'once's span:
         // (conditional has side effect assignment)
-        if(!allocated_manys || !(once.span = bank.allocator.alloc(once.max_size(), once.desired_alignment).object))
+        if(!allocated_manys || !(once.span = bank.allocator_for(once).alloc(once.max_size(), once.desired_alignment).object))
         {
             // If we fail, free allocated 'many' memory.
             for(rom_many_ht many_h : realloced_manys)
@@ -760,6 +830,209 @@ bool rom_allocator_t::realloc_many(rom_many_ht many_h, bank_bitset_t in_banks)
     return true;
 }
     
+///////////////////////
+// Page-aware layout //
+///////////////////////
+
+// 'asm_graph_t' orders code using offsets relative to each proc,
+// but only final addresses determine which branches cross pages.
+// Now that every ONCE has its bank, the hot ones can be moved into
+// the free span and page offset where they pay the fewest penalties:
+// - A taken branch into a different page takes 1 extra cycle.
+// - An indexed read that crosses a page takes 1 extra cycle.
+
+// Adds the branches and indexed reads of 'proc' to 'uses', weighted by loop depth.
+// Loop depth is approximated by treating labels that are jumped to backwards as loop headers.
+static void add_page_uses(asm_proc_t const& proc, std::vector<std::vector<page_use_t>>& uses, unsigned proc_once)
+{
+    unsigned const size = proc.code.size();
+
+    std::vector<int> offsets(size + 1);
+    rh::batman_map<locator_t, unsigned> label_indexes;
+    for(unsigned i = 0; i < size; ++i)
+    {
+        offsets[i + 1] = offsets[i] + op_size(proc.code[i].op);
+        if(proc.code[i].op == ASM_LABEL)
+            label_indexes.insert({ proc.code[i].arg.mem_head(), i });
+    }
+
+    auto const target = [&](asm_inst_t const& inst) -> unsigned const*
+    {
+        if(!(op_flags(inst.op) & (ASMF_BRANCH | ASMF_JUMP)))
+            return nullptr;
+        return label_indexes.mapped(inst.arg.mem_head());
+    };
+
+    // Maps each loop header to its last backwards jump:
+    std::vector<unsigned> loop_ends(size, 0);
+    for(unsigned i = 0; i < size; ++i)
+        if(unsigned const* to = target(proc.code[i]))
+            if(*to <= i)
+                loop_ends[*to] = i;
+
+    unsigned const base_depth = proc.fn && compiler_options().tiered && tier_hot(proc.fn->global.name);
+    std::vector<unsigned> depths(size, base_depth);
+    for(unsigned i = 0; i < size; ++i)
+        if(loop_ends[i])
+            for(unsigned j = i; j <= loop_ends[i]; ++j)
+                depths[j] += 1;
+
+    for(unsigned i = 0; i < size; ++i)
+    {
+        if(!depths[i])
+            continue;
+
+        asm_inst_t const& inst = proc.code[i];
+        double const weight = depth_exp(depths[i], 2);
+        addr_mode_t const mode = op_addr_mode(inst.op);
+
+        if(mode == MODE_RELATIVE && proc_once != ~0u)
+        {
+            if(unsigned const* to = target(inst))
+                uses[proc_once].push_back({ offsets[i + 1], offsets[*to], weight });
+        }
+        else if(mode == MODE_ABSOLUTE_X || mode == MODE_ABSOLUTE_Y)
+        {
+            rom_data_ht const data = inst.arg.rom_data();
+            if(!data || data.rclass() != ROMD_ARRAY)
+                continue;
+            rom_alloc_ht const alloc = rom_array_ht{ data.handle() }->get_alloc(ROMV_MODE);
+            if(alloc.rclass() == ROMA_ONCE)
+                uses[alloc.handle()].push_back({ inst.arg.offset(), -1, weight });
+        }
+    }
+}
+
+// Returns the penalty of 'uses' for data starting at 'page_offset'.
+static double page_cost(std::vector<page_use_t> const& uses, unsigned page_offset, unsigned size)
+{
+    double cost = 0;
+    for(page_use_t const& use : uses)
+    {
+        if(use.to >= 0)
+        {
+            if(((page_offset + use.from) >> 8) != ((page_offset + use.to) >> 8))
+                cost += use.weight;
+        }
+        else if(use.from < int(size))
+        {
+            // Assume every index is equally likely:
+            int const range = std::min<int>(256, size - use.from);
+            int const low = (page_offset + use.from) & 0xFF;
+            if(int const crossings = low + range - 256; crossings > 0)
+                cost += use.weight * crossings / range;
+        }
+    }
+    return cost;
+}
+
+void rom_allocator_t::page_layout()
+{
+    layout_stats = {};
+
+    unsigned const num_onces = rom_once_ht::pool().size();
+    std::vector<std::vector<page_use_t>> uses(num_onces);
+
+    for(rom_proc_ht rom_proc_h : rom_proc_ht::handles())
+    {
+        rom_proc_t const& rom_proc = *rom_proc_h;
+
+        if(!rom_proc.emits())
+            continue;
+
+        for(unsigned romv = 0; romv < NUM_ROMV; ++romv)
+        {
+            rom_alloc_ht const alloc = rom_proc.get_alloc(romv_t(romv));
+            if(!alloc)
+                continue;
+            add_page_uses(rom_proc.asm_proc(romv_t(romv)), uses, 
+                          alloc.rclass() == ROMA_ONCE ? alloc.handle() : ~0u);
+        }
+    }
+
+    struct hot_t
+    {
+        double weight;
+        unsigned once_i;
+    };
+
+    // Give the hottest ONCEs first pick:
+    std::vector<hot_t> hot;
+    for(unsigned i = 0; i < num_onces; ++i)
+    {
+        rom_once_t const& once = *rom_once_ht{i};
+
+        // Aligned onces are already where they want to be.
+        if(uses[i].empty() || once.desired_alignment > 1 || once.span.size < span_allocator_t::min_alloc_size)
+            continue;
+
+        double weight = 0;
+        for(page_use_t const& use : uses[i])
+            weight += use.weight;
+        hot.push_back({ weight, i });
+    }
+    std::sort(hot.begin(), hot.end(), [](hot_t const& a, hot_t const& b)
+    {
+        if(a.weight != b.weight)
+            return a.weight > b.weight;
+        return a.once_i < b.once_i;
+    });
+
+    layout_stats.num_hot = hot.size();
+
+    for(hot_t const& h : hot)
+    {
+        rom_once_t& once = *rom_once_ht{ h.once_i };
+        span_allocator_t& allocator = banks[once.bank].allocator_for(once);
+
+        std::array<double, 256> costs;
+        for(unsigned i = 0; i < 256; ++i)
+            costs[i] = page_cost(uses[h.once_i], i, once.span.size);
+
+        double const old_cost = costs[once.span.addr & 0xFF];
+        layout_stats.cycles_before += old_cost;
+
+        if(old_cost <= 0)
+            continue;
+
+        // Search every free span, including the one we'll leave behind:
+        span_t const old_span = once.span;
+        allocator.free(old_span);
+
+        span_t best = old_span;
+        double best_cost = old_cost;
+        allocator.for_each_unallocated([&](span_t free)
+        {
+            for(unsigned i = 0; i < 256; ++i)
+            {
+                if(costs[i] >= best_cost)
+                    continue;
+
+                unsigned addr = (free.addr & ~0xFFu) | i;
+                if(addr < free.addr)
+                    addr += 256;
+
+                span_t const at = { std::uint16_t(addr), old_span.size };
+                if(addr + old_span.size <= free.end())
+                {
+                    best = at;
+                    best_cost = costs[i];
+                }
+            }
+        });
+
+        span_allocation_t const allocated = allocator.alloc_at(best);
+        passert(allocated, best, old_span);
+        once.span = best;
+
+        layout_stats.cycles_after += best_cost;
+        if(best != old_span)
+            layout_stats.moves.push_back({ old_span, best, old_cost, best_cost });
+
+        dprint(log, "-PAGE_LAYOUT", old_span, best, old_cost, best_cost);
+    }
+}
+    
 void alloc_rom(log_t* log, span_allocator_t allocator)
 {
     rom_allocator_t alloc(log, allocator);
@@ -771,6 +1044,42 @@ void print_rom(std::ostream& o)
 
     o << "ROM:\n\n";
 
+    o << "RUNTIME:\n";
+    std::size_t mul_table_size = 0;
+    for(unsigned i = 0; i < NUM_RTROM; ++i)
+    {
+        auto const name = runtime_rom_name_t(i);
+        for(unsigned romv = 0; romv < NUM_ROMV; ++romv)
+        {
+            span_t const span = runtime_span(name, romv_t(romv));
+            if(!span)
+                continue;
+
+            o << name << ' ' << romv << ' ' << span << '\n';
+
+            if(name == RTROM_mul8_lo_table || name == RTROM_mul8_hi_table)
+                mul_table_size += span.size;
+        }
+    }
+    if(mul_table_size)
+        o << "fast multiply tables: " << mul_table_size << " bytes\n";
+    o << '\n';
+
+    o << "PAGE LAYOUT:\n";
+    o << "hot: " << layout_stats.num_hot << " moved: " << layout_stats.moves.size()
+      << " weighted cycles: " << layout_stats.cycles_before << " -> " << layout_stats.cycles_after << '\n';
+    for(auto const& move : layout_stats.moves)
+        o << "MOVED " << move.from << " -> " << move.to << " (" << move.cycles_before << " -> " << move.cycles_after << ")\n";
+    o << '\n';
+
+    if(mapper().data_window)
+    {
+        o << "DATA WINDOW:\n";
+        o << "arrays: " << window_stats.arrays << " (" << window_stats.array_bytes << " bytes)\n";
+        o << "procs not duplicated: " << window_stats.procs << " (" << window_stats.proc_bytes << " bytes)\n";
+        o << '\n';
+    }
+
     for(auto const& st : rom_static_ht::values())
     {
         o << "STATIC " << st.span << '\n';
@@ -789,7 +1098,7 @@ void print_rom(std::ostream& o)
     }
     for(auto const& once : rom_once_ht::values())
     {
-        o << "ONCE " << once.span << ' ' << (int)once.data.rclass() << " banks: " << once.bank << std::endl;
+        o << "ONCE " << once.span << ' ' << (int)once.data.rclass() << " banks: " << once.bank << (once.in_window ? " window" : "") << std::endl;
         sorted.emplace_back(once.span.size, once.span);
     }
 
@@ -2,6 +2,7 @@
 #define ROM_ALLOC_HPP
 
 #include <ostream>
+#include <vector>
 
 #include "debug_print.hpp"
 #include "span.hpp"
@@ -12,4 +13,35 @@ void alloc_rom(log_t* log, span_allocator_t allocator);
 
 void print_rom(std::ostream& o);
 
+// Estimated page-crossing penalties of hot code and data, in cycles.
+// Instructions are weighted by their loop depth, so these aren't real cycle counts.
+struct page_layout_stats_t
+{
+    struct move_t
+    {
+        span_t from;
+        span_t to;
+        double cycles_before;
+        double cycles_after;
+    };
+
+    unsigned num_hot = 0;
+    double cycles_before = 0;
+    double cycles_after = 0;
+    std::vector<move_t> moves;
+};
+
+page_layout_stats_t const& page_layout_stats();
+
+// What 'mapper().data_window' placed in the window, and the procs it kept from being duplicated.
+struct data_window_stats_t
+{
+    unsigned arrays = 0;
+    unsigned array_bytes = 0;
+    unsigned procs = 0; // Procs allocated once, which would otherwise be in every bank of their data.
+    unsigned proc_bytes = 0;
+};
+
+data_window_stats_t const& data_window_stats();
+
 #endif
@@ -1,6 +1,7 @@
 #include "rom_link.hpp"
 
 #include <stdexcept>
+#include <variant>
 #ifndef NDEBUG
 #include <iostream>
 #endif
@@ -14,6 +15,7 @@
 #include "globals.hpp"
 #include "compiler_error.hpp"
 #include "eval.hpp"
+#include "thread.hpp"
 
 // This gets called before ROM is allocated.
 void link_variables_optimize()
@@ -50,10 +52,17 @@ static void write_linked(
 
 std::vector<std::uint8_t> write_rom(std::uint8_t default_fill)
 {
-    for(rom_proc_t& rom_proc : rom_proc_ht::values())
+    // Each proc only modifies itself here:
     {
-        rom_proc.absolute_to_zp();
-        rom_proc.remove_banked_jsr();
+        std::vector<rom_proc_t*> rom_procs;
+        for(rom_proc_t& rom_proc : rom_proc_ht::values())
+            rom_procs.push_back(&rom_proc);
+
+        parallel_for_each(compiler_options().num_threads, rom_procs, [](rom_proc_t* rom_proc)
+        {
+            rom_proc->absolute_to_zp();
+            rom_proc->remove_banked_jsr();
+        });
     }
 
     std::size_t const header_size = mapper().ines_header_size();
@@ -75,7 +84,7 @@ std::vector<std::uint8_t> write_rom(std::uint8_t default_fill)
         return rom.data() + prg_rom_start + bank * mapper().bank_size() + span.addr - mapper().bank_span(bank).addr;
     };
 
-    auto const write = [&](auto const& alloc, bool stat = false)
+    auto const write = [&](auto const& alloc)
     {
         alloc.data.visit([&](rom_array_ht rom_array)
         {
@@ -91,17 +100,8 @@ std::vector<std::uint8_t> write_rom(std::uint8_t default_fill)
             asm_proc.link(alloc.romv, alloc.only_bank());
             asm_proc.relocate(locator_t::addr(alloc.span.addr));
 
-            if(asm_proc.fn)
-            {
-                if(asm_proc.fn->iasm)
-                    asm_proc.verify_addr_modes();
-
-                if(auto* os = asm_proc.fn->info_stream())
-                {
-                    *os << "\nLINK:\n";
-                    asm_proc.write_assembly(*os, alloc.romv);
-                }
-            }
+            if(asm_proc.fn && asm_proc.fn->iasm)
+                asm_proc.verify_addr_modes();
 
             alloc.for_each_bank([&](unsigned bank)
             {
@@ -110,12 +110,66 @@ std::vector<std::uint8_t> write_rom(std::uint8_t default_fill)
         });
     };
 
+    // Linking a proc only modifies that proc, reading the labels of others.
+    // Allocations also write disjoint parts of the ROM, so they can be written in parallel.
+    // Allocations sharing a proc (which happens when a romv falls back to another's proc)
+    // get grouped together, to be linked in their original order.
+    using alloc_ptr_t = std::variant<rom_static_t const*, rom_once_t const*, rom_many_t const*>;
+    std::vector<alloc_ptr_t> allocs;
+
     for(rom_static_t const& static_ : rom_static_ht::values())
-        write(static_, true);
+        allocs.push_back(&static_);
     for(rom_once_t const& once : rom_once_ht::values())
-        write(once);
+        allocs.push_back(&once);
     for(rom_many_t const& many : rom_many_ht::values())
-        write(many);
+        allocs.push_back(&many);
+
+    auto const alloc_proc = [](alloc_ptr_t ptr) -> asm_proc_t*
+    {
+        return std::visit([](auto const* alloc)
+        {
+            asm_proc_t* proc = nullptr;
+            alloc->data.visit([](rom_array_ht) {},
+                              [&](rom_proc_ht rom_proc) { proc = &rom_proc->asm_proc(alloc->romv); });
+            return proc;
+        }, ptr);
+    };
+
+    std::vector<std::vector<alloc_ptr_t>> link_groups;
+    rh::batman_map<asm_proc_t const*, unsigned> proc_groups;
+    for(alloc_ptr_t ptr : allocs)
+    {
+        if(asm_proc_t const* proc = alloc_proc(ptr))
+        {
+            auto result = proc_groups.insert({ proc, link_groups.size() });
+            if(!result.second)
+            {
+                link_groups[result.first->second].push_back(ptr);
+                continue;
+            }
+        }
+        link_groups.push_back({ ptr });
+    }
+
+    parallel_for_each(compiler_options().num_threads, link_groups, [&](std::vector<alloc_ptr_t> const& group)
+    {
+        for(alloc_ptr_t ptr : group)
+            std::visit([&](auto const* alloc) { write(*alloc); }, ptr);
+    });
+
+    // Write info serially, to keep its order deterministic:
+    for(alloc_ptr_t ptr : allocs)
+    {
+        asm_proc_t const* asm_proc = alloc_proc(ptr);
+        if(!asm_proc || !asm_proc->fn)
+            continue;
+
+        if(auto* os = asm_proc->fn->info_stream())
+        {
+            *os << "\nLINK:\n";
+            asm_proc->write_assembly(*os, std::visit([](auto const* alloc) { return alloc->romv; }, ptr));
+        }
+    }
 
     if(auto addr = mapper().this_bank_addr())
     {
@@ -123,6 +177,13 @@ std::vector<std::uint8_t> write_rom(std::uint8_t default_fill)
             *file_addr({ addr, 1 }, bank) = (bank << bank_shift()) + bank_add();
     }
 
+    // Interrupts read this to restore the data window:
+    if(auto addr = mapper().data_bank_addr())
+    {
+        for(unsigned bank = 0; bank < mapper().num_switched_prg_banks(); ++bank)
+            *file_addr({ addr, 1 }, bank) = (bank << bank_shift()) + bank_add();
+    }
+
     if(chr_rom_size)
     {
         using chr_span_t = generic_span_t<std::uint32_t>;
@@ -97,6 +97,13 @@ ram_bitset_t alloc_runtime_ram()
         _rtram_spans[RTRAM_nmi_saved_bank] = {{ a.alloc_zp(1) }};
         if(!fn_t::solo_irq())
             _rtram_spans[RTRAM_irq_saved_bank] = {{ a.alloc_zp(1) }};
+
+        if(mapper().data_window)
+        {
+            _rtram_spans[RTRAM_nmi_saved_data_bank] = {{ a.alloc_zp(1) }};
+            if(!fn_t::solo_irq())
+                _rtram_spans[RTRAM_irq_saved_data_bank] = {{ a.alloc_zp(1) }};
+        }
     }
 
     if(compiler_options().nes_system == NES_SYSTEM_DETECT)
@@ -472,6 +479,20 @@ static void lda_this_bank(asm_proc_t& proc)
         proc.push_inst(LDA_IMMEDIATE, locator_t::this_bank());
 }
 
+// Switches the data window to the bank in A, without changing the code bank.
+// Clobbers X.
+static void window_switch_a(asm_proc_t& proc)
+{
+    assert(mapper().data_window);
+    assert(mapper().type == MAPPER_MMC3);
+
+    proc.push_inst(LDX_IMMEDIATE, locator_t::const_byte(0b111111));
+    if(!compiler_options().unsafe_bank_switch)
+        proc.push_inst(STX_ABSOLUTE, locator_t::runtime_ram(RTRAM_mapper_detail));
+    proc.push_inst(STX_ABSOLUTE, locator_t::addr(0x8000));
+    proc.push_inst(STA_ABSOLUTE, locator_t::addr(0x8001));
+}
+
 static asm_proc_t make_irq()
 {
     asm_proc_t proc;
@@ -515,6 +536,13 @@ static asm_proc_t make_irq()
         lda_this_bank(proc);
         proc.push_inst(STA_ABSOLUTE, locator_t::runtime_ram(RTRAM_irq_saved_bank));
 
+        if(mapper().data_window)
+        {
+            // The data window can hold a different bank than our code:
+            proc.push_inst(LDA_ABSOLUTE, locator_t::addr(mapper().data_bank_addr()));
+            proc.push_inst(STA_ABSOLUTE, locator_t::runtime_ram(RTRAM_irq_saved_data_bank));
+        }
+
         proc.push_inst(LAX_ABSOLUTE_Y, locator_t::runtime_rom(RTROM_irq_bank_table));
         next_label = bankswitch_a(proc, next_label, true);
     }
@@ -533,6 +561,12 @@ static asm_proc_t make_irq_exit()
     {
         proc.push_inst(LAX_ABSOLUTE, locator_t::runtime_ram(RTRAM_irq_saved_bank));
         bankswitch_a(proc, 0, true);
+
+        if(mapper().data_window)
+        {
+            proc.push_inst(LDA_ABSOLUTE, locator_t::runtime_ram(RTRAM_irq_saved_data_bank));
+            window_switch_a(proc);
+        }
     }
 
     if(mmc3_variant() && !compiler_options().unsafe_bank_switch)
@@ -602,6 +636,13 @@ static asm_proc_t make_nmi()
         lda_this_bank(proc);
         proc.push_inst(STA_ABSOLUTE, locator_t::runtime_ram(RTRAM_nmi_saved_bank));
 
+        if(mapper().data_window)
+        {
+            // The data window can hold a different bank than our code:
+            proc.push_inst(LDA_ABSOLUTE, locator_t::addr(mapper().data_bank_addr()));
+            proc.push_inst(STA_ABSOLUTE, locator_t::runtime_ram(RTRAM_nmi_saved_data_bank));
+        }
+
         proc.push_inst(LAX_ABSOLUTE_Y, locator_t::runtime_rom(RTROM_nmi_bank_table));
         next_label = bankswitch_a(proc, next_label, true);
     }
@@ -620,6 +661,12 @@ static asm_proc_t make_nmi_exit()
     {
         proc.push_inst(LAX_ABSOLUTE, locator_t::runtime_ram(RTRAM_nmi_saved_bank));
         bankswitch_a(proc, 0, true);
+
+        if(mapper().data_window)
+        {
+            proc.push_inst(LDA_ABSOLUTE, locator_t::runtime_ram(RTRAM_nmi_saved_data_bank));
+            window_switch_a(proc);
+        }
     }
     proc.push_inst(INC_ABSOLUTE, locator_t::runtime_ram(RTRAM_nmi_counter));
 
@@ -892,7 +939,7 @@ static asm_proc_t make_reset_proc()
     }
 
     // Init vars
-    gen_group_var_inits(gvar_t::groupless_gvars(), proc);
+    gen_group_var_inits(gvar_t::groupless_gvars(), proc, "/");
 
     // Jump to our entry point.
     if(mapper().bankswitches())
@@ -1042,6 +1089,120 @@ asm_proc_t make_mul8()
     return proc;
 }
 
+// Restoring division of a 16-bit dividend by an 8-bit divisor.
+// The high byte of the dividend must be less than the divisor,
+// so that the quotient fits in a byte.
+// Dividing by zero results in a quotient of $FF.
+// @param A high byte of dividend
+// @param X low byte of dividend
+// @param Y divisor
+// @return quotient in A; remainder in Y
+// Preserves X.
+static asm_proc_t make_div8()
+{
+    asm_proc_t proc;
+
+    unsigned next_label_id = 0;
+
+    locator_t const loop = proc.make_label(++next_label_id);
+    locator_t const subtract = proc.make_label(++next_label_id);
+    locator_t const skip = proc.make_label(++next_label_id);
+    locator_t const quotient = locator_t::runtime_ram(RTRAM_ptr_temp, 0);
+    locator_t const divisor = locator_t::runtime_ram(RTRAM_ptr_temp, 1);
+
+    proc.push_inst(STY_ZERO_PAGE, divisor);
+    proc.push_inst(STX_ZERO_PAGE, quotient);
+    proc.push_inst(LDY_IMMEDIATE, locator_t::const_byte(8));
+    proc.push_inst(ASM_LABEL, loop);
+    proc.push_inst(ASL_ZERO_PAGE, quotient);
+    proc.push_inst(ROL_IMPLIED);
+    proc.push_inst(BCS_RELATIVE, subtract); // The remainder exceeded 8 bits.
+    proc.push_inst(CMP_ZERO_PAGE, divisor);
+    proc.push_inst(BCC_RELATIVE, skip);
+    proc.push_inst(ASM_LABEL, subtract);
+    proc.push_inst(SBC_ZERO_PAGE, divisor); // Carry is always set here.
+    proc.push_inst(INC_ZERO_PAGE, quotient);
+    proc.push_inst(ASM_LABEL, skip);
+    proc.push_inst(DEY_IMPLIED);
+    proc.push_inst(BNE_RELATIVE, loop);
+    proc.push_inst(TAY_IMPLIED);
+    proc.push_inst(LDA_ZERO_PAGE, quotient);
+    proc.push_inst(RTS_IMPLIED);
+
+    proc.initial_optimize();
+    return proc;
+}
+
+// Quarter-square multiplication: a*b = f(a+b) - f(|a-b|), where f(n) = floor(n*n/4).
+// (Flooring is exact here, as a+b and a-b always have the same parity.)
+// The tables hold f(n) for n in [0, 512), and are expected to be page-aligned.
+// @param A one factor
+// @param Y another factor
+// @return low 8 bits in A; high 8 bits in Y
+// Clobbers X.
+static asm_proc_t make_fast_mul8()
+{
+    asm_proc_t proc;
+
+    unsigned next_label_id = 0;
+
+    locator_t const positive = proc.make_label(++next_label_id);
+    locator_t const high_page = proc.make_label(++next_label_id);
+    locator_t const factor1 = locator_t::runtime_ram(RTRAM_ptr_temp, 0);
+    locator_t const factor2 = locator_t::runtime_ram(RTRAM_ptr_temp, 1);
+    locator_t const prodlo = factor1;
+
+    proc.push_inst(STA_ZERO_PAGE, factor1);
+    proc.push_inst(STY_ZERO_PAGE, factor2);
+
+    // X = |a-b|
+    proc.push_inst(SEC_IMPLIED);
+    proc.push_inst(SBC_ZERO_PAGE, factor2);
+    proc.push_inst(BCS_RELATIVE, positive);
+    proc.push_inst(EOR_IMMEDIATE, locator_t::const_byte(0xFF));
+    proc.push_inst(ADC_IMMEDIATE, locator_t::const_byte(1));
+    proc.push_inst(ASM_LABEL, positive);
+    proc.push_inst(TAX_IMPLIED);
+
+    // Y = a+b, with the 9th bit in carry
+    proc.push_inst(LDA_ZERO_PAGE, factor1);
+    proc.push_inst(CLC_IMPLIED);
+    proc.push_inst(ADC_ZERO_PAGE, factor2);
+    proc.push_inst(TAY_IMPLIED);
+    proc.push_inst(BCS_RELATIVE, high_page);
+
+    for(unsigned page = 0; page < 2; ++page)
+    {
+        if(page)
+            proc.push_inst(ASM_LABEL, high_page);
+
+        proc.push_inst(LDA_ABSOLUTE_Y, locator_t::runtime_rom(RTROM_mul8_lo_table, page * 256));
+        proc.push_inst(SEC_IMPLIED);
+        proc.push_inst(SBC_ABSOLUTE_X, locator_t::runtime_rom(RTROM_mul8_lo_table));
+        proc.push_inst(STA_ZERO_PAGE, prodlo);
+        proc.push_inst(LDA_ABSOLUTE_Y, locator_t::runtime_rom(RTROM_mul8_hi_table, page * 256));
+        proc.push_inst(SBC_ABSOLUTE_X, locator_t::runtime_rom(RTROM_mul8_hi_table));
+        proc.push_inst(TAY_IMPLIED);
+        proc.push_inst(LDA_ZERO_PAGE, prodlo);
+        proc.push_inst(RTS_IMPLIED);
+    }
+
+    proc.initial_optimize();
+    return proc;
+}
+
+static loc_vec_t make_quarter_square_table(bool hi)
+{
+    loc_vec_t ret;
+    ret.reserve(512);
+    for(unsigned i = 0; i < 512; ++i)
+    {
+        unsigned const f = (i * i) / 4;
+        ret.push_back(locator_t::const_byte(hi ? (f >> 8) : f));
+    }
+    return ret;
+}
+
 static loc_vec_t make_iota()
 {
     loc_vec_t ret;
@@ -1230,7 +1391,16 @@ span_allocator_t alloc_runtime_rom()
         alloc(RTROM_jmp_trampoline, make_jmp_trampoline(), ROMVF_ALL);
     }
 
-    alloc(RTROM_mul8, make_mul8(), ROMVF_ALL);
+    if(compiler_options().fast_mul)
+    {
+        alloc(RTROM_mul8_lo_table, make_quarter_square_table(false), ROMVF_IN_MODE, 256);
+        alloc(RTROM_mul8_hi_table, make_quarter_square_table(true), ROMVF_IN_MODE, 256);
+        alloc(RTROM_mul8, make_fast_mul8(), ROMVF_ALL);
+    }
+    else
+        alloc(RTROM_mul8, make_mul8(), ROMVF_ALL);
+
+    alloc(RTROM_div8, make_div8(), ROMVF_ALL);
 
     if(has_mapper_reset())
     {
@@ -20,12 +20,14 @@ RT(nmi_index) \
 RT(nmi_saved_x) \
 RT(nmi_saved_y) \
 RT(nmi_saved_bank) \
+RT(nmi_saved_data_bank) \
 RT(nmi_counter) \
 RT(nmi_ready) \
 RT(irq_index) \
 RT(irq_saved_x) \
 RT(irq_saved_y) \
 RT(irq_saved_bank) \
+RT(irq_saved_data_bank) \
 RT(mapper_state) \
 RT(mapper_detail) \
 RT(system) \
@@ -59,6 +61,9 @@ RT(jsr_trampoline) \
 RT(jmp_indirect) \
 RT(iota) \
 RT(mul8) \
+RT(mul8_lo_table) \
+RT(mul8_hi_table) \
+RT(div8) \
 RT(mapper_reset) \
 RT(shl4_table) \
 RT(shl5_table) \
@@ -106,6 +106,14 @@ public:
 
     span_t unallocated_span_at(std::uint16_t addr) const;
 
+    // Iterates free spans in address order.
+    template<typename Fn>
+    void for_each_unallocated(Fn const& fn) const
+    {
+        for(treap_node_t const& node : treap)
+            fn(node.span);
+    }
+
     std::uint16_t bytes_free() const { return m_bytes_free; }
     std::uint16_t initial_bytes_free() const { return m_initial_bytes_free; }
     std::size_t spans_free() const { return treap.size(); }
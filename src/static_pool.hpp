@@ -14,7 +14,7 @@
 #include "intrusive_pool.hpp"
 #include "thread.hpp"
 
-template<typename T, typename Tag = T>
+template<typename T, typename Tag = T, typename Hot = void>
 class static_intrusive_pool_t;
 
 // This pool can hold any type, but only 1 type at a time (you must call
@@ -131,10 +131,16 @@ public:
     };
 };
 
-template<typename T, typename Tag>
+// 'Hot' optionally holds per-node fields that get scanned often.
+// They're stored in their own array, parallel to the pool and indexed by handle,
+// so that scanning them doesn't pull entire nodes into the cache.
+template<typename T, typename Tag, typename Hot>
 class static_intrusive_pool_t
 {
 public:
+    static constexpr bool has_hot = !std::is_void<Hot>::value;
+    using hot_t = std::conditional_t<has_hot, Hot, char>;
+
     struct handle_t : public intrusive_pool_t<T>::handle_t
     {
         T& operator*() const { assert(valid()); return this->get(*pool_ptr()); }
@@ -151,6 +157,8 @@ public:
         template<typename U>
         U& data() const { assert(this->id < pool().array_size()); return static_any_pool_t<Tag>::template get<U>(this->id); }
 
+        hot_t& hot() const { static_assert(has_hot); assert(this->id < hot_storage().size()); return hot_ptr()[this->id]; }
+
         static bool valid() { return &pool() == pool_ptr(); }
     };
 private:
@@ -166,6 +174,18 @@ private:
         static TLS intrusive_pool_t<T>* _pool_ptr;
         return _pool_ptr; 
     }
+
+    static auto& hot_storage() 
+    { 
+        static TLS std::vector<hot_t> _hot_storage;
+        return _hot_storage; 
+    }
+
+    static auto& hot_ptr() 
+    { 
+        static TLS hot_t* _hot_ptr;
+        return _hot_ptr; 
+    }
 #else
     inline static TLS intrusive_pool_t<T> _pool;
 
@@ -173,18 +193,55 @@ private:
     // (This exists to reduce penalty of __tls_init)
     inline static TLS intrusive_pool_t<T>* _pool_ptr;
 
+    inline static TLS std::vector<hot_t> _hot_storage;
+
+    // Points to 'hot_storage.data()', for the same reason as '_pool_ptr'.
+    inline static TLS hot_t* _hot_ptr;
+
     static auto& pool() { return _pool; }
     static auto& pool_ptr() { return _pool_ptr; }
+    static auto& hot_storage() { return _hot_storage; }
+    static auto& hot_ptr() { return _hot_ptr; }
 #endif
+
+    static void resize_hot()
+    {
+        if constexpr(has_hot)
+        {
+            hot_storage().resize(pool().array_size());
+            hot_ptr() = hot_storage().data();
+        }
+    }
 public:
-    static void init() { pool_ptr() = &pool(); (void)pool().data(); }
-    static handle_t alloc() { return { pool().alloc().id }; }
+    static void init() { pool_ptr() = &pool(); (void)pool().data(); resize_hot(); }
+
+    static handle_t alloc() 
+    { 
+        handle_t const h = { pool().alloc().id }; 
+        if constexpr(has_hot)
+            if(h.id >= hot_storage().size())
+                resize_hot();
+        return h;
+    }
+
     static void free(handle_t h) { pool().free({ h.id }); }
-    static void clear() { pool().clear(); }
+
+    static void clear() 
+    { 
+        pool().clear(); 
+        if constexpr(has_hot)
+        {
+            hot_storage().clear();
+            resize_hot();
+        }
+    }
 
     static std::size_t size() { return pool().size(); }
     static std::size_t array_size() { return pool().array_size(); }
-    static T* data() { return pool().data(); }
+    static T* data() { assert(handle_t::valid()); return pool_ptr()->data(); }
+
+    // Iterates the hot fields of every slot, including freed ones.
+    static hot_t* hot_data() { static_assert(has_hot); return hot_ptr(); }
 };
 
 #endif
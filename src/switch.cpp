@@ -1,8 +1,12 @@
 #include "switch.hpp"
 
+#include <array>
+
+#include <boost/container/small_vector.hpp>
 #include <boost/container/static_vector.hpp>
 
 #include "ir.hpp"
+#include "ir_algo.hpp"
 
 namespace bc = ::boost::container;
 
@@ -37,10 +41,8 @@ bool switch_partial_to_full(ssa_node_t& switch_node)
     return true;
 }
 
-bool switch_partial_to_full(ir_t& ir)
+namespace
 {
-    bool updated = false;
-
     struct rep_t
     {
         std::uint16_t rshift;
@@ -50,7 +52,7 @@ bool switch_partial_to_full(ir_t& ir)
         std::uint16_t popcount;
     };
 
-    auto calc_rep = [](static_bitset_t<256> const& cases)
+    rep_t calc_rep(static_bitset_t<256> const& cases)
     {
         if(cases.all_clear())
             return rep_t{};
@@ -92,117 +94,417 @@ bool switch_partial_to_full(ir_t& ir)
         result.popcount = cases.popcount();
 
         return result;
+    }
+
+    // Rough 6502 costs of each lowering strategy:
+    constexpr unsigned TABLE_BYTES = 17;    // Range check, then the RTS trick.
+    constexpr unsigned TABLE_CYCLES = 31;
+    constexpr unsigned SHIFT_BYTES = 3;     // LSR, BCS for each common bit shifted out.
+    constexpr unsigned SHIFT_CYCLES = 4;
+    constexpr unsigned COMPARE_BYTES = 4;   // CMP, then a branch.
+    constexpr unsigned COMPARE_CYCLES = 5;
+    constexpr unsigned MAX_CHAIN = 4;       // Longest sequence of equality tests.
+
+    enum plan_kind_t : std::uint8_t
+    {
+        PLAN_TABLE, // Jump table.
+        PLAN_CHAIN, // Sequence of equality tests.
+        PLAN_SPLIT, // Binary search; a less-than test.
     };
 
-    for(cfg_ht cfg_it = ir.cfg_begin(); cfg_it; ++cfg_it)
+    struct plan_t
     {
-        ssa_ht const branch = cfg_it->last_daisy();
-        
-        if(!branch || branch->op() != SSA_switch_partial)
-            continue;
+        unsigned bytes = 0;
+        unsigned cycles = 0; // Summed over every case, so not an average.
+        std::uint64_t score = ~0ull;
+        plan_kind_t kind = PLAN_TABLE;
+        std::uint8_t split = 0; // For PLAN_SPLIT, the last case of the left half.
+    };
 
-        // Gather all cases into 'cases':
-        static_bitset_t<256> cases = {};
-        unsigned const input_size = branch->input_size();
-        for(unsigned i = 1; i < input_size; ++i)
-            cases.set(std::uint8_t(branch->input(i).whole()));
+    // Picks the cheapest way to lower a sorted list of cases, trading bytes for cycles.
+    // 'cycle_weight' scales the cost of cycles, and comes from the loop depth.
+    class switch_planner_t
+    {
+    public:
+        switch_planner_t(std::vector<std::uint8_t> const& values, std::uint64_t cycle_weight)
+        : values(values)
+        , n(values.size())
+        , cycle_weight(cycle_weight)
+        , plans(n * n)
+        {
+            for(unsigned len = 1; len <= n; ++len)
+            for(unsigned i = 0; i + len <= n; ++i)
+                plan(i, i + len - 1);
+        }
 
-        // Calculate
-        auto const rep = calc_rep(cases);
+        plan_t const& operator()(unsigned i, unsigned j) const { return plans[i * n + j]; }
 
-        // Transform the branch.
+        std::uint64_t score(unsigned bytes, unsigned cycles) const 
+            { return std::uint64_t(bytes) * n + std::uint64_t(cycles) * cycle_weight; }
 
-        cfg_ht const default_cfg = cfg_it->output(0); // Where the 'default' case leads.
-        cfg_ht const entry = ir.emplace_cfg(cfg_it->prop_flags());
-        cfg_ht current_cfg = entry;
-        ssa_value_t current_ssa = branch->input(0);
-        type_t const condition_type = current_ssa.type();
+        static unsigned table_bytes(unsigned rshift, unsigned entries)
+            { return TABLE_BYTES + SHIFT_BYTES * rshift + entries * 2; }
 
-        auto const do_branch = [&](bool swap)
+        static unsigned table_cycles(unsigned rshift, unsigned cases)
+            { return (TABLE_CYCLES + SHIFT_CYCLES * rshift) * cases; }
+
+    private:
+        void plan(unsigned i, unsigned j)
         {
-            cfg_ht next_cfg = ir.emplace_cfg(cfg_it->prop_flags());
+            plan_t& best = plans[i * n + j];
+            unsigned const count = j - i + 1;
 
-            current_cfg->alloc_output(1);
-            current_cfg->build_set_output(0, next_cfg);
+            auto const consider = [&](plan_t candidate)
+            {
+                candidate.score = score(candidate.bytes, candidate.cycles);
+                if(candidate.score < best.score)
+                    best = candidate;
+            };
 
-            current_cfg->link_append_output(default_cfg, [&](ssa_ht phi)
+            // Table:
             {
-                return phi->input(cfg_it->output_edge(0).index);
-            });
+                std::uint8_t mismatch = 0;
+                for(unsigned k = i; k <= j; ++k)
+                    mismatch |= values[k] ^ values[i];
+                unsigned const rshift = mismatch ? builtin::ctz(mismatch) : 0;
+                unsigned const entries = ((values[j] - values[i]) >> rshift) + 1;
+
+                consider({ .bytes = table_bytes(rshift, entries), 
+                           .cycles = table_cycles(rshift, count), 
+                           .kind = PLAN_TABLE });
+            }
+
+            // Chain:
+            if(count <= MAX_CHAIN)
+            {
+                consider({ .bytes = COMPARE_BYTES * count, 
+                           .cycles = COMPARE_CYCLES * count + 2 * count * (count - 1), 
+                           .kind = PLAN_CHAIN });
+            }
+
+            // Split:
+            for(unsigned k = i; k < j; ++k)
+            {
+                plan_t const& l = (*this)(i, k);
+                plan_t const& r = (*this)(k + 1, j);
+                consider({ .bytes = COMPARE_BYTES + l.bytes + r.bytes, 
+                           .cycles = COMPARE_CYCLES * count + l.cycles + r.cycles, 
+                           .kind = PLAN_SPLIT, .split = std::uint8_t(k) });
+            }
+        }
 
-            if(swap)
-                current_cfg->link_swap_outputs(0, 1);
+        std::vector<std::uint8_t> const& values;
+        unsigned const n;
+        std::uint64_t const cycle_weight;
+        std::vector<plan_t> plans;
+    };
+}
+
+std::string_view to_string(switch_strategy_t strategy)
+{
+    switch(strategy)
+    {
+    case SWITCH_TABLE:     return "table";
+    case SWITCH_TREE:      return "tree";
+    case SWITCH_CLUSTERED: return "clustered";
+    default: return "?";
+    }
+}
+
+// Lowers a single SSA_switch_partial into a range check, shifts, and a SSA_switch_full.
+static void _lower_table(ir_t& ir, cfg_ht cfg_it)
+{
+    ssa_ht const branch = cfg_it->last_daisy();
+    assert(branch && branch->op() == SSA_switch_partial);
+
+    // Gather all cases into 'cases':
+    static_bitset_t<256> cases = {};
+    unsigned const input_size = branch->input_size();
+    for(unsigned i = 1; i < input_size; ++i)
+        cases.set(std::uint8_t(branch->input(i).whole()));
+
+    // Calculate
+    auto const rep = calc_rep(cases);
+
+    // Transform the branch.
+
+    cfg_ht const default_cfg = cfg_it->output(0); // Where the 'default' case leads.
+    cfg_ht const entry = ir.emplace_cfg(cfg_it->prop_flags());
+    cfg_ht current_cfg = entry;
+    ssa_value_t current_ssa = branch->input(0);
+    type_t const condition_type = current_ssa.type();
+
+    auto const do_branch = [&](bool swap)
+    {
+        cfg_ht next_cfg = ir.emplace_cfg(cfg_it->prop_flags());
+
+        current_cfg->alloc_output(1);
+        current_cfg->build_set_output(0, next_cfg);
+
+        current_cfg->link_append_output(default_cfg, [&](ssa_ht phi)
+        {
+            return phi->input(cfg_it->output_edge(0).index);
+        });
+
+        if(swap)
+            current_cfg->link_swap_outputs(0, 1);
+
+        current_cfg = next_cfg;
+    };
 
-            current_cfg = next_cfg;
-        };
+    // Comparisons:
 
-        // Comparisons:
+    if(current_ssa.type() != TYPE_U)
+        current_ssa = current_cfg->emplace_ssa(SSA_cast, TYPE_U, current_ssa);
 
-        if(current_ssa.type() != TYPE_U)
-            current_ssa = current_cfg->emplace_ssa(SSA_cast, TYPE_U, current_ssa);
+    current_ssa = current_cfg->emplace_ssa(SSA_sub, TYPE_U, current_ssa, ssa_value_t(rep.start, TYPE_U), ssa_value_t(1u, TYPE_BOOL));
+    ssa_ht const less = current_cfg->emplace_ssa(SSA_lt, TYPE_BOOL, current_ssa, ssa_value_t(rep.size, TYPE_U));
+    ssa_ht const if_ = current_cfg->emplace_ssa(SSA_if, TYPE_VOID, less);
+    if_->append_daisy();
+    do_branch(true);
 
-        current_ssa = current_cfg->emplace_ssa(SSA_sub, TYPE_U, current_ssa, ssa_value_t(rep.start, TYPE_U), ssa_value_t(1u, TYPE_BOOL));
-        ssa_ht const less = current_cfg->emplace_ssa(SSA_lt, TYPE_BOOL, current_ssa, ssa_value_t(rep.size, TYPE_U));
-        ssa_ht const if_ = current_cfg->emplace_ssa(SSA_if, TYPE_VOID, less);
+    // Shift:
+    for(unsigned i = 0 ; i < rep.rshift; ++i)
+    {
+        current_ssa = current_cfg->emplace_ssa(SSA_ror, condition_type, current_ssa, ssa_value_t(0u, TYPE_BOOL));
+        ssa_ht const carry_out = current_cfg->emplace_ssa(SSA_carry, TYPE_BOOL, current_ssa);
+        ssa_ht const if_ = current_cfg->emplace_ssa(SSA_if, TYPE_VOID, carry_out);
         if_->append_daisy();
-        do_branch(true);
+        assert(((rep.common - rep.start) & ((1 << rep.rshift) - 1)) == 0);
+        do_branch(false);
+    }
+
+    ir.assert_valid();
+
+    // Rewrite the switch and move it 'current_cfg': 
+
+    assert(input_size == branch->input_size());
+    branch->link_change_input(0, current_ssa);
+    for(unsigned i = 1; i < input_size; ++i)
+    {
+        std::uint8_t v = branch->input(i).whole();
+        v -= rep.start;
+        v >>= rep.rshift;
+        branch->link_change_input(i, ssa_value_t(v, TYPE_U));
+    }
 
-        // Shift:
-        for(unsigned i = 0 ; i < rep.rshift; ++i)
+    for(unsigned i = 0, j = 0; i < rep.size; i += 1 << rep.rshift, ++j)
+    {
+        std::uint8_t const c = rep.start + i;
+        if(!cases.test(c))
         {
-            current_ssa = current_cfg->emplace_ssa(SSA_ror, condition_type, current_ssa, ssa_value_t(0u, TYPE_BOOL));
-            ssa_ht const carry_out = current_cfg->emplace_ssa(SSA_carry, TYPE_BOOL, current_ssa);
-            ssa_ht const if_ = current_cfg->emplace_ssa(SSA_if, TYPE_VOID, carry_out);
-            if_->append_daisy();
-            assert(((rep.common - rep.start) & ((1 << rep.rshift) - 1)) == 0);
-            do_branch(false);
+            branch->link_append_input(ssa_value_t(j, TYPE_U));
+            cfg_it->link_append_output(cfg_it->output(0), [&](ssa_ht phi)
+            {
+                return phi->input(cfg_it->output_edge(0).index);
+            });
         }
+    }
 
-        ir.assert_valid();
+    ir.assert_valid();
+
+    bool const result = switch_partial_to_full(*branch);
+    assert(result);
+
+    ir.assert_valid();
+
+    current_cfg->steal_outputs(*cfg_it);
+    current_cfg->steal_ssa(branch, true);
+
+    // Final link
+
+    assert(cfg_it->output_size() == 0);
+    cfg_it->link_append_output(entry, [](ssa_ht){ assert(false); return ssa_value_t(); });
+}
+
+bool switch_partial_to_full(ir_t& ir, std::vector<switch_lowering_t>* lowerings)
+{
+    bool updated = false;
+    bool built_loops = false;
+
+    bc::small_vector<cfg_ht, 16> switches;
+    for(cfg_ht cfg_it = ir.cfg_begin(); cfg_it; ++cfg_it)
+    {
+        ssa_ht const branch = cfg_it->last_daisy();
+        if(branch && branch->op() == SSA_switch_partial)
+            switches.push_back(cfg_it);
+    }
 
-        // Rewrite the switch and move it 'current_cfg': 
+    std::vector<std::uint8_t> values;
+    std::vector<unsigned> outputs;
+    bc::small_vector<cfg_ht, 8> tables;
 
-        assert(input_size == branch->input_size());
-        branch->link_change_input(0, current_ssa);
+    for(cfg_ht cfg_it : switches)
+    {
+        ssa_ht const branch = cfg_it->last_daisy();
+        assert(branch && branch->op() == SSA_switch_partial);
+
+        // Sort the cases by value, tracking which output each one takes:
+        static_bitset_t<256> cases = {};
+        std::array<std::uint8_t, 256> case_output;
+        unsigned const input_size = branch->input_size();
         for(unsigned i = 1; i < input_size; ++i)
         {
-            std::uint8_t v = branch->input(i).whole();
-            v -= rep.start;
-            v >>= rep.rshift;
-            branch->link_change_input(i, ssa_value_t(v, TYPE_U));
+            std::uint8_t const c = branch->input(i).whole();
+            cases.set(c);
+            case_output[c] = i;
+        }
+
+        values.clear();
+        outputs.clear();
+        cases.for_each([&](std::uint8_t c)
+        {
+            values.push_back(c);
+            outputs.push_back(case_output[c]);
+        });
+
+        switch_lowering_t lowering = { .cfg = cfg_it, .cases = unsigned(values.size()) };
+
+        if(values.empty())
+        {
+            _lower_table(ir, cfg_it);
+            goto done;
         }
 
-        for(unsigned i = 0, j = 0; i < rep.size; i += 1 << rep.rshift, ++j)
         {
-            std::uint8_t const c = rep.start + i;
-            if(!cases.test(c))
+            // Code in loops runs more often, which makes cycles matter more than bytes:
+            if(!built_loops)
+            {
+                build_loops_and_order(ir);
+                built_loops = true;
+            }
+            lowering.weight = depth_exp(loop_depth(cfg_it));
+
+            switch_planner_t const planner(values, lowering.weight);
+            plan_t const& best = planner(0, values.size() - 1);
+
+            // A single table can wrap around, making it cheaper than the planner's estimate:
+            rep_t const rep = calc_rep(cases);
+            unsigned const entries = ((rep.size - 1) >> rep.rshift) + 1;
+            unsigned const table_bytes = planner.table_bytes(rep.rshift, entries);
+            if(planner.score(table_bytes, planner.table_cycles(rep.rshift, values.size())) <= best.score)
+            {
+                lowering.tables = 1;
+                lowering.table_entries = entries;
+                lowering.bytes = table_bytes;
+                _lower_table(ir, cfg_it);
+                goto done;
+            }
+
+            lowering.bytes = best.bytes;
+
+            // Otherwise build a search tree, 
+            // with leaves that are either chains of comparisons or smaller tables.
+
+            ssa_value_t condition = branch->input(0);
+            if(condition.type() != TYPE_U)
+                condition = cfg_it->emplace_ssa(SSA_cast, TYPE_U, condition);
+
+            // Links 'from' to the same place the switch's output went:
+            auto const link_output = [&](cfg_ht from, unsigned output)
             {
-                branch->link_append_input(ssa_value_t(j, TYPE_U));
-                cfg_it->link_append_output(cfg_it->output(0), [&](ssa_ht phi)
+                from->link_append_output(cfg_it->output(output), [&](ssa_ht phi)
                 {
-                    return phi->input(cfg_it->output_edge(0).index);
+                    return phi->input(cfg_it->output_edge(output).index);
                 });
-            }
-        }
+            };
 
-        ir.assert_valid();
+            auto const link_new = [](cfg_ht from, cfg_ht to)
+            {
+                from->link_append_output(to, [](ssa_ht){ assert(false); return ssa_value_t(); });
+            };
+
+            auto const branch_on = [](cfg_ht cfg, ssa_op_t op, ssa_value_t lhs, std::uint8_t rhs)
+            {
+                ssa_ht const test = cfg->emplace_ssa(op, TYPE_BOOL, lhs, ssa_value_t(rhs, TYPE_U));
+                cfg->emplace_ssa(SSA_if, TYPE_VOID, test)->append_daisy();
+            };
 
-        bool const result = switch_partial_to_full(*branch);
-        assert(result);
+            tables.clear();
 
-        ir.assert_valid();
+            auto const build = [&](auto const& self, cfg_ht cfg, unsigned i, unsigned j) -> void
+            {
+                plan_t const& plan = planner(i, j);
 
-        current_cfg->steal_outputs(*cfg_it);
-        current_cfg->steal_ssa(branch, true);
+                switch(plan.kind)
+                {
+                case PLAN_TABLE:
+                    {
+                        ssa_ht const sub_switch = cfg->emplace_ssa(SSA_switch_partial, TYPE_VOID);
+                        sub_switch->alloc_input(j - i + 2);
+                        sub_switch->build_set_input(0, condition);
+                        for(unsigned k = i; k <= j; ++k)
+                            sub_switch->build_set_input(k - i + 1, ssa_value_t(values[k], TYPE_U));
+                        sub_switch->append_daisy();
+
+                        link_output(cfg, 0);
+                        for(unsigned k = i; k <= j; ++k)
+                            link_output(cfg, outputs[k]);
+
+                        tables.push_back(cfg);
+                        lowering.tables += 1;
+                        lowering.table_entries += values[j] - values[i] + 1;
+                    }
+                    break;
+
+                case PLAN_CHAIN:
+                    for(unsigned k = i; k <= j; ++k)
+                    {
+                        branch_on(cfg, SSA_eq, condition, values[k]);
+                        lowering.compares += 1;
+
+                        // The last test fails to the default case:
+                        cfg_ht const next = (k == j) ? cfg_ht{} : ir.emplace_cfg(cfg_it->prop_flags());
+                        if(next)
+                            link_new(cfg, next);
+                        else
+                            link_output(cfg, 0);
+                        link_output(cfg, outputs[k]);
+                        cfg = next;
+                    }
+                    break;
+
+                case PLAN_SPLIT:
+                    {
+                        branch_on(cfg, SSA_lt, condition, values[plan.split + 1]);
+                        lowering.compares += 1;
+
+                        cfg_ht const left = ir.emplace_cfg(cfg_it->prop_flags());
+                        cfg_ht const right = ir.emplace_cfg(cfg_it->prop_flags());
+                        link_new(cfg, right);
+                        link_new(cfg, left);
+
+                        self(self, left, i, plan.split);
+                        self(self, right, plan.split + 1, j);
+                    }
+                    break;
+                }
+            };
+
+            cfg_ht const entry = ir.emplace_cfg(cfg_it->prop_flags());
+            build(build, entry, 0, values.size() - 1);
+
+            // Replace the original switch with the tree:
+            branch->prune();
+            cfg_it->link_shrink_outputs(0);
+            link_new(cfg_it, entry);
+
+            ir.assert_valid();
+
+            for(cfg_ht table : tables)
+                _lower_table(ir, table);
+        }
 
-        // Final link
+    done:
+        lowering.strategy = (lowering.compares == 0 ? SWITCH_TABLE 
+                             : lowering.tables == 0 ? SWITCH_TREE : SWITCH_CLUSTERED);
 
-        assert(cfg_it->output_size() == 0);
-        cfg_it->link_append_output(entry, [](ssa_ht){ assert(false); return ssa_value_t(); });
+        if(lowerings)
+            lowerings->push_back(lowering);
 
+        ir.assert_valid();
         updated = true;
     }
 
     return updated;
 }
-
@@ -1,6 +1,8 @@
 #ifndef SWITCH_HPP
 #define SWITCH_HPP
 
+#include <cstdint>
+#include <string_view>
 #include <vector>
 
 #include "robin/map.hpp"
@@ -16,9 +18,33 @@ class ssa_node_t;
 // Return 'true' on success.
 bool switch_partial_to_full(ssa_node_t& switch_node);
 
+enum switch_strategy_t : std::uint8_t
+{
+    SWITCH_TABLE,     // A single jump table.
+    SWITCH_TREE,      // Comparisons only; a binary search.
+    SWITCH_CLUSTERED, // Comparisons leading to multiple jump tables.
+};
+
+std::string_view to_string(switch_strategy_t strategy);
+
+// Describes how a switch was lowered, for the info dump.
+struct switch_lowering_t
+{
+    cfg_ht cfg;
+    unsigned cases = 0;
+    switch_strategy_t strategy = SWITCH_TABLE;
+    unsigned tables = 0;
+    unsigned table_entries = 0;
+    unsigned compares = 0;
+    unsigned bytes = 0; // Estimated.
+    std::uint64_t weight = 1; // How much cycles matter, based on loop depth.
+};
+
 // Converts every SSA_switch_partial node to SSA_switch_full.
+// Based on a cost model, cases may get split into a binary search tree,
+// with leaves that are either comparisons or smaller jump tables.
 // Return 'true' if any node updated.
-bool switch_partial_to_full(ir_t& ir);
+bool switch_partial_to_full(ir_t& ir, std::vector<switch_lowering_t>* lowerings = nullptr);
 
 using switch_table_t = std::vector<locator_t>;
 
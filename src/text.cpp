@@ -140,7 +140,7 @@ std::size_t normalize_line_endings(char* const data, std::size_t size)
         else if(c == '\n' && i+1 != size && data[i+1] == '\r')
             ++i;
 
-        data[i] = c;
+        data[o] = c;
     }
 
     return o;
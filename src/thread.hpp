@@ -5,6 +5,7 @@
 #define NO_THREAD
 #endif
 
+#include <algorithm>
 #include <exception>
 #include <vector>
 #include <atomic>
@@ -70,4 +71,23 @@ void parallelize(unsigned const num_threads, Fn const& fn, OnError const& on_err
 #endif
 }
 
+// Calls 'fn' on each element of 'vec', spread across 'num_threads' threads.
+template<typename T, typename Fn>
+void parallel_for_each(unsigned const num_threads, std::vector<T> const& vec, Fn const& fn)
+{
+    std::atomic<std::size_t> next_i = 0;
+
+    parallelize(std::min<std::size_t>(num_threads, vec.size()),
+    [&](std::atomic<bool>& exception_thrown)
+    {
+        while(!exception_thrown)
+        {
+            std::size_t const i = next_i++;
+            if(i >= vec.size())
+                return;
+            fn(vec[i]);
+        }
+    }, []{});
+}
+
 #endif
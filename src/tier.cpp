@@ -0,0 +1,87 @@
+#include "tier.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "robin/set.hpp"
+
+#include "globals.hpp"
+#include "options.hpp"
+
+// Written only by 'load_tiers', before parsing starts.
+// Read-only afterwards, so no locking is needed.
+static rh::batman_set<std::string> hot_fns;
+
+static std::string tier_path()
+{
+    return compiler_options().output_file + ".tier";
+}
+
+void load_tiers()
+{
+    assert(compiler_options().tiered);
+
+    std::ifstream ifs(tier_path());
+    if(!ifs)
+        return; // First build; everything is sloppy.
+
+    std::string line;
+    while(std::getline(ifs, line))
+    {
+        // Each line holds a name, optionally followed by a score.
+        std::string const name = line.substr(0, line.find(' '));
+        if(!name.empty())
+            hot_fns.insert(name);
+    }
+}
+
+bool tier_hot(std::string_view fn_name)
+{
+    return hot_fns.count(std::string(fn_name));
+}
+
+void save_tiers()
+{
+    assert(compiler_options().tiered);
+
+    std::vector<fn_t const*> ranked;
+    unsigned num_fns = 0;
+    unsigned num_optimized = 0;
+
+    for(fn_t const& fn : fn_ht::values())
+    {
+        if(fn.iasm)
+            continue;
+        ++num_fns;
+        if(!fn.sloppy())
+            ++num_optimized;
+        if(fn.tier_score())
+            ranked.push_back(&fn);
+    }
+
+    std::sort(ranked.begin(), ranked.end(), [](fn_t const* a, fn_t const* b)
+    {
+        if(a->tier_score() != b->tier_score())
+            return a->tier_score() > b->tier_score();
+        return a->global.name < b->global.name;
+    });
+
+    // Optimize the top quarter next time.
+    std::size_t const num_hot = std::min<std::size_t>(ranked.size(), std::max<std::size_t>(1, ranked.size() / 4));
+
+    std::ofstream ofs(tier_path());
+    if(!ofs)
+        throw std::runtime_error(fmt("Unable to write tier file %", tier_path()));
+
+    for(std::size_t i = 0; i < num_hot; ++i)
+        ofs << ranked[i]->global.name << ' ' << ranked[i]->tier_score() << '\n';
+
+    if(compiler_options().build_time)
+    {
+        std::printf("tier: %u of %u fns optimized, %u hot for next build\n", 
+                    num_optimized, num_fns, unsigned(num_hot));
+    }
+}
@@ -0,0 +1,22 @@
+#ifndef TIER_HPP
+#define TIER_HPP
+
+// Tiered compilation speeds up the development loop.
+// Every function is compiled sloppily, except for the hot ones
+// recorded in a cache file by the previous build.
+// After compiling, functions are ranked by hotness and the cache file is rewritten,
+// so the next build optimizes what this one found to be hot.
+
+#include <string_view>
+
+// Loads hot function names from the cache file, if it exists.
+// Must be called before parsing.
+void load_tiers();
+
+// Returns true if the function should be compiled at full optimization.
+bool tier_hot(std::string_view fn_name);
+
+// Ranks compiled functions and writes the hottest ones to the cache file.
+void save_tiers();
+
+#endif
@@ -1,7 +1,12 @@
 #ifndef WORKLIST_HPP
 #define WORKLIST_HPP
 
+#include <algorithm>
+#include <cstdint>
 #include <deque>
+#include <functional>
+#include <utility>
+#include <vector>
 
 #include "flags.hpp"
 #include "ir_decl.hpp"
@@ -50,6 +55,47 @@ public:
     bool empty() { return container.empty(); }
 };
 
+// Like 'worklist_t', but pops the handle with the lowest priority first.
+// Ties are broken by handle, so the order is deterministic.
+template<typename H>
+class priority_worklist_t
+{
+public:
+    using priority_t = std::uint64_t;
+
+    std::vector<std::pair<priority_t, H>> heap;
+
+    void push(H h, priority_t priority)
+    {
+        if(h->test_flags(FLAG_IN_WORKLIST))
+            return;
+        h->set_flags(FLAG_IN_WORKLIST);
+        heap.emplace_back(priority, h);
+        std::push_heap(heap.begin(), heap.end(), std::greater<>{});
+    }
+
+    priority_t top_priority() const { return heap.front().first; }
+    H top() const { return heap.front().second; }
+
+    H pop()
+    {
+        H ret = top();
+        ret->clear_flags(FLAG_IN_WORKLIST);
+        std::pop_heap(heap.begin(), heap.end(), std::greater<>{});
+        heap.pop_back();
+        return ret;
+    }
+
+    void clear()
+    {
+        for(auto const& pair : heap)
+            pair.second->clear_flags(FLAG_IN_WORKLIST);
+        heap.clear();
+    }
+
+    bool empty() const { return heap.empty(); }
+};
+
 extern TLS worklist_t<cfg_ht> cfg_worklist;
 extern TLS worklist_t<ssa_ht> ssa_worklist;
 